@@ -130,6 +130,48 @@
 */
 #define UTF8_ERR_OVERLAPPING_PARAMETERS         (-4)
 
+/*!
+	\def UTF8_ERR_INVALID_LOCALE
+	\brief Requested locale for case mapping is invalid.
+*/
+#define UTF8_ERR_INVALID_LOCALE                 (-5)
+
+/*!
+	\}
+*/
+
+/*!
+	\name Locales
+	Values used for case mapping with an explicit locale.
+	\{
+*/
+
+/*!
+	\def UTF8_LOCALE_DEFAULT
+	\brief Use the case mappings defined by the Unicode standard.
+*/
+#define UTF8_LOCALE_DEFAULT                     (0)
+
+/*!
+	\def UTF8_LOCALE_LITHUANIAN
+	\brief Keep the dot above lowercase 'i' and 'j' when other accents are
+	added or removed.
+*/
+#define UTF8_LOCALE_LITHUANIAN                  (1)
+
+/*!
+	\def UTF8_LOCALE_TURKISH_AND_AZERI_LATIN
+	\brief Map between dotted and dotless 'i' as used in Turkish and Azeri
+	written in the Latin script.
+*/
+#define UTF8_LOCALE_TURKISH_AND_AZERI_LATIN     (2)
+
+/*!
+	\def UTF8_LOCALE_MAXIMUM
+	\brief Terminal value for locales. Valid locales do not exceed this value.
+*/
+#define UTF8_LOCALE_MAXIMUM                     (3)
+
 /*!
 	\}
 */
@@ -614,6 +656,534 @@ UTF8_API size_t utf8towide(const char* input, size_t inputSize, wchar_t* target,
 */
 UTF8_API const char* utf8seek(const char* text, size_t textSize, const char* textStart, off_t offset, int direction);
 
+/*!
+	\brief Index of byte offsets in a UTF-8 encoded string.
+
+	Stores the byte offset of every n-th code point in a string, allowing
+	#utf8seekindexed to find a code point without walking the string from the
+	start. The offsets are stored in an array provided by the caller.
+
+	The members of this struct should be considered private. Use
+	#utf8seekindexinit or #utf8seekindexload to initialize an index.
+
+	\sa utf8seekindexinit
+	\sa utf8seekindexed
+*/
+typedef struct {
+	size_t* offsets;
+	size_t offsets_size;
+	size_t count;
+	size_t interval;
+	size_t length;
+	size_t size;
+} utf8seekindex_t;
+
+/*!
+	\brief Initialize an empty seek index.
+
+	The index stores the byte offset of every `interval` code points in the
+	array pointed to by `offsets`. An index covering a string with a length
+	of n code points needs `n / interval + 1` offsets. A larger interval
+	requires less memory, but seeking needs to walk more code points after
+	finding the closest offset.
+
+	\param[out]  index        Seek index to initialize.
+	\param[in]   interval     Amount of code points between stored offsets.
+	\param[in]   offsets      Storage for offsets.
+	\param[in]   offsetsSize  Amount of offsets that can be stored.
+	\param[out]  errors       Output for errors.
+
+	\return Returns 1 on success or 0 on failure.
+
+	\retval #UTF8_ERR_NONE          No errors.
+	\retval #UTF8_ERR_INVALID_DATA  Index or offsets is NULL or interval is zero.
+
+	\sa utf8seekindexappend
+	\sa utf8seekindexed
+*/
+UTF8_API uint8_t utf8seekindexinit(utf8seekindex_t* index, size_t interval, size_t* offsets, size_t offsetsSize, int32_t* errors);
+
+/*!
+	\brief Add text to a seek index.
+
+	The text must start at the same address as the text that was indexed
+	before and must include it unchanged. Only the part of the text after the
+	previously indexed bytes is read, which allows an index to be built while
+	a buffer is filled.
+
+	A multi-byte sequence that is cut off by the end of the text is not
+	indexed until the rest of the sequence has been appended.
+
+	When the offsets array is full, the index stops growing. Seeking past the
+	last stored offset is still possible, but walks the string from there.
+
+	Example:
+
+	\code{.c}
+		char text[65536];
+		size_t text_size = 0;
+		size_t offsets[1024];
+		utf8seekindex_t index;
+		size_t read;
+		const char* page;
+
+		utf8seekindexinit(&index, 64, offsets, 1024, NULL);
+
+		while ((read = fread(text + text_size, 1, 4096, file)) > 0)
+		{
+			text_size += read;
+
+			utf8seekindexappend(&index, text, text_size, NULL);
+		}
+
+		page = utf8seekindexed(&index, text, text_size, text, 1920, SEEK_SET);
+	\endcode
+
+	\param[in,out]  index     Seek index.
+	\param[in]      text      Input string, starting with the previously indexed text.
+	\param[in]      textSize  Size of the input string in bytes.
+	\param[out]     errors    Output for errors.
+
+	\return Amount of code points indexed.
+
+	\retval #UTF8_ERR_NONE              No errors.
+	\retval #UTF8_ERR_INVALID_DATA      Index was not initialized, text is NULL or shorter than the indexed text.
+	\retval #UTF8_ERR_NOT_ENOUGH_SPACE  Offsets array is full.
+
+	\sa utf8seekindexinit
+	\sa utf8seekindexed
+*/
+UTF8_API size_t utf8seekindexappend(utf8seekindex_t* index, const char* text, size_t textSize, int32_t* errors);
+
+/*!
+	\brief Serialize a seek index.
+
+	Writes the index to a buffer so it can be stored alongside the text it
+	describes and loaded with #utf8seekindexload without walking the text
+	again. All values are stored as 64-bit little-endian integers, making the
+	result portable between platforms.
+
+	Call this function with a NULL target to determine the amount of bytes
+	needed.
+
+	\param[in]   index       Seek index.
+	\param[out]  target      Output buffer for the result, can be NULL.
+	\param[in]   targetSize  Size of the output buffer in bytes.
+	\param[out]  errors      Output for errors.
+
+	\return Amount of bytes needed for storing output.
+
+	\retval #UTF8_ERR_NONE              No errors.
+	\retval #UTF8_ERR_INVALID_DATA      Index was not initialized.
+	\retval #UTF8_ERR_NOT_ENOUGH_SPACE  Target buffer size is insufficient for result.
+
+	\sa utf8seekindexload
+*/
+UTF8_API size_t utf8seekindexsave(const utf8seekindex_t* index, char* target, size_t targetSize, int32_t* errors);
+
+/*!
+	\brief Deserialize a seek index.
+
+	Loads an index written by #utf8seekindexsave. The stored offsets are
+	copied to the array pointed to by `offsets`. The stored values are
+	validated, but the text itself is not read; the index must be used with
+	the same text it was built from.
+
+	\param[out]  index        Seek index to initialize.
+	\param[in]   input        Serialized index.
+	\param[in]   inputSize    Size of the serialized index in bytes.
+	\param[in]   offsets      Storage for offsets.
+	\param[in]   offsetsSize  Amount of offsets that can be stored.
+	\param[out]  errors       Output for errors.
+
+	\return Returns 1 on success or 0 on failure.
+
+	\retval #UTF8_ERR_NONE              No errors.
+	\retval #UTF8_ERR_INVALID_DATA      Serialized index is malformed.
+	\retval #UTF8_ERR_NOT_ENOUGH_SPACE  Offsets array is too small for the stored offsets.
+
+	\sa utf8seekindexsave
+*/
+UTF8_API uint8_t utf8seekindexload(utf8seekindex_t* index, const char* input, size_t inputSize, size_t* offsets, size_t offsetsSize, int32_t* errors);
+
+/*!
+	\brief Seek into a UTF-8 encoded string using a seek index.
+
+	Works like #utf8seek, but uses the index to find the closest stored offset
+	before the requested code point and only walks the string from there.
+	Seeking in a large string takes O(log n) instead of O(n) time.
+
+	Seeking backwards from the current position or from the end determines
+	the position of `text` first and then seeks forward from the start. For
+	valid UTF-8 the result is the same as that of #utf8seek, but invalid
+	sequences may be counted differently when seeking backwards.
+
+	`text` should point to the start of a code point when seeking from the
+	current position. When `index` is NULL, this function calls #utf8seek.
+
+	\param[in]  index      Seek index for the string starting at `textStart`.
+	\param[in]  text       Input string.
+	\param[in]  textSize   Size of the string starting at `textStart` in bytes.
+	\param[in]  textStart  Start of input string.
+	\param[in]  offset     Requested offset in code points.
+	\param[in]  direction  Direction to seek in.
+	\arg `SEEK_SET` Offset is from the start of the string.
+	\arg `SEEK_CUR` Offset is from the current position of the string.
+	\arg `SEEK_END` Offset is from the end of the string.
+
+	\return Pointer to offset string or no change on error.
+
+	\sa utf8seek
+	\sa utf8seekindexappend
+*/
+UTF8_API const char* utf8seekindexed(const utf8seekindex_t* index, const char* text, size_t textSize, const char* textStart, off_t offset, int direction);
+
+/*!
+	\brief Position in a UTF-8 encoded string.
+
+	Describes the same position in every unit used by #utf8lineindexfind.
+	Offsets are counted from the start of the string. Code points are
+	counted the same way as #utf8toutf32 decodes them and UTF-16 code units
+	the same way as #utf8toutf16 encodes them.
+
+	Lines end on LF, CR LF or a single CR and are counted from zero. The
+	column is measured in UTF-16 code units from the start of the line.
+*/
+typedef struct {
+	size_t offset;
+	size_t codepoint;
+	size_t utf16;
+	size_t line;
+	size_t column;
+} utf8position_t;
+
+/*!
+	\brief Index of lines and positions in a UTF-8 encoded string.
+
+	Stores the position of the start of every line and of every n-th code
+	point on long lines, allowing #utf8lineindexfind to convert between byte
+	offsets, code points, UTF-16 code units and lines without walking the
+	string from the start. The marks are stored in an array provided by the
+	caller.
+
+	The members of this struct should be considered private. Use
+	#utf8lineindexinit to initialize an index.
+
+	\sa utf8lineindexbuild
+	\sa utf8lineindexfind
+*/
+typedef struct {
+	utf8position_t* marks;
+	size_t marks_size;
+	size_t count;
+	size_t interval;
+	utf8position_t end;
+} utf8lineindex_t;
+
+/*!
+	\name Position units
+	Units used as input for #utf8lineindexfind.
+	\{
+*/
+
+/*!
+	\def UTF8_POSITION_OFFSET
+	\brief Find a position by its offset in bytes.
+*/
+#define UTF8_POSITION_OFFSET                    0x00000001
+
+/*!
+	\def UTF8_POSITION_CODEPOINT
+	\brief Find a position by its offset in code points.
+*/
+#define UTF8_POSITION_CODEPOINT                 0x00000002
+
+/*!
+	\def UTF8_POSITION_UTF16
+	\brief Find a position by its offset in UTF-16 code units.
+*/
+#define UTF8_POSITION_UTF16                     0x00000003
+
+/*!
+	\def UTF8_POSITION_LINE
+	\brief Find a position by its line and column.
+*/
+#define UTF8_POSITION_LINE                      0x00000004
+
+/*!
+	\}
+*/
+
+/*!
+	\brief Initialize an empty line index.
+
+	The index stores a mark at the start of every line and after every
+	`interval` code points on the same line. Finding a position takes a
+	binary search over the marks followed by walking at most `interval` code
+	points.
+
+	The array of marks must have room for at least one mark. When it is too
+	small for the text, the index still works, but positions between marks
+	take longer to find.
+
+	\param[out]  index      Line index to initialize.
+	\param[in]   interval   Maximum amount of code points between marks on a line.
+	\param[in]   marks      Storage for marks.
+	\param[in]   marksSize  Amount of marks that can be stored.
+	\param[out]  errors     Output for errors.
+
+	\return Returns 1 on success or 0 on failure.
+
+	\retval #UTF8_ERR_NONE          No errors.
+	\retval #UTF8_ERR_INVALID_DATA  Index or marks is NULL or interval is zero.
+
+	\sa utf8lineindexbuild
+*/
+UTF8_API uint8_t utf8lineindexinit(utf8lineindex_t* index, size_t interval, utf8position_t* marks, size_t marksSize, int32_t* errors);
+
+/*!
+	\brief Build a line index for a string.
+
+	Discards the contents of the index and indexes the whole string.
+
+	\param[in,out]  index     Line index.
+	\param[in]      text      Input string.
+	\param[in]      textSize  Size of the input string in bytes.
+	\param[out]     errors    Output for errors.
+
+	\return Amount of lines in the string.
+
+	\retval #UTF8_ERR_NONE              No errors.
+	\retval #UTF8_ERR_INVALID_DATA      Index was not initialized or text is NULL.
+	\retval #UTF8_ERR_NOT_ENOUGH_SPACE  Not every mark could be stored.
+
+	\sa utf8lineindexupdate
+*/
+UTF8_API size_t utf8lineindexbuild(utf8lineindex_t* index, const char* text, size_t textSize, int32_t* errors);
+
+/*!
+	\brief Update a line index after the string was edited.
+
+	Call this function after replacing `removedSize` bytes at `editOffset`
+	with `insertedSize` bytes. The string is scanned from the last mark
+	before the edit until the scan reaches a mark after the edit, after
+	which the remaining marks are moved instead of scanned again.
+
+	Example:
+
+	\code{.c}
+		void on_change(document_t* document, size_t start, size_t removed, const char* inserted, size_t insertedSize)
+		{
+			memmove(document->text + start + insertedSize, document->text + start + removed, document->size - start - removed);
+			memcpy(document->text + start, inserted, insertedSize);
+			document->size = document->size - removed + insertedSize;
+
+			utf8lineindexupdate(&document->lines, document->text, document->size, start, removed, insertedSize, NULL);
+		}
+	\endcode
+
+	\param[in,out]  index         Line index.
+	\param[in]      text          Edited string.
+	\param[in]      textSize      Size of the edited string in bytes.
+	\param[in]      editOffset    Offset of the edit in bytes.
+	\param[in]      removedSize   Amount of bytes removed at the offset.
+	\param[in]      insertedSize  Amount of bytes inserted at the offset.
+	\param[out]     errors        Output for errors.
+
+	\return Amount of lines in the string.
+
+	\retval #UTF8_ERR_NONE              No errors.
+	\retval #UTF8_ERR_INVALID_DATA      Index was not initialized, text is NULL or the edit does not match the indexed string.
+	\retval #UTF8_ERR_NOT_ENOUGH_SPACE  Not every mark could be stored.
+
+	\sa utf8lineindexbuild
+*/
+UTF8_API size_t utf8lineindexupdate(utf8lineindex_t* index, const char* text, size_t textSize, size_t editOffset, size_t removedSize, size_t insertedSize, int32_t* errors);
+
+/*!
+	\brief Convert a position in a string using a line index.
+
+	Reads the requested position from the member of `position` that matches
+	`unit` and fills in every other member. For #UTF8_POSITION_LINE, both
+	`line` and `column` are read.
+
+	When the requested position does not start a code point, the result is
+	the start of the code point that contains it. This includes an offset in
+	the middle of a surrogate pair. A column past the end of a line resolves
+	to the end of that line and a position past the end of the string
+	resolves to the end of the string.
+
+	Example:
+
+	\code{.c}
+		utf8position_t position;
+
+		position.line = request->line;
+		position.column = request->character;
+
+		utf8lineindexfind(&document->lines, document->text, document->size, UTF8_POSITION_LINE, &position, NULL);
+
+		insert_text(document, position.offset, request->text);
+	\endcode
+
+	\param[in]      index     Line index for the string.
+	\param[in]      text      Input string.
+	\param[in]      textSize  Size of the input string in bytes.
+	\param[in]      unit      Unit of the requested position.
+	\arg #UTF8_POSITION_OFFSET
+	\arg #UTF8_POSITION_CODEPOINT
+	\arg #UTF8_POSITION_UTF16
+	\arg #UTF8_POSITION_LINE
+	\param[in,out]  position  Requested position and output for the result.
+	\param[out]     errors    Output for errors.
+
+	\return Returns 1 if the position was found exactly or 0 otherwise.
+
+	\retval #UTF8_ERR_NONE          No errors.
+	\retval #UTF8_ERR_INVALID_DATA  Index was not initialized, text is NULL or does not match the index.
+	\retval #UTF8_ERR_INVALID_FLAG  Unit is not a valid position unit.
+
+	\sa utf8lineindexbuild
+*/
+UTF8_API uint8_t utf8lineindexfind(const utf8lineindex_t* index, const char* text, size_t textSize, size_t unit, utf8position_t* position, int32_t* errors);
+
+/*!
+	\brief Get the length in grapheme clusters of a UTF-8 encoded string.
+
+	A grapheme cluster is what a user perceives as a single character, such
+	as a letter followed by combining marks, a Hangul syllable made from
+	conjoining jamo, a flag made from two regional indicators or an emoji
+	joined with U+200D ZERO WIDTH JOINER. Clusters are determined with the
+	extended grapheme cluster rules of Unicode Standard Annex #29.
+
+	Invalid sequences are treated as U+FFFD REPLACEMENT CHARACTER.
+
+	\note Grapheme clusters are the only part of the library, besides word
+	boundaries, that doesn't use the Unicode 7.0 character database. The
+	Grapheme_Cluster_Break property and the rules come from Unicode 14.0,
+	because Unicode 7.0 does not define the rules for emoji sequences. Code
+	points assigned after Unicode 7.0, like newer emoji, are segmented
+	according to Unicode 14.0 here, while functions such as
+	#utf8iscategory and #utf8normalize treat them as unassigned.
+
+	\param[in]  text      Input string.
+	\param[in]  textSize  Size of the input string in bytes.
+
+	\return Length in grapheme clusters.
+
+	\sa utf8len
+	\sa utf8graphemeseek
+*/
+UTF8_API size_t utf8graphemelen(const char* text, size_t textSize);
+
+/*!
+	\brief Seek into a UTF-8 encoded string by grapheme clusters.
+
+	Works like #utf8seek, but the offset is in grapheme clusters instead of
+	code points. This can be used to move a cursor one user-perceived
+	character at a time or to truncate a string without splitting a
+	character.
+
+	Seeking backwards only reads as far back as needed to find a boundary
+	that does not depend on the text before it, which is usually the
+	previous code point.
+
+	\note Like #utf8graphemelen, this function uses the Unicode 14.0
+	Grapheme_Cluster_Break property instead of the Unicode 7.0 character
+	database used by the rest of the library.
+
+	Example:
+
+	\code{.c}
+		const char* cursor_left(const char* text, size_t textSize, const char* cursor)
+		{
+			return utf8graphemeseek(cursor, textSize, text, -1, SEEK_CUR);
+		}
+
+		size_t truncate_length(const char* text, size_t textSize, size_t maximum)
+		{
+			return utf8graphemeseek(text, textSize, text, maximum, SEEK_SET) - text;
+		}
+	\endcode
+
+	\param[in]  text       Input string.
+	\param[in]  textSize   Size of the string starting at `textStart` in bytes.
+	\param[in]  textStart  Start of input string.
+	\param[in]  offset     Requested offset in grapheme clusters.
+	\param[in]  direction  Direction to seek in.
+	\arg `SEEK_SET` Offset is from the start of the string.
+	\arg `SEEK_CUR` Offset is from the current position of the string.
+	\arg `SEEK_END` Offset is from the end of the string.
+
+	\return Pointer to offset string or no change on error.
+
+	\sa utf8seek
+	\sa utf8graphemelen
+*/
+UTF8_API const char* utf8graphemeseek(const char* text, size_t textSize, const char* textStart, off_t offset, int direction);
+
+/*!
+	\brief Split a UTF-8 encoded string on word boundaries.
+
+	Finds the word boundaries in the input in a single pass, following the
+	default word boundary rules of Unicode Standard Annex #29. Every word,
+	number, run of horizontal whitespace, line break and punctuation mark
+	becomes a segment of its own.
+
+	Letters joined by an apostrophe or a period ("can't", "e.g") and numbers
+	with separators ("3.14", "1,000") stay together, as do runs of Katakana
+	and emoji sequences. Ideographs and Hiragana do not have word boundaries
+	defined without a dictionary, so each of them becomes a separate segment.
+
+	\note The Word_Break property and the rules come from Unicode 14.0, while
+	the rest of the library uses the Unicode 7.0 character database. Code
+	points assigned after Unicode 7.0 are classified according to Unicode
+	14.0 here, while functions such as #utf8iscategory treat them as
+	unassigned.
+
+	The offsets are written to the `offsets` array, starting with 0 for the
+	first segment. Specify NULL for the array to retrieve the amount of
+	segments.
+
+	Example:
+
+	\code{.c}
+		void tokenize(const char* text, size_t textSize, Index* index)
+		{
+			size_t offsets[256];
+			size_t count = utf8wordsplit(text, textSize, offsets, 256, NULL);
+			size_t i;
+
+			for (i = 0; i < count; ++i)
+			{
+				size_t end = (i + 1 < count) ? offsets[i + 1] : textSize;
+				size_t length = end - offsets[i];
+
+				if (utf8iscategory(text + offsets[i], length, UTF8_CATEGORY_LETTER | UTF8_CATEGORY_NUMBER) > 0)
+				{
+					index_add(index, text + offsets[i], length);
+				}
+			}
+		}
+	\endcode
+
+	\param[in]   input        UTF-8 encoded string.
+	\param[in]   inputSize    Size of the input in bytes.
+	\param[out]  offsets      Output array for the offsets in bytes to the start of each segment, can be NULL.
+	\param[in]   offsetsSize  Amount of entries in the offsets array.
+	\param[out]  errors       Output for errors.
+
+	\return Amount of segments.
+
+	\retval #UTF8_ERR_NONE              No errors.
+	\retval #UTF8_ERR_INVALID_DATA      Input is NULL.
+	\retval #UTF8_ERR_NOT_ENOUGH_SPACE  Offsets array could not hold all of the segments.
+
+	\sa utf8graphemeseek
+	\sa utf8iscategory
+*/
+UTF8_API size_t utf8wordsplit(const char* input, size_t inputSize, size_t* offsets, size_t offsetsSize, int32_t* errors);
+
 /*!
 	\brief Convert UTF-8 encoded text to uppercase.
 
@@ -640,7 +1210,8 @@ UTF8_API const char* utf8seek(const char* text, size_t textSize, const char* tex
 	Unfortunately, no cross-platform way of setting and retrieving the system
 	locale is available without adding dependencies to the library. Please
 	refer to your operating system's manual to see how to setup the system
-	locale on your target system.
+	locale on your target system. Use the variant of this function with an
+	explicit locale to avoid reading the system locale on every call.
 	
 	\par For more information on these exceptional code points, please refer
 	to the text file made available by the Unicode Consortium:
@@ -700,6 +1271,7 @@ UTF8_API const char* utf8seek(const char* text, size_t textSize, const char* tex
 	\sa utf8tolower
 	\sa utf8totitle
 	\sa utf8casefold
+	\sa utf8toupper_l
 */
 UTF8_API size_t utf8toupper(const char* input, size_t inputSize, char* target, size_t targetSize, int32_t* errors);
 
@@ -730,7 +1302,8 @@ UTF8_API size_t utf8toupper(const char* input, size_t inputSize, char* target, s
 	Unfortunately, no cross-platform way of setting and retrieving the system
 	locale is available without adding dependencies to the library. Please
 	refer to your operating system's manual to see how to setup the system
-	locale on your target system.
+	locale on your target system. Use the variant of this function with an
+	explicit locale to avoid reading the system locale on every call.
 
 	\par For more information on these exceptional code points, please refer
 	to the text file made available by the Unicode Consortium:
@@ -794,6 +1367,7 @@ UTF8_API size_t utf8toupper(const char* input, size_t inputSize, char* target, s
 	\sa utf8toupper
 	\sa utf8totitle
 	\sa utf8casefold
+	\sa utf8tolower_l
 */
 UTF8_API size_t utf8tolower(const char* input, size_t inputSize, char* target, size_t targetSize, int32_t* errors);
 
@@ -839,7 +1413,8 @@ UTF8_API size_t utf8tolower(const char* input, size_t inputSize, char* target, s
 	Unfortunately, no cross-platform way of setting and retrieving the system
 	locale is available without adding dependencies to the library. Please
 	refer to your operating system's manual to see how to setup the system
-	locale on your target system.
+	locale on your target system. Use the variant of this function with an
+	explicit locale to avoid reading the system locale on every call.
 
 	\par For more information on these exceptional code points, please refer
 	to the text file made available by the Unicode Consortium:
@@ -882,6 +1457,7 @@ UTF8_API size_t utf8tolower(const char* input, size_t inputSize, char* target, s
 	\sa utf8tolower
 	\sa utf8toupper
 	\sa utf8casefold
+	\sa utf8totitle_l
 */
 UTF8_API size_t utf8totitle(const char* input, size_t inputSize, char* target, size_t targetSize, int32_t* errors);
 
@@ -919,7 +1495,8 @@ UTF8_API size_t utf8totitle(const char* input, size_t inputSize, char* target, s
 	Unfortunately, no cross-platform way of setting and retrieving the system
 	locale is available without adding dependencies to the library. Please
 	refer to your operating system's manual to see how to setup the system
-	locale on your target system.
+	locale on your target system. Use the variant of this function with an
+	explicit locale to avoid reading the system locale on every call.
 
 	Example:
 
@@ -992,272 +1569,1484 @@ UTF8_API size_t utf8totitle(const char* input, size_t inputSize, char* target, s
 	\sa utf8tolower
 	\sa utf8toupper
 	\sa utf8totitle
+	\sa utf8casefold_l
 */
 UTF8_API size_t utf8casefold(const char* input, size_t inputSize, char* target, size_t targetSize, int32_t* errors);
 
 /*!
-	\name Normalization flags
-	Flags used as input for #utf8normalize and the result of #utf8isnormalized.
-	\{
-*/
+	\brief Get the locale used for case mapping from the system locale.
 
-/*!
-	\def UTF8_NORMALIZE_COMPOSE
-	\brief Normalize input to Normalization Form C (NFC).
-*/
-#define UTF8_NORMALIZE_COMPOSE                  0x00000001
+	The case mapping functions without an explicit locale call this function
+	every time they are called. Because it reads the process-wide system
+	locale, it is more efficient to retrieve the locale once and pass it to
+	the case mapping functions that take an explicit locale. Those functions
+	do not depend on global state and can safely be called from multiple
+	threads, even when the system locale is changed.
 
-/*!
-	\def UTF8_NORMALIZE_DECOMPOSE
-	\brief Normalize input to Normalization Form D (NFD).
-*/
-#define UTF8_NORMALIZE_DECOMPOSE                0x00000002
+	Example:
 
-/*!
+	\code{.c}
+		void Index_AddWords(index_t* index, const char** words, size_t wordCount)
+		{
+			size_t locale = utf8getlocale();
+			char converted[256];
+			size_t i;
+
+			for (i = 0; i < wordCount; ++i)
+			{
+				int32_t errors;
+				size_t converted_size = utf8casefold_l(words[i], strlen(words[i]), converted, sizeof(converted) - 1, locale, &errors);
+				if (errors == UTF8_ERR_NONE)
+				{
+					converted[converted_size] = 0;
+
+					Index_Add(index, converted);
+				}
+			}
+		}
+	\endcode
+
+	\return Locale that matches the system locale, #UTF8_LOCALE_DEFAULT if
+	the system locale does not have exceptional case mappings.
+
+	\sa utf8toupper_l
+	\sa utf8tolower_l
+	\sa utf8totitle_l
+	\sa utf8casefold_l
+*/
+UTF8_API size_t utf8getlocale();
+
+/*!
+	\brief Convert UTF-8 encoded text to uppercase using an explicit locale.
+
+	Equivalent to #utf8toupper, except that the locale is specified by the
+	caller instead of being read from the system locale.
+
+	\param[in]   input       UTF-8 encoded string.
+	\param[in]   inputSize   Size of the input in bytes.
+	\param[out]  target      Output buffer for the result, can be NULL.
+	\param[in]   targetSize  Size of the output buffer in bytes.
+	\param[in]   locale      Locale used for case mapping, see #utf8getlocale.
+	\param[out]  errors      Output for errors.
+
+	\return Amount of bytes needed to contain output.
+
+	\retval #UTF8_ERR_NONE                    No errors.
+	\retval #UTF8_ERR_INVALID_DATA            Failed to decode data.
+	\retval #UTF8_ERR_INVALID_LOCALE          Invalid locale was specified.
+	\retval #UTF8_ERR_OVERLAPPING_PARAMETERS  Input and output buffers overlap in memory.
+	\retval #UTF8_ERR_NOT_ENOUGH_SPACE        Target buffer size is insufficient for result.
+
+	\sa utf8toupper
+	\sa utf8getlocale
+*/
+UTF8_API size_t utf8toupper_l(const char* input, size_t inputSize, char* target, size_t targetSize, size_t locale, int32_t* errors);
+
+/*!
+	\brief Convert UTF-8 encoded text to lowercase using an explicit locale.
+
+	Equivalent to #utf8tolower, except that the locale is specified by the
+	caller instead of being read from the system locale.
+
+	\param[in]   input       UTF-8 encoded string.
+	\param[in]   inputSize   Size of the input in bytes.
+	\param[out]  target      Output buffer for the result, can be NULL.
+	\param[in]   targetSize  Size of the output buffer in bytes.
+	\param[in]   locale      Locale used for case mapping, see #utf8getlocale.
+	\param[out]  errors      Output for errors.
+
+	\return Amount of bytes needed for storing output.
+
+	\retval #UTF8_ERR_NONE                    No errors.
+	\retval #UTF8_ERR_INVALID_DATA            Failed to decode data.
+	\retval #UTF8_ERR_INVALID_LOCALE          Invalid locale was specified.
+	\retval #UTF8_ERR_OVERLAPPING_PARAMETERS  Input and output buffers overlap in memory.
+	\retval #UTF8_ERR_NOT_ENOUGH_SPACE        Target buffer size is insufficient for result.
+
+	\sa utf8tolower
+	\sa utf8getlocale
+*/
+UTF8_API size_t utf8tolower_l(const char* input, size_t inputSize, char* target, size_t targetSize, size_t locale, int32_t* errors);
+
+/*!
+	\brief Convert UTF-8 encoded text to titlecase using an explicit locale.
+
+	Equivalent to #utf8totitle, except that the locale is specified by the
+	caller instead of being read from the system locale.
+
+	\param[in]   input       UTF-8 encoded string.
+	\param[in]   inputSize   Size of the input in bytes.
+	\param[out]  target      Output buffer for the result, can be NULL.
+	\param[in]   targetSize  Size of the output buffer in bytes.
+	\param[in]   locale      Locale used for case mapping, see #utf8getlocale.
+	\param[out]  errors      Output for errors.
+
+	\return Amount of bytes needed for storing output.
+
+	\retval #UTF8_ERR_NONE                    No errors.
+	\retval #UTF8_ERR_INVALID_DATA            Failed to decode data.
+	\retval #UTF8_ERR_INVALID_LOCALE          Invalid locale was specified.
+	\retval #UTF8_ERR_OVERLAPPING_PARAMETERS  Input and output buffers overlap in memory.
+	\retval #UTF8_ERR_NOT_ENOUGH_SPACE        Target buffer size is insufficient for result.
+
+	\sa utf8totitle
+	\sa utf8getlocale
+*/
+UTF8_API size_t utf8totitle_l(const char* input, size_t inputSize, char* target, size_t targetSize, size_t locale, int32_t* errors);
+
+/*!
+	\brief Remove case distinction from UTF-8 encoded text using an explicit
+	locale.
+
+	Equivalent to #utf8casefold, except that the locale is specified by the
+	caller instead of being read from the system locale.
+
+	\param[in]   input       UTF-8 encoded string.
+	\param[in]   inputSize   Size of the input in bytes.
+	\param[out]  target      Output buffer for the result, can be NULL.
+	\param[in]   targetSize  Size of the output buffer in bytes.
+	\param[in]   locale      Locale used for case folding, see #utf8getlocale.
+	\param[out]  errors      Output for errors.
+
+	\return Amount of bytes needed for storing output.
+
+	\retval #UTF8_ERR_NONE                    No errors.
+	\retval #UTF8_ERR_INVALID_DATA            Failed to decode data.
+	\retval #UTF8_ERR_INVALID_LOCALE          Invalid locale was specified.
+	\retval #UTF8_ERR_OVERLAPPING_PARAMETERS  Input and output buffers overlap in memory.
+	\retval #UTF8_ERR_NOT_ENOUGH_SPACE        Target buffer size is insufficient for result.
+
+	\sa utf8casefold
+	\sa utf8getlocale
+*/
+UTF8_API size_t utf8casefold_l(const char* input, size_t inputSize, char* target, size_t targetSize, size_t locale, int32_t* errors);
+
+/*!
+	\brief Convert UTF-8 encoded text to uppercase in place.
+
+	Converts the text without a second buffer, by writing the uppercase text
+	over the input. This is possible as long as every case mapping results in
+	the same amount of bytes, which is true for most text, including Basic
+	Latin, Latin-1 Supplement, Greek and Cyrillic.
+
+	When a case mapping changes the length of the text, for example
+	U+FB00 LATIN SMALL LIGATURE FF, which becomes "FF", conversion stops
+	before that code point, even when other code points would make up for the
+	difference. The text before it is converted and the text after it is left
+	unchanged. The function then returns the amount of bytes needed
+	to store the uppercase version of the entire text and the error is set to
+	#UTF8_ERR_NOT_ENOUGH_SPACE. Because case mapping converted text again
+	does not change it, the partially converted text can be passed to
+	#utf8toupper with a target buffer of the returned size.
+
+	Invalid sequences are replaced by the replacement character (U+FFFD) when
+	converting, which also changes the length of the text.
+
+	Example:
+
+	\code{.c}
+		uint8_t Header_NormalizeName(char** name, size_t* nameSize)
+		{
+			int32_t errors;
+			size_t converted_size;
+			char* converted;
+
+			converted_size = utf8toupperinplace(*name, *nameSize, &errors);
+			if (errors == UTF8_ERR_NONE)
+			{
+				return 1;
+			}
+			else if (
+				errors != UTF8_ERR_NOT_ENOUGH_SPACE)
+			{
+				return 0;
+			}
+
+			converted = (char*)malloc(converted_size);
+
+			utf8toupper(*name, *nameSize, converted, converted_size, NULL);
+
+			free(*name);
+
+			*name = converted;
+			*nameSize = converted_size;
+
+			return 1;
+		}
+	\endcode
+
+	\param[in,out]  text      UTF-8 encoded string, converted in place.
+	\param[in]      textSize  Size of the text in bytes.
+	\param[out]     errors    Output for errors.
+
+	\return Amount of bytes needed for storing the uppercase text.
+
+	\retval #UTF8_ERR_NONE              Text was converted in place.
+	\retval #UTF8_ERR_INVALID_DATA      Text is NULL.
+	\retval #UTF8_ERR_NOT_ENOUGH_SPACE  A case mapping changes the length and text was only partially converted.
+
+	\sa utf8toupper
+	\sa utf8tolowerinplace
+	\sa utf8casefoldinplace
+*/
+UTF8_API size_t utf8toupperinplace(char* text, size_t textSize, int32_t* errors);
+
+/*!
+	\brief Convert UTF-8 encoded text to lowercase in place.
+
+	Converts the text by writing the lowercase text over the input, as long
+	as the case mappings do not change the length of the text. See
+	#utf8toupperinplace for what happens when the length does change.
+
+	\param[in,out]  text      UTF-8 encoded string, converted in place.
+	\param[in]      textSize  Size of the text in bytes.
+	\param[out]     errors    Output for errors.
+
+	\return Amount of bytes needed for storing the lowercase text.
+
+	\retval #UTF8_ERR_NONE              Text was converted in place.
+	\retval #UTF8_ERR_INVALID_DATA      Text is NULL.
+	\retval #UTF8_ERR_NOT_ENOUGH_SPACE  A case mapping changes the length and text was only partially converted.
+
+	\sa utf8tolower
+	\sa utf8toupperinplace
+	\sa utf8casefoldinplace
+*/
+UTF8_API size_t utf8tolowerinplace(char* text, size_t textSize, int32_t* errors);
+
+/*!
+	\brief Remove case distinction from UTF-8 encoded text in place.
+
+	Folds the case of the text by writing the result over the input, as long
+	as the case folding does not change the length of the text. See
+	#utf8toupperinplace for what happens when the length does change.
+
+	\param[in,out]  text      UTF-8 encoded string, converted in place.
+	\param[in]      textSize  Size of the text in bytes.
+	\param[out]     errors    Output for errors.
+
+	\return Amount of bytes needed for storing the case folded text.
+
+	\retval #UTF8_ERR_NONE              Text was converted in place.
+	\retval #UTF8_ERR_INVALID_DATA      Text is NULL.
+	\retval #UTF8_ERR_NOT_ENOUGH_SPACE  A case mapping changes the length and text was only partially converted.
+
+	\sa utf8casefold
+	\sa utf8toupperinplace
+	\sa utf8tolowerinplace
+*/
+UTF8_API size_t utf8casefoldinplace(char* text, size_t textSize, int32_t* errors);
+
+/*!
+	\brief Split a UTF-8 encoded string into segments that can be case mapped independently.
+
+	Case mapping a large buffer with #utf8toupper, #utf8tolower,
+	#utf8totitle or #utf8casefold uses a single thread. This function finds
+	the offsets where the input can be split so that each segment can be
+	converted separately, for example on a pool of worker threads.
+	Concatenating the converted segments in order results in the same output
+	as converting the entire input at once, for every case mapping and locale.
+
+	Segments are split in front of a starter that follows another starter,
+	which means no combining sequence crosses a segment. Neither of them can
+	be U+03A3 GREEK CAPITAL LETTER SIGMA, whose lowercase mapping depends on
+	the code points around it. Because the
+	titlecase mapping of a letter depends on whether it starts a word, the
+	code point before the split must not be a letter, unless the code point
+	after it is not affected by case mapping at all, like most ideographs.
+	Each segment is at least `segmentSize` bytes, except for the last one.
+
+	The offsets are written to the `offsets` array, starting with 0 for the
+	first segment. Specify NULL for the array to retrieve the amount of
+	segments. See #utf8normalizesplit for an example of converting the
+	segments in parallel.
+
+	\param[in]   input        UTF-8 encoded string.
+	\param[in]   inputSize    Size of the input in bytes.
+	\param[in]   segmentSize  Minimum size of a segment in bytes.
+	\param[out]  offsets      Output array for the offsets in bytes to the start of each segment, can be NULL.
+	\param[in]   offsetsSize  Amount of entries in the offsets array.
+	\param[out]  errors       Output for errors.
+
+	\return Amount of segments.
+
+	\retval #UTF8_ERR_NONE              No errors.
+	\retval #UTF8_ERR_INVALID_DATA      Input is NULL or segment size is 0.
+	\retval #UTF8_ERR_NOT_ENOUGH_SPACE  Offsets array could not hold all of the segments.
+
+	\sa utf8toupper
+	\sa utf8tolower
+	\sa utf8totitle
+	\sa utf8casefold
+	\sa utf8normalizesplit
+*/
+UTF8_API size_t utf8casemapsplit(const char* input, size_t inputSize, size_t segmentSize, size_t* offsets, size_t offsetsSize, int32_t* errors);
+
+/*!
+	\brief Compare two UTF-8 encoded strings without case distinction.
+
+	The result is the same as comparing the output of #utf8casefold_l for
+	both strings with memcmp, but no output is stored. Instead, both strings
+	are case folded a few code points at a time and the comparison stops at
+	the first difference. Basic Latin text is compared without consulting
+	the case folding tables at all.
+
+	Because the comparison works on the bytes of the case folded text, the
+	strings are ordered by the value of their case folded code points. Use
+	#UTF8_LOCALE_TURKISH_AND_AZERI_LATIN as the locale to fold U+0049 LATIN
+	CAPITAL LETTER I to U+0131 LATIN SMALL LETTER DOTLESS I instead of
+	U+0069 LATIN SMALL LETTER I.
+
+	Invalid sequences are compared as U+FFFD REPLACEMENT CHARACTER.
+
+	Example:
+
+	\code{.c}
+		const char* Dictionary_Find(const char** words, size_t wordCount, const char* key)
+		{
+			size_t key_size = strlen(key);
+			size_t low = 0;
+			size_t high = wordCount;
+
+			while (low < high)
+			{
+				size_t middle = low + (high - low) / 2;
+				int result = utf8casecmp(words[middle], strlen(words[middle]), key, key_size, UTF8_LOCALE_DEFAULT, NULL);
+
+				if (result == 0)
+				{
+					return words[middle];
+				}
+				else if (
+					result < 0)
+				{
+					low = middle + 1;
+				}
+				else
+				{
+					high = middle;
+				}
+			}
+
+			return NULL;
+		}
+	\endcode
+
+	\param[in]   left       UTF-8 encoded string.
+	\param[in]   leftSize   Size of the left string in bytes.
+	\param[in]   right      UTF-8 encoded string.
+	\param[in]   rightSize  Size of the right string in bytes.
+	\param[in]   locale     Locale used for case folding, see #utf8getlocale.
+	\param[out]  errors     Output for errors.
+
+	\return Less than, equal to or greater than zero when the left string is ordered before, the same as or after the right string.
+
+	\retval #UTF8_ERR_NONE            No errors.
+	\retval #UTF8_ERR_INVALID_DATA    Either string is NULL.
+	\retval #UTF8_ERR_INVALID_LOCALE  Invalid locale was specified.
+
+	\sa utf8ncasecmp
+	\sa utf8casefold_l
+*/
+UTF8_API int utf8casecmp(const char* left, size_t leftSize, const char* right, size_t rightSize, size_t locale, int32_t* errors);
+
+/*!
+	\brief Compare the start of two UTF-8 encoded strings without case distinction.
+
+	Works like #utf8casecmp, but compares at most `count` code points of the
+	case folded text. Note that case folding can change the amount of code
+	points: U+00DF LATIN SMALL LETTER SHARP S is folded to "ss", which means
+	the first code point of "\xC3\x9F" is equal to the first code point of
+	"s".
+
+	\param[in]   left       UTF-8 encoded string.
+	\param[in]   leftSize   Size of the left string in bytes.
+	\param[in]   right      UTF-8 encoded string.
+	\param[in]   rightSize  Size of the right string in bytes.
+	\param[in]   count      Maximum amount of case folded code points to compare.
+	\param[in]   locale     Locale used for case folding, see #utf8getlocale.
+	\param[out]  errors     Output for errors.
+
+	\return Less than, equal to or greater than zero when the start of the left string is ordered before, the same as or after the start of the right string.
+
+	\retval #UTF8_ERR_NONE            No errors.
+	\retval #UTF8_ERR_INVALID_DATA    Either string is NULL.
+	\retval #UTF8_ERR_INVALID_LOCALE  Invalid locale was specified.
+
+	\sa utf8casecmp
+*/
+UTF8_API int utf8ncasecmp(const char* left, size_t leftSize, const char* right, size_t rightSize, size_t count, size_t locale, int32_t* errors);
+
+/*!
+	\brief Find a UTF-8 encoded string in another without case distinction.
+
+	Searches the input for the first range of code points whose case folded
+	text is equal to the case folded needle, the same way #utf8casecmp
+	compares strings. The input is not copied or case folded as a whole.
+	Only the code points in candidate matches are case folded while the
+	input is searched.
+
+	Matches always start and end on a code point in the input. Because case
+	folding can change the length of text, the size of the match in the
+	input can be different from the size of the needle. For example,
+	"STRASSE" matches "stra\xC3\x9F" "e".
+
+	Searching is fastest when the case folded needle starts with Basic
+	Latin. In that case, input that consists of Basic Latin is skipped using
+	a table of the last position of every byte in the needle.
+
+	Example:
+
+	\code{.c}
+		size_t Log_CountMatches(const char* log, size_t logSize, const char* query, size_t querySize)
+		{
+			const char* src = log;
+			const char* src_end = log + logSize;
+			const char* match;
+			size_t match_size;
+			size_t count = 0;
+
+			while ((match = utf8casesearch(src, src_end - src, query, querySize, UTF8_LOCALE_DEFAULT, &match_size, NULL)) != NULL &&
+				match_size > 0)
+			{
+				count++;
+				src = match + match_size;
+			}
+
+			return count;
+		}
+	\endcode
+
+	\param[in]   input       UTF-8 encoded string.
+	\param[in]   inputSize   Size of the input in bytes.
+	\param[in]   needle      UTF-8 encoded string to find.
+	\param[in]   needleSize  Size of the needle in bytes.
+	\param[in]   locale      Locale used for case folding, see #utf8getlocale.
+	\param[out]  matchSize   Output for the size of the match in the input in bytes, may be NULL.
+	\param[out]  errors      Output for errors.
+
+	\return Pointer to the start of the first match in the input or NULL if the needle was not found. An empty needle matches the start of the input.
+
+	\retval #UTF8_ERR_NONE            No errors.
+	\retval #UTF8_ERR_INVALID_DATA    Either string is NULL.
+	\retval #UTF8_ERR_INVALID_LOCALE  Invalid locale was specified.
+
+	\sa utf8casecmp
+*/
+UTF8_API const char* utf8casesearch(const char* input, size_t inputSize, const char* needle, size_t needleSize, size_t locale, size_t* matchSize, int32_t* errors);
+
+/*!
+	\brief Hash a UTF-8 encoded string without case distinction.
+
+	The hash is calculated over the case folded code points of the string,
+	without storing the case folded text. Strings that are equal according
+	to #utf8casecmp with the same locale always have the same hash, which
+	means both functions can be used together as the hash and equality
+	functions of a hash table.
+
+	The hash is a 64-bit value from a fast, non-cryptographic hash function
+	and should not be used to identify untrusted input. The value is the
+	same on every platform, but can change between releases of the library.
+
+	Example:
+
+	\code{.c}
+		typedef struct {
+			const char* key;
+			size_t key_size;
+			void* value;
+		} Entry;
+
+		Entry* Table_Find(Entry* entries, size_t entryCount, const char* key, size_t keySize)
+		{
+			size_t index = (size_t)(utf8casehash(key, keySize, UTF8_LOCALE_DEFAULT, NULL) % entryCount);
+			size_t i;
+
+			for (i = 0; i < entryCount; ++i)
+			{
+				Entry* entry = &entries[(index + i) % entryCount];
+
+				if (entry->key == NULL)
+				{
+					break;
+				}
+				else if (
+					utf8casecmp(entry->key, entry->key_size, key, keySize, UTF8_LOCALE_DEFAULT, NULL) == 0)
+				{
+					return entry;
+				}
+			}
+
+			return NULL;
+		}
+	\endcode
+
+	\param[in]   input      UTF-8 encoded string.
+	\param[in]   inputSize  Size of the input in bytes.
+	\param[in]   locale     Locale used for case folding, see #utf8getlocale.
+	\param[out]  errors     Output for errors.
+
+	\return Hash of the case folded string.
+
+	\retval #UTF8_ERR_NONE            No errors.
+	\retval #UTF8_ERR_INVALID_DATA    Input is NULL.
+	\retval #UTF8_ERR_INVALID_LOCALE  Invalid locale was specified.
+
+	\sa utf8casecmp
+	\sa utf8normhash
+*/
+UTF8_API uint64_t utf8casehash(const char* input, size_t inputSize, size_t locale, int32_t* errors);
+
+/*!
+	\name Case flags
+	Flags used as input for #utf8iscased.
+	\{
+*/
+
+/*!
+	\def UTF8_CASE_UPPERCASE
+	\brief Text is unchanged by #utf8toupper.
+*/
+#define UTF8_CASE_UPPERCASE                     0x00000001
+
+/*!
+	\def UTF8_CASE_LOWERCASE
+	\brief Text is unchanged by #utf8tolower.
+*/
+#define UTF8_CASE_LOWERCASE                     0x00000002
+
+/*!
+	\def UTF8_CASE_TITLECASE
+	\brief Text is unchanged by #utf8totitle.
+*/
+#define UTF8_CASE_TITLECASE                     0x00000004
+
+/*!
+	\def UTF8_CASE_CASEFOLDED
+	\brief Text is unchanged by #utf8casefold.
+*/
+#define UTF8_CASE_CASEFOLDED                    0x00000008
+
+/*!
+	\}
+*/
+
+/*!
+	\brief Check if UTF-8 encoded text is unchanged by case mapping.
+
+	Converting text to another case and comparing it to the original is
+	expensive. This function only reads the input and looks up whether each
+	code point is changed by the requested case mappings, which makes it
+	possible to skip the conversion entirely for text that is already in the
+	right case.
+
+	Specify the case mappings to check against with a combination of
+	#UTF8_CASE_UPPERCASE, #UTF8_CASE_LOWERCASE, #UTF8_CASE_TITLECASE and
+	#UTF8_CASE_CASEFOLDED. When more than one flag is specified, the text
+	must be unchanged by every one of them. Titlecase is checked with the same
+	word boundaries as #utf8totitle.
+
+	Case mapping replaces invalid sequences with the replacement character
+	(U+FFFD), so input that cannot be decoded is never considered cased.
+
+	If the text is not cased, the offset parameter is set to the offset of
+	the first code point that would be changed. Otherwise it is set to the
+	length of the input in bytes.
+
+	Example:
+
+	\code{.c}
+		uint8_t Identifier_Store(identifier_t* identifier, const char* text)
+		{
+			size_t text_size = strlen(text);
+			size_t converted_size;
+			int32_t errors;
+
+			if (utf8iscased(text, text_size, UTF8_CASE_CASEFOLDED, NULL))
+			{
+				return Identifier_Copy(identifier, text, text_size);
+			}
+
+			converted_size = utf8casefold(text, text_size, identifier->name, sizeof(identifier->name) - 1, &errors);
+			if (errors != UTF8_ERR_NONE)
+			{
+				return 0;
+			}
+
+			identifier->name[converted_size] = 0;
+
+			return 1;
+		}
+	\endcode
+
+	\param[in]   input       UTF-8 encoded string.
+	\param[in]   inputSize   Size of the input in bytes.
+	\param[in]   flags       Case mappings to check against. Must be a combination of #UTF8_CASE_UPPERCASE, #UTF8_CASE_LOWERCASE, #UTF8_CASE_TITLECASE and #UTF8_CASE_CASEFOLDED.
+	\param[out]  offset      Offset to the first code point changed by case mapping or length of input in bytes if cased. Can be NULL.
+
+	\retval 1  Input is unchanged by the requested case mappings.
+	\retval 0  Input is changed by case mapping or the flags are invalid.
+
+	\sa utf8toupper
+	\sa utf8tolower
+	\sa utf8totitle
+	\sa utf8casefold
+*/
+UTF8_API uint8_t utf8iscased(const char* input, size_t inputSize, size_t flags, size_t* offset);
+
+/*!
+	\name Normalization flags
+	Flags used as input for #utf8normalize and the result of #utf8isnormalized.
+	\{
+*/
+
+/*!
+	\def UTF8_NORMALIZE_COMPOSE
+	\brief Normalize input to Normalization Form C (NFC).
+*/
+#define UTF8_NORMALIZE_COMPOSE                  0x00000001
+
+/*!
+	\def UTF8_NORMALIZE_DECOMPOSE
+	\brief Normalize input to Normalization Form D (NFD).
+*/
+#define UTF8_NORMALIZE_DECOMPOSE                0x00000002
+
+/*!
 	\def UTF8_NORMALIZE_COMPATIBILITY
 	\brief Change Normalization Form from NFC to NFKC or from NFD to NFKD.
 */
-#define UTF8_NORMALIZE_COMPATIBILITY            0x00000004
+#define UTF8_NORMALIZE_COMPATIBILITY            0x00000004
+
+/*!
+	\def UTF8_NORMALIZE_CASEFOLD
+	\brief Apply the NFKC_Casefold mapping before normalizing input.
+
+	Must be combined with #UTF8_NORMALIZE_COMPATIBILITY. Combining the flag
+	with #UTF8_NORMALIZE_COMPOSE results in NFKC_Casefold (NFKC_CF), which is
+	used for identifiers and search keys. Code points are case folded, mapped
+	to their compatibility decomposition and default ignorable code points are
+	removed, all in the same pass.
+*/
+#define UTF8_NORMALIZE_CASEFOLD                 0x00000008
+
+/*!
+	\def UTF8_NORMALIZE_FAST
+	\brief Use the FCD check or the FCC form instead of NFD or NFC.
+
+	Cannot be combined with #UTF8_NORMALIZE_COMPATIBILITY. Combining the flag
+	with #UTF8_NORMALIZE_DECOMPOSE checks whether text is in the "Fast C or D"
+	(FCD) form, which is much cheaper to check than NFD or NFC. Combining it
+	with #UTF8_NORMALIZE_COMPOSE results in the "Fast C Contiguous" (FCC) form,
+	where a combining mark is only composed with the code point directly
+	before it.
+
+	For more information, please review [Unicode Technical Note #5 - Canonical
+	Equivalence in Applications](http://www.unicode.org/notes/tn5/).
+*/
+#define UTF8_NORMALIZE_FAST                     0x00000010
+
+/*!
+	\def UTF8_NORMALIZE_STRIP_MARKS
+	\brief Remove nonspacing marks while decomposing input.
+
+	Code points in the #UTF8_CATEGORY_MARK_NON_SPACING category are removed
+	from the decomposition of the input, before it is composed again. This
+	folds accents and other diacritics, e.g. "Cr\xC3\xA8me Br\xC3\xBBl\xC3\xA9" is
+	normalized to "Creme Brulee". Combined with #UTF8_NORMALIZE_COMPATIBILITY
+	and #UTF8_NORMALIZE_CASEFOLD, the text is case folded in the same pass.
+
+	Only changes the text written by #utf8normalize and functions built on
+	it. The flag is ignored by #utf8isnormalized.
+*/
+#define UTF8_NORMALIZE_STRIP_MARKS              0x00000020
+
+/*!
+	\def UTF8_NORMALIZATION_RESULT_YES
+	\brief Text is stable and does not have to be normalized.
+*/
+#define UTF8_NORMALIZATION_RESULT_YES           (0)
+
+/*!
+	\def UTF8_NORMALIZATION_RESULT_MAYBE
+	\brief Text is unstable, but normalization may be skipped.
+*/
+#define UTF8_NORMALIZATION_RESULT_MAYBE         (1)
+
+/*!
+	\def UTF8_NORMALIZATION_RESULT_NO
+	\brief Text is unstable and must be normalized.
+*/
+#define UTF8_NORMALIZATION_RESULT_NO            (2)
+
+/*!
+	\}
+*/
+
+/*!
+	\brief Check if a string is stable in the specified Unicode Normalization
+	Form.
+
+	This function can be used as a preprocessing step, before attempting to
+	normalize a string. Normalization is a very expensive process, it is often
+	cheaper to first determine if the string is unstable in the requested
+	normalization form.
+
+	The result of the check will be YES if the string is stable and MAYBE or NO
+	if it is unstable. If the result is MAYBE, the string does not necessarily
+	have to be normalized.
+
+	If the result is unstable, the offset parameter is set to the offset for the
+	first unstable code point. If the string is stable, the offset is equivalent
+	to the length of the string in bytes.
+
+	You must specify the desired Unicode Normalization Form by using a
+	combination of flags:
+
+	Unicode                      | Flags
+	---------------------------- | ---------------------------------------------------------
+	Normalization Form C (NFC)   | #UTF8_NORMALIZE_COMPOSE
+	Normalization Form KC (NFKC) | #UTF8_NORMALIZE_COMPOSE + #UTF8_NORMALIZE_COMPATIBILITY
+	Normalization Form D (NFD)   | #UTF8_NORMALIZE_DECOMPOSE
+	Normalization Form KD (NFKD) | #UTF8_NORMALIZE_DECOMPOSE + #UTF8_NORMALIZE_COMPATIBILITY
+	NFKC_Casefold (NFKC_CF)      | #UTF8_NORMALIZE_COMPOSE + #UTF8_NORMALIZE_COMPATIBILITY + #UTF8_NORMALIZE_CASEFOLD
+	Fast C or D (FCD)            | #UTF8_NORMALIZE_DECOMPOSE + #UTF8_NORMALIZE_FAST
+	Fast C Contiguous (FCC)      | #UTF8_NORMALIZE_COMPOSE + #UTF8_NORMALIZE_FAST
+
+	Text in the FCD form has the same canonical ordering as its NFD form. It
+	only looks at the combining classes at the start and end of the canonical
+	decomposition of each code point, which means the check never results in
+	MAYBE. Most text is FCD and can be passed to algorithms that accept both
+	NFC and NFD without normalizing it first.
+
+	For more information, please review [Unicode Standard Annex #15 - Unicode
+	Normalization Forms](http://www.unicode.org/reports/tr15/).
+
+	Example:
+
+	\code{.c}
+		uint8_t Text_InspectComposed(const char* text)
+		{
+			const char* src = text;
+			size_t src_size = strlen(text);
+			size_t offset;
+			size_t total_offset;
+
+			if (utf8isnormalized(src, src_size, UTF8_NORMALIZE_COMPOSE, &offset) == UTF8_NORMALIZATION_RESULT_YES)
+			{
+				printf("Clean!\n");
+
+				return 1;
+			}
+
+			total_offset = offset;
+
+			do
+			{
+				const char* next;
+
+				printf("Unstable at byte %d\n", total_offset);
+
+				next = utf8seek(src, text, 1, SEEK_CUR);
+				if (next == src)
+				{
+					break;
+				}
+
+				total_offset += offset;
+
+				src = next;
+				src_size -= next - src;
+			}
+			while (utf8isnormalized(src, src_size, UTF8_NORMALIZE_COMPOSE, &offset) != UTF8_NORMALIZATION_RESULT_YES);
+
+			return 0;
+		}
+	\endcode
+
+	\param[in]   input       UTF-8 encoded string.
+	\param[in]   inputSize   Size of the input in bytes.
+	\param[in]   flags       Desired normalization form. Must be a combination of #UTF8_NORMALIZE_COMPOSE, #UTF8_NORMALIZE_DECOMPOSE, #UTF8_NORMALIZE_COMPATIBILITY, #UTF8_NORMALIZE_CASEFOLD and #UTF8_NORMALIZE_FAST.
+	\param[out]  offset      Offset to first unstable code point or length of input in bytes if stable.
+
+	\retval #UTF8_NORMALIZATION_RESULT_YES    Input is stable and does not have to be normalized.
+	\retval #UTF8_NORMALIZATION_RESULT_MAYBE  Input is unstable, but normalization may be skipped.
+	\retval #UTF8_NORMALIZATION_RESULT_NO     Input is unstable and must be normalized.
+
+	\sa utf8normalize
+*/
+UTF8_API uint8_t utf8isnormalized(const char* input, size_t inputSize, size_t flags, size_t* offset);
+
+/*!
+	\brief Normalize a string to the specified Unicode Normalization Form.
+
+	The Unicode standard defines two standards for equivalence between
+	characters: canonical and compatibility equivalence. Canonically equivalent
+	characters and sequence represent the same abstract character and must be
+	rendered with the same appearance and behavior. Compatibility equivalent
+	characters have a weaker equivalence and may be rendered differently.
+
+	Unicode Normalization Forms are formally defined standards that can be used
+	to test whether any two strings of characters are equivalent to each other.
+	This equivalence may be canonical or compatibility.
+
+	The algorithm puts all combining marks into a specified order and uses the
+	rules for decomposition and composition to transform the string into one of
+	four Unicode Normalization Forms. A binary comparison can then be used to
+	determine equivalence.
+
+	These are the Unicode Normalization Forms:
+
+	Form                         | Description
+	---------------------------- | ---------------------------------------------
+	Normalization Form D (NFD)   | Canonical decomposition
+	Normalization Form C (NFC)   | Canonical decomposition, followed by canonical composition
+	Normalization Form KD (NFKD) | Compatibility decomposition
+	Normalization Form KC (NFKC) | Compatibility decomposition, followed by canonical composition
+
+	`utf8normalize` can be used to transform text into one of these forms. You
+	must specify the desired Unicode Normalization Form by using a combination
+	of flags:
+
+	Form                          | Flags
+	----------------------------- | ---------------------------------------------------------
+	Normalization Form D (NFD)    | #UTF8_NORMALIZE_DECOMPOSE
+	Normalization Form C (NFC)    | #UTF8_NORMALIZE_COMPOSE
+	Normalization Form KD (NFKD)  | #UTF8_NORMALIZE_DECOMPOSE + #UTF8_NORMALIZE_COMPATIBILITY
+	Normalization Form KC (NFKC)  | #UTF8_NORMALIZE_COMPOSE + #UTF8_NORMALIZE_COMPATIBILITY
+	NFKC_Casefold (NFKC_CF)       | #UTF8_NORMALIZE_COMPOSE + #UTF8_NORMALIZE_COMPATIBILITY + #UTF8_NORMALIZE_CASEFOLD
+	Fast C Contiguous (FCC)       | #UTF8_NORMALIZE_COMPOSE + #UTF8_NORMALIZE_FAST
+
+	NFKC_Casefold replaces chaining #utf8normalize and #utf8casefold to build
+	identifiers and search keys. It is computed in a single pass without
+	intermediate buffers.
+
+	FCC is equal to NFC, except that combining marks are only composed with
+	the code point directly before them. The result is always in the FCD form.
+	Using #UTF8_NORMALIZE_FAST with #UTF8_NORMALIZE_DECOMPOSE results in NFD,
+	which is FCD as well.
+
+	Any of these forms can be combined with #UTF8_NORMALIZE_STRIP_MARKS to
+	remove accents and other nonspacing marks from the decomposed text. To
+	build accent and case insensitive search keys, specify
+	#UTF8_NORMALIZE_COMPOSE, #UTF8_NORMALIZE_COMPATIBILITY,
+	#UTF8_NORMALIZE_CASEFOLD and #UTF8_NORMALIZE_STRIP_MARKS. This is done in
+	a single pass instead of decomposing, filtering the marks and composing
+	the text again in separate buffers.
+
+	For more information, please review [Unicode Standard Annex #15 - Unicode
+	Normalization Forms](http://www.unicode.org/reports/tr15/).
+
+	\note Unnormalized text is rare in the wild. As an example, *all* text
+	found on the Internet as HTML source code must be encoded as NFC, as
+	specified by the W3C.
+
+	Example:
+
+	\code{.c}
+		void Font_RenderTextNormalized(const char* input)
+		{
+			const char* src = NULL;
+			const char* src_start;
+			size_t src_size;
+			char* converted = NULL;
+			size_t converted_size = 0;
+			size_t input_size = strlen(input);
+
+			if (utf8isnormalized(input, input_size, UTF8_NORMALIZE_COMPOSE, NULL) != UTF8_NORMALIZATION_RESULT_YES)
+			{
+				int32_t errors;
+
+				converted_size = utf8normalize(input, input_size, NULL, 0, UTF8_NORMALIZE_COMPOSE, &errors);
+				if (converted_size > 0 &&
+					errors == UTF8_ERR_NONE)
+				{
+					converted = (char*)malloc(converted_size + 1);
+					utf8normalize(input, input_size, converted, converted_size, UTF8_NORMALIZE_COMPOSE, NULL);
+					converted[converted_size] = 0;
+
+					src = (const char*)converted;
+					src_size = converted_size;
+				}
+			}
+
+			if (src == NULL)
+			{
+				src = (const char*)input;
+				src_size = input_size;
+			}
+
+			src_start = src;
+
+			while (src_size > 0)
+			{
+				const char* next;
+				int32_t errors;
+
+				next = utf8seek(src, src_size, src_start, 1, SEEK_CUR);
+				if (next == src)
+				{
+					break;
+				}
+
+				unicode_t code_point;
+				utf8toutf32(src, (size_t)(next - src), &code_point, sizeof(unicode_t), &errors);
+				if (errors != UTF8_ERR_NONE)
+				{
+					break;
+				}
+
+				Font_RenderCodePoint(code_point);
+
+				src_size -= next - src;
+				src = next;
+			}
+
+			if (converted != NULL)
+			{
+				free(converted);
+				converted = NULL;
+			}
+		}
+	\endcode
+
+	\param[in]   input       UTF-8 encoded string.
+	\param[in]   inputSize   Size of the input in bytes.
+	\param[out]  target      Output buffer for the result, can be NULL.
+	\param[in]   targetSize  Size of the output buffer in bytes.
+	\param[in]   flags       Desired normalization form. Must be a combination of #UTF8_NORMALIZE_COMPOSE, #UTF8_NORMALIZE_DECOMPOSE, #UTF8_NORMALIZE_COMPATIBILITY, #UTF8_NORMALIZE_CASEFOLD, #UTF8_NORMALIZE_FAST and #UTF8_NORMALIZE_STRIP_MARKS.
+	\param[out]  errors      Output for errors.
+
+	\return Amount of bytes needed for storing output.
+
+	\retval #UTF8_ERR_NONE                    No errors.
+	\retval #UTF8_ERR_INVALID_FLAG            Invalid combination of flags was specified.
+	\retval #UTF8_ERR_INVALID_DATA            Failed to decode data.
+	\retval #UTF8_ERR_OVERLAPPING_PARAMETERS  Input and output buffers overlap in memory.
+	\retval #UTF8_ERR_NOT_ENOUGH_SPACE        Target buffer size is insufficient for result.
+
+	\sa utf8isnormalized
+	\sa utf8normalizeedit
+*/
+UTF8_API size_t utf8normalize(const char* input, size_t inputSize, char* target, size_t targetSize, size_t flags, int32_t* errors);
 
 /*!
-	\def UTF8_NORMALIZATION_RESULT_YES
-	\brief Text is stable and does not have to be normalized.
+	\brief Normalize only the part of a string affected by an edit.
+
+	Normalizing a large document after every change is wasteful, because an
+	edit can only affect the code points surrounding it. This function takes a
+	string that is already in the specified Unicode Normalization Form, except
+	for the edited range, and normalizes only the smallest window that
+	contains the edit.
+
+	The window starts and ends on stable code points: starters with a quick
+	check value of YES for the requested Normalization Form, or starters that
+	decompose to such a code point. These code points can never interact with
+	the code points before them, which means the text outside the window is
+	unaffected by normalization.
+
+	The output is a splice: the caller should replace `replaceSize` bytes at
+	`replaceOffset` in the input with the contents of the output buffer.
+
+	Concatenating two normalized strings is a special case of an edit. Store
+	the strings next to each other and specify an empty range at the point
+	where they meet. Only the code points around the seam are normalized.
+
+	\note The window is always aligned on the start of a code point, even if
+	the edited range starts or ends in the middle of an encoded sequence.
+
+	Example:
+
+	\code{.c}
+		uint8_t Document_Insert(document_t* document, size_t offset, const char* text, size_t textSize)
+		{
+			char* window = NULL;
+			size_t window_size;
+			size_t replace_offset;
+			size_t replace_size;
+			uint8_t result;
+			int32_t errors;
+
+			if (!Document_InsertBytes(document, offset, text, textSize))
+			{
+				return 0;
+			}
+
+			window_size = utf8normalizeedit(
+				document->text, document->size,
+				offset, textSize,
+				NULL, 0,
+				UTF8_NORMALIZE_COMPOSE,
+				&replace_offset, &replace_size,
+				&errors);
+			if (errors != UTF8_ERR_NONE)
+			{
+				return 0;
+			}
+
+			if (window_size > 0)
+			{
+				window = (char*)malloc(window_size);
+				utf8normalizeedit(
+					document->text, document->size,
+					offset, textSize,
+					window, window_size,
+					UTF8_NORMALIZE_COMPOSE,
+					NULL, NULL,
+					NULL);
+			}
+
+			result = Document_ReplaceBytes(document, replace_offset, replace_size, window, window_size);
+
+			if (window != NULL)
+			{
+				free(window);
+				window = NULL;
+			}
+
+			return result;
+		}
+	\endcode
+
+	\param[in]   input          UTF-8 encoded string.
+	\param[in]   inputSize      Size of the input in bytes.
+	\param[in]   editOffset     Offset in bytes to the start of the edited range.
+	\param[in]   editSize       Size in bytes of the edited range, can be 0. Ranges extending past the end of the input are clamped to it.
+	\param[out]  target         Output buffer for the result, can be NULL.
+	\param[in]   targetSize     Size of the output buffer in bytes.
+	\param[in]   flags          Normalization form of the input. Must be a combination of #UTF8_NORMALIZE_COMPOSE, #UTF8_NORMALIZE_DECOMPOSE, #UTF8_NORMALIZE_COMPATIBILITY, #UTF8_NORMALIZE_CASEFOLD and #UTF8_NORMALIZE_FAST.
+	\param[out]  replaceOffset  Offset in bytes to the start of the range in the input that should be replaced, can be NULL.
+	\param[out]  replaceSize    Size in bytes of the range in the input that should be replaced, can be NULL.
+	\param[out]  errors         Output for errors.
+
+	\return Amount of bytes needed for storing output.
+
+	\retval #UTF8_ERR_NONE                    No errors.
+	\retval #UTF8_ERR_INVALID_FLAG            Invalid combination of flags was specified.
+	\retval #UTF8_ERR_INVALID_DATA            Failed to decode data or edit offset is past the end of input.
+	\retval #UTF8_ERR_OVERLAPPING_PARAMETERS  Input and output buffers overlap in memory.
+	\retval #UTF8_ERR_NOT_ENOUGH_SPACE        Target buffer size is insufficient for result.
+
+	\sa utf8normalize
+	\sa utf8isnormalized
 */
-#define UTF8_NORMALIZATION_RESULT_YES           (0)
+UTF8_API size_t utf8normalizeedit(const char* input, size_t inputSize, size_t editOffset, size_t editSize, char* target, size_t targetSize, size_t flags, size_t* replaceOffset, size_t* replaceSize, int32_t* errors);
 
 /*!
-	\def UTF8_NORMALIZATION_RESULT_MAYBE
-	\brief Text is unstable, but normalization may be skipped.
+	\brief Size in bytes of the segment buffered by a #utf8normalizer_t.
+
+	Input is normalized in segments that end on a stable code point. Runs of
+	unstable code points longer than this size are normalized in parts.
 */
-#define UTF8_NORMALIZATION_RESULT_MAYBE         (1)
+#define UTF8_NORMALIZER_SEGMENT_SIZE            128
 
 /*!
-	\def UTF8_NORMALIZATION_RESULT_NO
-	\brief Text is unstable and must be normalized.
+	\brief State of a streaming normalizer.
+
+	The members of this struct are private and should only be modified by
+	calling #utf8normalizerinit, #utf8normalizerwrite and
+	#utf8normalizerflush.
+
+	The output buffer is large enough to store the normalized version of a
+	full segment. The largest expansion is found in U+FDFA ARABIC LIGATURE
+	SALLALLAHOU ALAYHE WASALLAM, which is 3 bytes encoded and 33 bytes when
+	decomposed.
 */
-#define UTF8_NORMALIZATION_RESULT_NO            (2)
+typedef struct {
+	size_t flags;
+	size_t input_size;
+	size_t output_offset;
+	size_t output_size;
+	char input[UTF8_NORMALIZER_SEGMENT_SIZE];
+	char output[UTF8_NORMALIZER_SEGMENT_SIZE * 12];
+} utf8normalizer_t;
 
 /*!
-	\}
+	\brief Initialize a streaming normalizer.
+
+	Streaming normalization can be used when the input is not available in one
+	contiguous buffer, for example when reading a large file or a socket. The
+	normalizer does not allocate memory on the heap; its memory usage is
+	constant regardless of the size of the input.
+
+	A normalizer can be reused after flushing it with #utf8normalizerflush.
+
+	\param[out]  normalizer  Normalizer to initialize.
+	\param[in]   flags       Desired normalization form. Must be a combination of #UTF8_NORMALIZE_COMPOSE, #UTF8_NORMALIZE_DECOMPOSE, #UTF8_NORMALIZE_COMPATIBILITY, #UTF8_NORMALIZE_CASEFOLD, #UTF8_NORMALIZE_FAST and #UTF8_NORMALIZE_STRIP_MARKS.
+	\param[out]  errors      Output for errors.
+
+	\return 1 on success, 0 on failure.
+
+	\retval #UTF8_ERR_NONE          No errors.
+	\retval #UTF8_ERR_INVALID_FLAG  Invalid combination of flags was specified.
+	\retval #UTF8_ERR_INVALID_DATA  Normalizer is NULL.
+
+	\sa utf8normalizerwrite
+	\sa utf8normalizerflush
 */
+UTF8_API uint8_t utf8normalizerinit(utf8normalizer_t* normalizer, size_t flags, int32_t* errors);
 
 /*!
-	\brief Check if a string is stable in the specified Unicode Normalization
-	Form.
+	\brief Normalize a chunk of a UTF-8 encoded stream.
 
-	This function can be used as a preprocessing step, before attempting to
-	normalize a string. Normalization is a very expensive process, it is often
-	cheaper to first determine if the string is unstable in the requested
-	normalization form.
+	Chunks can be of any size and can split an encoded sequence or a sequence
+	of combining code points. Code points that could still be affected by the
+	next chunk are kept in the normalizer until more input is written or the
+	normalizer is flushed.
 
-	The result of the check will be YES if the string is stable and MAYBE or NO
-	if it is unstable. If the result is MAYBE, the string does not necessarily
-	have to be normalized.
+	Output is written until the target buffer is full, even if this splits an
+	encoded sequence. When the target buffer cannot hold all of the output,
+	the function stops reading input and sets #UTF8_ERR_NOT_ENOUGH_SPACE. The
+	remaining output is written on the next call, so the caller should keep
+	calling the function with the rest of the input.
 
-	If the result is unstable, the offset parameter is set to the offset for the
-	first unstable code point. If the string is stable, the offset is equivalent
-	to the length of the string in bytes.
+	The result is the same as calling #utf8normalize on the entire stream,
+	unless the stream contains runs of unstable code points longer than
+	#UTF8_NORMALIZER_SEGMENT_SIZE bytes.
 
-	You must specify the desired Unicode Normalization Form by using a
-	combination of flags:
+	Example:
 
-	Unicode                      | Flags
-	---------------------------- | ---------------------------------------------------------
-	Normalization Form C (NFC)   | #UTF8_NORMALIZE_COMPOSE
-	Normalization Form KC (NFKC) | #UTF8_NORMALIZE_COMPOSE + #UTF8_NORMALIZE_COMPATIBILITY
-	Normalization Form D (NFD)   | #UTF8_NORMALIZE_DECOMPOSE
-	Normalization Form KD (NFKD) | #UTF8_NORMALIZE_DECOMPOSE + #UTF8_NORMALIZE_COMPATIBILITY
+	\code{.c}
+		uint8_t Stream_Normalize(FILE* input, FILE* output)
+		{
+			utf8normalizer_t normalizer;
+			char read_buffer[4096];
+			char write_buffer[4096];
+			size_t read_size;
+			size_t written;
+			int32_t errors;
 
-	For more information, please review [Unicode Standard Annex #15 - Unicode
-	Normalization Forms](http://www.unicode.org/reports/tr15/).
+			if (!utf8normalizerinit(&normalizer, UTF8_NORMALIZE_COMPOSE, &errors))
+			{
+				return 0;
+			}
+
+			while ((read_size = fread(read_buffer, 1, sizeof(read_buffer), input)) > 0)
+			{
+				const char* src = read_buffer;
+				size_t src_size = read_size;
+
+				while (src_size > 0)
+				{
+					size_t consumed;
+
+					written = utf8normalizerwrite(&normalizer, src, src_size, write_buffer, sizeof(write_buffer), &consumed, &errors);
+					fwrite(write_buffer, 1, written, output);
+
+					src += consumed;
+					src_size -= consumed;
+				}
+			}
+
+			do
+			{
+				written = utf8normalizerflush(&normalizer, write_buffer, sizeof(write_buffer), &errors);
+				fwrite(write_buffer, 1, written, output);
+			}
+			while (errors == UTF8_ERR_NOT_ENOUGH_SPACE);
+
+			return 1;
+		}
+	\endcode
+
+	\param[in]   normalizer     Normalizer initialized with #utf8normalizerinit.
+	\param[in]   input          UTF-8 encoded chunk, can be NULL if inputSize is 0.
+	\param[in]   inputSize      Size of the chunk in bytes.
+	\param[out]  target         Output buffer for the result.
+	\param[in]   targetSize     Size of the output buffer in bytes.
+	\param[out]  inputConsumed  Amount of bytes read from the chunk, can be NULL.
+	\param[out]  errors         Output for errors.
+
+	\return Amount of bytes written to the output buffer.
+
+	\retval #UTF8_ERR_NONE                    No errors.
+	\retval #UTF8_ERR_INVALID_FLAG            Normalizer was not initialized.
+	\retval #UTF8_ERR_INVALID_DATA            Normalizer or output buffer is NULL.
+	\retval #UTF8_ERR_OVERLAPPING_PARAMETERS  Input and output buffers overlap in memory.
+	\retval #UTF8_ERR_NOT_ENOUGH_SPACE        Target buffer could not hold all of the output, call again to continue.
+
+	\sa utf8normalizerinit
+	\sa utf8normalizerflush
+	\sa utf8normalize
+*/
+UTF8_API size_t utf8normalizerwrite(utf8normalizer_t* normalizer, const char* input, size_t inputSize, char* target, size_t targetSize, size_t* inputConsumed, int32_t* errors);
+
+/*!
+	\brief Write the remaining output of a streaming normalizer.
+
+	Should be called after the last chunk was written. Code points kept in
+	the normalizer are normalized and written to the output buffer. An
+	incomplete encoded sequence at the end of the stream is written as
+	U+FFFD REPLACEMENT CHARACTER.
+
+	The function sets #UTF8_ERR_NOT_ENOUGH_SPACE when the output buffer could
+	not hold all of the output. The caller should then call it again. After a
+	successful flush, the normalizer can be used for a new stream.
+
+	\param[in]   normalizer  Normalizer initialized with #utf8normalizerinit.
+	\param[out]  target      Output buffer for the result.
+	\param[in]   targetSize  Size of the output buffer in bytes.
+	\param[out]  errors      Output for errors.
+
+	\return Amount of bytes written to the output buffer.
+
+	\retval #UTF8_ERR_NONE              No errors.
+	\retval #UTF8_ERR_INVALID_FLAG      Normalizer was not initialized.
+	\retval #UTF8_ERR_INVALID_DATA      Normalizer or output buffer is NULL.
+	\retval #UTF8_ERR_NOT_ENOUGH_SPACE  Target buffer could not hold all of the output, call again to continue.
+
+	\sa utf8normalizerinit
+	\sa utf8normalizerwrite
+*/
+UTF8_API size_t utf8normalizerflush(utf8normalizer_t* normalizer, char* target, size_t targetSize, int32_t* errors);
+
+/*!
+	\brief Split a UTF-8 encoded string into segments that can be normalized independently.
+
+	Normalizing a large buffer with #utf8normalize uses a single thread. This
+	function finds the offsets where the input can be split so that each
+	segment can be normalized separately, for example on a pool of worker
+	threads. Concatenating the normalized segments in order results in the
+	same output as normalizing the entire input at once.
+
+	Segments are split in front of stable code points: starters with a quick
+	check value of YES for the requested Normalization Form, or starters that
+	decompose to such a code point. Each segment is at least `segmentSize`
+	bytes, except for the last one. A segment can be much larger when the
+	input has no stable code points for a long stretch.
+
+	The offsets are written to the `offsets` array, starting with 0 for the
+	first segment. Specify NULL for the array to retrieve the amount of
+	segments.
+
+	Because normalization can change the length of a segment, the output
+	positions should be determined beforehand. First retrieve the size of
+	each normalized segment, then use a running total of those sizes to find
+	where each segment starts in the output buffer.
 
 	Example:
 
 	\code{.c}
-		uint8_t Text_InspectComposed(const char* text)
+		char* Normalize_Parallel(const char* input, size_t inputSize, size_t flags, size_t* outputSize)
 		{
-			const char* src = text;
-			size_t src_size = strlen(text);
-			size_t offset;
-			size_t total_offset;
+			char* output = NULL;
+			size_t* offsets = NULL;
+			size_t* positions = NULL;
+			size_t segment_count;
+			int32_t errors;
+			long i;
 
-			if (utf8isnormalized(src, src_size, UTF8_NORMALIZE_COMPOSE, &offset) == UTF8_NORMALIZATION_RESULT_YES)
+			segment_count = utf8normalizesplit(input, inputSize, 1024 * 1024, NULL, 0, flags, &errors);
+			if (segment_count == 0 ||
+				errors != UTF8_ERR_NONE)
 			{
-				printf("Clean!\n");
-
-				return 1;
+				return NULL;
 			}
 
-			total_offset = offset;
+			offsets = (size_t*)malloc((segment_count + 1) * sizeof(size_t));
+			positions = (size_t*)malloc((segment_count + 1) * sizeof(size_t));
 
-			do
-			{
-				const char* next;
+			utf8normalizesplit(input, inputSize, 1024 * 1024, offsets, segment_count, flags, NULL);
+			offsets[segment_count] = inputSize;
 
-				printf("Unstable at byte %d\n", total_offset);
+			#pragma omp parallel for
+			for (i = 0; i < (long)segment_count; ++i)
+			{
+				positions[i + 1] = utf8normalize(input + offsets[i], offsets[i + 1] - offsets[i], NULL, 0, flags, NULL);
+			}
 
-				next = utf8seek(src, text, 1, SEEK_CUR);
-				if (next == src)
-				{
-					break;
-				}
+			positions[0] = 0;
+			for (i = 0; i < (long)segment_count; ++i)
+			{
+				positions[i + 1] += positions[i];
+			}
 
-				total_offset += offset;
+			*outputSize = positions[segment_count];
+			output = (char*)malloc(*outputSize);
 
-				src = next;
-				src_size -= next - src;
+			#pragma omp parallel for
+			for (i = 0; i < (long)segment_count; ++i)
+			{
+				utf8normalize(
+					input + offsets[i], offsets[i + 1] - offsets[i],
+					output + positions[i], positions[i + 1] - positions[i],
+					flags, NULL);
 			}
-			while (utf8isnormalized(src, src_size, UTF8_NORMALIZE_COMPOSE, &offset) != UTF8_NORMALIZATION_RESULT_YES);
 
-			return 0;
+			free(offsets);
+			free(positions);
+
+			return output;
 		}
 	\endcode
 
-	\param[in]   input       UTF-8 encoded string.
-	\param[in]   inputSize   Size of the input in bytes.
-	\param[in]   flags       Desired normalization form. Must be a combination of #UTF8_NORMALIZE_COMPOSE, #UTF8_NORMALIZE_DECOMPOSE and #UTF8_NORMALIZE_COMPATIBILITY.
-	\param[out]  offset      Offset to first unstable code point or length of input in bytes if stable.
+	\param[in]   input        UTF-8 encoded string.
+	\param[in]   inputSize    Size of the input in bytes.
+	\param[in]   segmentSize  Minimum size of a segment in bytes.
+	\param[out]  offsets      Output array for the offsets in bytes to the start of each segment, can be NULL.
+	\param[in]   offsetsSize  Amount of entries in the offsets array.
+	\param[in]   flags        Requested normalization. Must be a combination of #UTF8_NORMALIZE_COMPOSE, #UTF8_NORMALIZE_DECOMPOSE, #UTF8_NORMALIZE_COMPATIBILITY, #UTF8_NORMALIZE_CASEFOLD and #UTF8_NORMALIZE_FAST.
+	\param[out]  errors       Output for errors.
 
-	\retval #UTF8_NORMALIZATION_RESULT_YES    Input is stable and does not have to be normalized.
-	\retval #UTF8_NORMALIZATION_RESULT_MAYBE  Input is unstable, but normalization may be skipped.
-	\retval #UTF8_NORMALIZATION_RESULT_NO     Input is unstable and must be normalized.
+	\return Amount of segments.
+
+	\retval #UTF8_ERR_NONE              No errors.
+	\retval #UTF8_ERR_INVALID_FLAG      Invalid combination of flags was specified.
+	\retval #UTF8_ERR_INVALID_DATA      Input is NULL or segment size is 0.
+	\retval #UTF8_ERR_NOT_ENOUGH_SPACE  Offsets array could not hold all of the segments.
 
 	\sa utf8normalize
 */
-UTF8_API uint8_t utf8isnormalized(const char* input, size_t inputSize, size_t flags, size_t* offset);
+UTF8_API size_t utf8normalizesplit(const char* input, size_t inputSize, size_t segmentSize, size_t* offsets, size_t offsetsSize, size_t flags, int32_t* errors);
 
 /*!
-	\brief Normalize a string to the specified Unicode Normalization Form.
+	\brief Compare two UTF-8 encoded strings for canonical equivalence.
 
-	The Unicode standard defines two standards for equivalence between
-	characters: canonical and compatibility equivalence. Canonically equivalent
-	characters and sequence represent the same abstract character and must be
-	rendered with the same appearance and behavior. Compatibility equivalent
-	characters have a weaker equivalence and may be rendered differently.
+	Two strings are canonically equivalent when their Normalization Form D
+	(NFD) is the same. This function gives the same result as normalizing
+	both strings with #utf8normalize and comparing the output with memcmp,
+	but without storing the normalized text.
 
-	Unicode Normalization Forms are formally defined standards that can be used
-	to test whether any two strings of characters are equivalent to each other.
-	This equivalence may be canonical or compatibility.
+	Bytes that are identical at the start of both strings are skipped
+	without decomposing them. From the last stable code point before the
+	first difference, both strings are decomposed one sequence at a time and
+	the comparison stops at the first code point that differs.
 
-	The algorithm puts all combining marks into a specified order and uses the
-	rules for decomposition and composition to transform the string into one of
-	four Unicode Normalization Forms. A binary comparison can then be used to
-	determine equivalence.
+	The strings are ordered by the value of their decomposed code points.
+	Specify #UTF8_NORMALIZE_COMPATIBILITY to compare the compatibility
+	decomposition (NFKD) instead, optionally with #UTF8_NORMALIZE_CASEFOLD
+	to compare NFKC_Casefold mappings.
 
-	These are the Unicode Normalization Forms:
+	Example:
 
-	Form                         | Description
-	---------------------------- | ---------------------------------------------
-	Normalization Form D (NFD)   | Canonical decomposition
-	Normalization Form C (NFC)   | Canonical decomposition, followed by canonical composition
-	Normalization Form KD (NFKD) | Compatibility decomposition
-	Normalization Form KC (NFKC) | Compatibility decomposition, followed by canonical composition
+	\code{.c}
+		uint8_t Font_HasGlyphName(const char** names, size_t nameCount, const char* name)
+		{
+			size_t name_size = strlen(name);
+			size_t i;
 
-	`utf8normalize` can be used to transform text into one of these forms. You
-	must specify the desired Unicode Normalization Form by using a combination
-	of flags:
+			for (i = 0; i < nameCount; ++i)
+			{
+				if (utf8normcmp(names[i], strlen(names[i]), name, name_size, 0, NULL) == 0)
+				{
+					return 1;
+				}
+			}
 
-	Form                          | Flags
-	----------------------------- | ---------------------------------------------------------
-	Normalization Form D (NFD)    | #UTF8_NORMALIZE_DECOMPOSE
-	Normalization Form C (NFC)    | #UTF8_NORMALIZE_COMPOSE
-	Normalization Form KD (NFKD)  | #UTF8_NORMALIZE_DECOMPOSE + #UTF8_NORMALIZE_COMPATIBILITY
-	Normalization Form KC (NFKC)  | #UTF8_NORMALIZE_COMPOSE + #UTF8_NORMALIZE_COMPATIBILITY
+			return 0;
+		}
+	\endcode
 
-	For more information, please review [Unicode Standard Annex #15 - Unicode
-	Normalization Forms](http://www.unicode.org/reports/tr15/).
+	\param[in]   left       UTF-8 encoded string.
+	\param[in]   leftSize   Size of the left string in bytes.
+	\param[in]   right      UTF-8 encoded string.
+	\param[in]   rightSize  Size of the right string in bytes.
+	\param[in]   flags      Either 0 for canonical equivalence or #UTF8_NORMALIZE_COMPATIBILITY, optionally with #UTF8_NORMALIZE_CASEFOLD.
+	\param[out]  errors     Output for errors.
 
-	\note Unnormalized text is rare in the wild. As an example, *all* text
-	found on the Internet as HTML source code must be encoded as NFC, as
-	specified by the W3C.
+	\return Less than, equal to or greater than zero when the left string is ordered before, the same as or after the right string.
 
-	Example:
+	\retval #UTF8_ERR_NONE          No errors.
+	\retval #UTF8_ERR_INVALID_FLAG  Invalid combination of flags was specified.
+	\retval #UTF8_ERR_INVALID_DATA  Either string is NULL.
 
-	\code{.c}
-		void Font_RenderTextNormalized(const char* input)
-		{
-			const char* src = NULL;
-			const char* src_start;
-			size_t src_size;
-			char* converted = NULL;
-			size_t converted_size = 0;
-			size_t input_size = strlen(input);
+	\sa utf8normalize
+	\sa utf8isnormalized
+	\sa utf8normhash
+*/
+UTF8_API int utf8normcmp(const char* left, size_t leftSize, const char* right, size_t rightSize, size_t flags, int32_t* errors);
 
-			if (utf8isnormalized(input, input_size, UTF8_NORMALIZE_COMPOSE, NULL) != UTF8_NORMALIZATION_RESULT_YES)
-			{
-				int32_t errors;
+/*!
+	\brief Hash a UTF-8 encoded string by its decomposition.
 
-				converted_size = utf8normalize(input, input_size, NULL, 0, UTF8_NORMALIZE_COMPOSE, &errors);
-				if (converted_size > 0 &&
-					errors == UTF8_ERR_NONE)
-				{
-					converted = (char*)malloc(converted_size + 1);
-					utf8normalize(input, input_size, converted, converted_size, UTF8_NORMALIZE_COMPOSE, NULL);
-					converted[converted_size] = 0;
+	The hash is calculated over the code points of the Normalization Form D
+	(NFD) of the string, without storing the normalized text. Strings that
+	are equal according to #utf8normcmp with the same flags always have the
+	same hash, which means both functions can be used together as the hash
+	and equality functions of a hash table.
 
-					src = (const char*)converted;
-					src_size = converted_size;
-				}
-			}
+	Specify #UTF8_NORMALIZE_COMPATIBILITY to hash the compatibility
+	decomposition (NFKD) instead, optionally with #UTF8_NORMALIZE_CASEFOLD
+	to hash NFKC_Casefold mappings.
 
-			if (src == NULL)
-			{
-				src = (const char*)input;
-				src_size = input_size;
-			}
+	The hash is a 64-bit value from a fast, non-cryptographic hash function
+	and should not be used to identify untrusted input. The value is the
+	same on every platform, but can change between releases of the library.
 
-			src_start = src;
+	\param[in]   input      UTF-8 encoded string.
+	\param[in]   inputSize  Size of the input in bytes.
+	\param[in]   flags      Either 0 for canonical equivalence or #UTF8_NORMALIZE_COMPATIBILITY, optionally with #UTF8_NORMALIZE_CASEFOLD.
+	\param[out]  errors     Output for errors.
 
-			while (src_size > 0)
-			{
-				const char* next;
-				int32_t errors;
+	\return Hash of the decomposed string.
 
-				next = utf8seek(src, src_size, src_start, 1, SEEK_CUR);
-				if (next == src)
-				{
-					break;
-				}
+	\retval #UTF8_ERR_NONE          No errors.
+	\retval #UTF8_ERR_INVALID_FLAG  Invalid combination of flags was specified.
+	\retval #UTF8_ERR_INVALID_DATA  Input is NULL.
 
-				unicode_t code_point;
-				utf8toutf32(src, (size_t)(next - src), &code_point, sizeof(unicode_t), &errors);
-				if (errors != UTF8_ERR_NONE)
-				{
-					break;
-				}
+	\sa utf8normcmp
+	\sa utf8casehash
+*/
+UTF8_API uint64_t utf8normhash(const char* input, size_t inputSize, size_t flags, int32_t* errors);
 
-				Font_RenderCodePoint(code_point);
+/*!
+	\brief Find a UTF-8 encoded string in another by canonical equivalence.
 
-				src_size -= next - src;
-				src = next;
-			}
+	Searches the input for the first range of code points whose Normalization
+	Form D (NFD) is the same as the NFD of the needle, the same way
+	#utf8normcmp compares strings. This means text in NFC can be found with
+	a needle in NFD and the other way around, without normalizing the input
+	first.
 
-			if (converted != NULL)
+	The needle is decomposed once before searching. The input is only
+	decomposed where a match could start: Basic Latin is skipped without
+	decoding it and code points that are not changed by decomposition are
+	compared directly.
+
+	Matches always start and end on a stable code point in the input, where
+	normalization could split the text. A needle never matches part of a
+	decomposed code point or part of a sequence of combining marks. For
+	example, "e" is not found in "\xC3\xA9", but "e\xCC\x81" is.
+
+	Specify #UTF8_NORMALIZE_COMPATIBILITY to compare the compatibility
+	decomposition (NFKD) instead, optionally with #UTF8_NORMALIZE_CASEFOLD
+	to compare NFKC_Casefold mappings.
+
+	Example:
+
+	\code{.c}
+		const char* Document_FindText(const char* document, size_t documentSize, const char* query, size_t* length)
+		{
+			int32_t errors;
+
+			const char* found = utf8normsearch(document, documentSize, query, strlen(query), UTF8_NORMALIZE_COMPATIBILITY | UTF8_NORMALIZE_CASEFOLD, length, &errors);
+			if (errors != UTF8_ERR_NONE)
 			{
-				free(converted);
-				converted = NULL;
+				return NULL;
 			}
+
+			return found;
 		}
 	\endcode
 
 	\param[in]   input       UTF-8 encoded string.
 	\param[in]   inputSize   Size of the input in bytes.
-	\param[out]  target      Output buffer for the result, can be NULL.
-	\param[in]   targetSize  Size of the output buffer in bytes.
-	\param[in]   flags       Desired normalization form. Must be a combination of #UTF8_NORMALIZE_COMPOSE, #UTF8_NORMALIZE_DECOMPOSE and #UTF8_NORMALIZE_COMPATIBILITY.
+	\param[in]   needle      UTF-8 encoded string to find.
+	\param[in]   needleSize  Size of the needle in bytes.
+	\param[in]   flags       Either 0 for canonical equivalence or #UTF8_NORMALIZE_COMPATIBILITY, optionally with #UTF8_NORMALIZE_CASEFOLD.
+	\param[out]  matchSize   Output for the size of the match in the input in bytes, may be NULL.
 	\param[out]  errors      Output for errors.
 
-	\return Amount of bytes needed for storing output.
+	\return Pointer to the start of the first match in the input or NULL if the needle was not found. An empty needle matches the start of the input.
 
-	\retval #UTF8_ERR_NONE                    No errors.
-	\retval #UTF8_ERR_INVALID_FLAG            Invalid combination of flags was specified.
-	\retval #UTF8_ERR_INVALID_DATA            Failed to decode data.
-	\retval #UTF8_ERR_OVERLAPPING_PARAMETERS  Input and output buffers overlap in memory.
-	\retval #UTF8_ERR_NOT_ENOUGH_SPACE        Target buffer size is insufficient for result.
+	\retval #UTF8_ERR_NONE          No errors.
+	\retval #UTF8_ERR_INVALID_FLAG  Invalid combination of flags was specified.
+	\retval #UTF8_ERR_INVALID_DATA  Either string is NULL.
 
-	\sa utf8isnormalized
+	\sa utf8normcmp
+	\sa utf8casesearch
 */
-UTF8_API size_t utf8normalize(const char* input, size_t inputSize, char* target, size_t targetSize, size_t flags, int32_t* errors);
+UTF8_API const char* utf8normsearch(const char* input, size_t inputSize, const char* needle, size_t needleSize, size_t flags, size_t* matchSize, int32_t* errors);
 
 /*!
 	\name Category flags
@@ -1727,4 +3516,243 @@ UTF8_API size_t utf8normalize(const char* input, size_t inputSize, char* target,
 */
 UTF8_API size_t utf8iscategory(const char* input, size_t inputSize, size_t flags);
 
+/*!
+	\brief Find the first code point in the input string that conforms to the
+	category specified by the flags.
+
+	This function is the complement of #utf8iscategory, similar to the way
+	`strcspn` complements `strspn`. It returns the number of bytes in the input
+	that do _not_ match the category flags.
+
+	Grapheme clusters are treated the same way as in #utf8iscategory. A code
+	point that is part of the grapheme cluster of a code point that did not
+	match, e.g. a COMBINING GRAVE ACCENT after a LATIN CAPITAL LETTER E when
+	looking for `UTF8_CATEGORY_MARK`, is skipped. Specify the
+	`UTF8_CATEGORY_IGNORE_GRAPHEME_CLUSTER` flag to match every code point on
+	its own.
+
+	Example:
+
+	\code{.c}
+		const char* Tokenizer_SkipToDigits(const char* input, size_t inputSize)
+		{
+			return input + utf8categorycspan(input, inputSize, UTF8_CATEGORY_NUMBER_DECIMAL);
+		}
+	\endcode
+
+	\param[in]   input       UTF-8 encoded string.
+	\param[in]   inputSize   Size of the input in bytes.
+	\param[in]   flags       Requested category. Must be a combination of UTF8_CATEGORY_* flags or a single UTF8_CATEGORY_IS* flag.
+
+	\return Number of bytes in the input before the first code point that conforms to the specified category flags.
+
+	\sa utf8iscategory
+	\sa utf8categoryruns
+*/
+UTF8_API size_t utf8categorycspan(const char* input, size_t inputSize, size_t flags);
+
+/*!
+	\brief A run of code points matching the same category.
+
+	Written by #utf8categoryruns. The category is the index of the first
+	entry in the list of categories that matched the code points in the run,
+	or the size of the list when none of them matched.
+*/
+typedef struct {
+	size_t offset;
+	size_t length;
+	size_t category;
+} utf8categoryrun_t;
+
+/*!
+	\brief Split the input string into runs of code points matching the same
+	category.
+
+	Classifies every code point in the input against a list of category
+	flags and writes the runs of code points that matched the same entry to
+	an array provided by the caller. This is equivalent to calling
+	#utf8iscategory with every entry in the list until one of them matches,
+	but the input is only decoded once.
+
+	A code point belongs to the first entry in the list it matches. Code
+	points that don't match any entry form runs of their own, with the size
+	of the list as the category. Grapheme clusters are treated the same way
+	as in #utf8iscategory: a code point with a non-zero canonical combining
+	class continues the current run, unless the entry for that run specifies
+	the `UTF8_CATEGORY_IGNORE_GRAPHEME_CLUSTER` flag.
+
+	Specify `NULL` for the runs to get the amount of runs in the input. If
+	the array is too small, the function returns the runs that did fit and
+	sets the error to #UTF8_ERR_NOT_ENOUGH_SPACE.
+
+	Example:
+
+	\code{.c}
+		void Lexer_Tokenize(const char* input, size_t inputSize)
+		{
+			const size_t categories[] = {
+				UTF8_CATEGORY_LETTER,
+				UTF8_CATEGORY_NUMBER,
+				UTF8_CATEGORY_ISSPACE,
+			};
+			utf8categoryrun_t runs[64];
+			size_t count;
+			size_t i;
+			int32_t errors;
+
+			count = utf8categoryruns(input, inputSize, categories, 3, runs, 64, &errors);
+
+			for (i = 0; i < count; ++i)
+			{
+				Lexer_AddToken(input + runs[i].offset, runs[i].length, runs[i].category);
+			}
+		}
+	\endcode
+
+	\param[in]   input            UTF-8 encoded string.
+	\param[in]   inputSize        Size of the input in bytes.
+	\param[in]   categories       List of category flags. Every entry must be a combination of UTF8_CATEGORY_* flags or a single UTF8_CATEGORY_IS* flag.
+	\param[in]   categoriesSize   Amount of entries in the list of categories.
+	\param[out]  runs             Output array for the runs or NULL.
+	\param[in]   runsSize         Size of the output array in runs.
+	\param[out]  errors           Output for errors.
+
+	\return Amount of runs in the input.
+
+	\retval #UTF8_ERR_NONE              The input was split into runs successfully.
+	\retval #UTF8_ERR_INVALID_DATA      Input does not point to valid memory.
+	\retval #UTF8_ERR_INVALID_FLAG      The list of categories is empty.
+	\retval #UTF8_ERR_NOT_ENOUGH_SPACE  The output array is too small for all the runs.
+
+	\sa utf8iscategory
+	\sa utf8categorycspan
+*/
+UTF8_API size_t utf8categoryruns(const char* input, size_t inputSize, const size_t* categories, size_t categoriesSize, utf8categoryrun_t* runs, size_t runsSize, int32_t* errors);
+
+/*!
+	\brief Range of code points, from first to last inclusive.
+
+	\sa utf8charsetcompile
+*/
+typedef struct {
+	unicode_t first;
+	unicode_t last;
+} utf8range_t;
+
+/*!
+	\brief Compiled set of code points.
+
+	Stores every code point in the set as a bit in a two-level table, so
+	membership can be tested with two memory reads regardless of how the set
+	was defined. The table is stored in an array provided by the caller and
+	must stay valid while the set is in use.
+
+	The members of this struct should be considered private. Use
+	#utf8charsetcompile to initialize a set.
+
+	\sa utf8charsetcontains
+	\sa utf8charsetspan
+	\sa utf8charsetcspan
+*/
+typedef struct {
+	const uint32_t* data;
+	size_t data_size;
+	uint32_t basic_latin[4];
+} utf8charset_t;
+
+/*!
+	\brief Compile category flags and ranges of code points into a set.
+
+	A code point is part of the set when its General Category matches the
+	flags or when it is part of one of the included ranges, unless it is part
+	of one of the excluded ranges. This allows sets like "letters or digits
+	except U+00AA FEMININE ORDINAL INDICATOR" to be expressed as:
+
+	\code{.c}
+		const utf8range_t exclude[] = { { 0x00AA, 0x00AA } };
+		utf8charset_t set;
+		uint32_t* data;
+		size_t data_size;
+		int32_t errors;
+
+		data_size = utf8charsetcompile(NULL, UTF8_CATEGORY_LETTER | UTF8_CATEGORY_NUMBER_DECIMAL, NULL, 0, exclude, 1, NULL, 0, &errors);
+		data = (uint32_t*)malloc(data_size * sizeof(uint32_t));
+		utf8charsetcompile(&set, UTF8_CATEGORY_LETTER | UTF8_CATEGORY_NUMBER_DECIMAL, NULL, 0, exclude, 1, data, data_size, &errors);
+	\endcode
+
+	The UTF8_CATEGORY_IS* compatibility flags match Basic Latin the same way
+	as in #utf8iscategory. Grapheme clusters are not taken into account, every
+	code point is matched on its own.
+
+	Specify `NULL` for the data to get the amount of entries needed to store
+	the set. Compiling queries the General Category of every code point, so
+	sets should be compiled once and reused.
+
+	\param[out]  set           Compiled set, may be `NULL` when data is `NULL`.
+	\param[in]   flags         Category flags, a combination of UTF8_CATEGORY_* flags or a single UTF8_CATEGORY_IS* flag. May be 0.
+	\param[in]   include       Ranges of code points to add to the set.
+	\param[in]   includeSize   Amount of ranges to add.
+	\param[in]   exclude       Ranges of code points to remove from the set.
+	\param[in]   excludeSize   Amount of ranges to remove.
+	\param[out]  data          Output array for the table or NULL.
+	\param[in]   dataSize      Size of the output array in entries.
+	\param[out]  errors        Output for errors.
+
+	\return Amount of entries used to store the set, or 0 on error.
+
+	\retval #UTF8_ERR_NONE              The set was compiled successfully.
+	\retval #UTF8_ERR_INVALID_DATA      A range is invalid or the set does not point to valid memory.
+	\retval #UTF8_ERR_NOT_ENOUGH_SPACE  The output array is too small for the table.
+
+	\sa utf8charsetcontains
+*/
+UTF8_API size_t utf8charsetcompile(utf8charset_t* set, size_t flags, const utf8range_t* include, size_t includeSize, const utf8range_t* exclude, size_t excludeSize, uint32_t* data, size_t dataSize, int32_t* errors);
+
+/*!
+	\brief Check if a code point is part of a compiled set.
+
+	\param[in]  set        Compiled set.
+	\param[in]  codePoint  Code point to check.
+
+	\return 1 if the code point is part of the set, 0 otherwise.
+
+	\sa utf8charsetcompile
+*/
+UTF8_API uint8_t utf8charsetcontains(const utf8charset_t* set, unicode_t codePoint);
+
+/*!
+	\brief Match code points in the input string against a compiled set.
+
+	Returns the number of bytes in the input before the first code point
+	that is not part of the set, similar to the way `strspn` works. Invalid
+	sequences are matched as U+FFFD REPLACEMENT CHARACTER.
+
+	\param[in]  set        Compiled set.
+	\param[in]  input      UTF-8 encoded string.
+	\param[in]  inputSize  Size of the input in bytes.
+
+	\return Number of bytes in the input that are part of the set.
+
+	\sa utf8charsetcspan
+*/
+UTF8_API size_t utf8charsetspan(const utf8charset_t* set, const char* input, size_t inputSize);
+
+/*!
+	\brief Find the first code point in the input string that is part of a
+	compiled set.
+
+	Returns the number of bytes in the input before the first code point
+	that is part of the set, similar to the way `strcspn` works. Invalid
+	sequences are matched as U+FFFD REPLACEMENT CHARACTER.
+
+	\param[in]  set        Compiled set.
+	\param[in]  input      UTF-8 encoded string.
+	\param[in]  inputSize  Size of the input in bytes.
+
+	\return Number of bytes in the input that are not part of the set.
+
+	\sa utf8charsetspan
+*/
+UTF8_API size_t utf8charsetcspan(const utf8charset_t* set, const char* input, size_t inputSize);
+
 #endif /* _UTF8REWIND_H_ */
\ No newline at end of file
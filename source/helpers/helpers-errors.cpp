@@ -16,6 +16,7 @@ namespace helpers {
 		MAKE_CASE(INVALID_FLAG);
 		MAKE_CASE(NOT_ENOUGH_SPACE);
 		MAKE_CASE(OVERLAPPING_PARAMETERS);
+		MAKE_CASE(INVALID_LOCALE);
 
 	#undef MAKE_CASE
 
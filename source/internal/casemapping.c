@@ -126,10 +126,18 @@ uint8_t casemapping_initialize(
 	CaseMappingState* state,
 	const char* input, size_t inputSize,
 	char* target, size_t targetSize,
-	const uint32_t* propertyIndex1, const uint32_t* propertyIndex2, const uint32_t* propertyData)
+	const uint32_t* propertyIndex1, const uint32_t* propertyIndex2, const uint32_t* propertyData,
+	size_t locale)
 {
 	memset(state, 0, sizeof(CaseMappingState));
 
+	/* Check for valid locale */
+
+	if (locale >= UTF8_LOCALE_MAXIMUM)
+	{
+		return 0;
+	}
+
 	state->src = input;
 	state->src_size = inputSize;
 	state->dst = target;
@@ -138,7 +146,7 @@ uint8_t casemapping_initialize(
 	state->property_index2 = propertyIndex2;
 	state->property_data = propertyData;
 	state->quickcheck_flags = 0;
-	state->locale = casemapping_locale();
+	state->locale = (uint32_t)locale;
 
 	if (propertyData == TitlecaseDataPtr)
 	{
@@ -157,6 +165,356 @@ uint8_t casemapping_initialize(
 	return 1;
 }
 
+#define BASIC_LATIN_BLOCK_ONES  (0x0101010101010101ULL)
+#define BASIC_LATIN_BLOCK_HIGH  (0x8080808080808080ULL)
+
+/* Case folding of a Basic Latin byte, LATIN CAPITAL LETTER I is folded to a dotless i in Turkish */
+
+#define CASEMAPPING_BASIC_LATIN_FOLD(_byte) \
+	(((_byte) >= 'A' && (_byte) <= 'Z') ? (uint8_t)((_byte) + 0x20) : (_byte))
+
+#define CASEMAPPING_BASIC_LATIN_PLAIN(_byte, _turkish) \
+	((_byte) <= MAX_BASIC_LATIN && (!(_turkish) || (_byte) != 'I'))
+
+static uint8_t casemapping_readfast(const char* input, size_t inputSize, unicode_t* codePoint)
+{
+	const uint8_t* src = (const uint8_t*)input;
+
+	/* Only well-formed sequences of two to four bytes are decoded */
+
+	if (src[0] < 0xC2)
+	{
+		return 0;
+	}
+	else if (
+		src[0] < 0xE0)
+	{
+		if (inputSize < 2 ||
+			(src[1] & 0xC0) != 0x80)
+		{
+			return 0;
+		}
+
+		*codePoint = ((src[0] & 0x1F) << 6) | (src[1] & 0x3F);
+
+		return 2;
+	}
+	else if (
+		src[0] < 0xF0)
+	{
+		if (inputSize < 3 ||
+			(src[1] & 0xC0) != 0x80 ||
+			(src[2] & 0xC0) != 0x80)
+		{
+			return 0;
+		}
+
+		*codePoint = ((src[0] & 0x0F) << 12) | ((src[1] & 0x3F) << 6) | (src[2] & 0x3F);
+
+		/* Reject overlong sequences and surrogates */
+
+		if (*codePoint < 0x0800 ||
+			(*codePoint >= SURROGATE_HIGH_START && *codePoint <= SURROGATE_LOW_END))
+		{
+			return 0;
+		}
+
+		return 3;
+	}
+	else if (
+		src[0] < 0xF5)
+	{
+		if (inputSize < 4 ||
+			(src[1] & 0xC0) != 0x80 ||
+			(src[2] & 0xC0) != 0x80 ||
+			(src[3] & 0xC0) != 0x80)
+		{
+			return 0;
+		}
+
+		*codePoint = ((src[0] & 0x07) << 18) | ((src[1] & 0x3F) << 12) | ((src[2] & 0x3F) << 6) | (src[3] & 0x3F);
+
+		/* Reject overlong sequences and code points outside of Unicode */
+
+		if (*codePoint < 0x10000 ||
+			*codePoint > MAX_LEGAL_UNICODE)
+		{
+			return 0;
+		}
+
+		return 4;
+	}
+
+	return 0;
+}
+
+size_t casemapping_executefast(CaseMappingState* state)
+{
+	const char* src = state->src;
+	size_t src_size = state->src_size;
+	char* dst = state->dst;
+	size_t dst_size = state->dst_size;
+	uint64_t block_first;
+	uint64_t block_last;
+	uint8_t lowercase;
+	uint8_t casefold;
+	uint8_t quickcheck_flags;
+	size_t span_size = 0;
+	size_t written = 0;
+
+	/*
+		Locale-specific mappings and titlecase depend on the surrounding code
+		points, which is why only the default mappings are handled here.
+	*/
+
+	if (state->locale != CASEMAPPING_LOCALE_DEFAULT ||
+		state->property_data == TitlecaseDataPtr)
+	{
+		return 0;
+	}
+
+	lowercase = state->property_data != UppercaseDataPtr;
+	casefold = state->property_data == CaseFoldingDataPtr;
+	quickcheck_flags = casefold ? QuickCheckCaseMapped_Casefolded : state->quickcheck_flags;
+
+	/*
+		Adding these values to a block of Basic Latin sets the high bit of every
+		byte that is at least the first letter and of every byte that comes
+		after the last letter, without carrying into the next byte.
+	*/
+
+	if (lowercase)
+	{
+		block_first = BASIC_LATIN_BLOCK_ONES * (0x80 - 0x41);
+		block_last = BASIC_LATIN_BLOCK_ONES * (0x80 - 0x5B);
+	}
+	else
+	{
+		block_first = BASIC_LATIN_BLOCK_ONES * (0x80 - 0x61);
+		block_last = BASIC_LATIN_BLOCK_ONES * (0x80 - 0x7B);
+	}
+
+	while (src_size > 0)
+	{
+		uint8_t lead = (uint8_t)*src;
+		unicode_t code_point = lead;
+		unicode_t mapped = lead;
+		uint8_t length = 1;
+
+		if (lead >= 0x80)
+		{
+			/* Invalid sequences are replaced by the full case mapping */
+
+			if ((length = casemapping_readfast(src, src_size, &code_point)) == 0)
+			{
+				break;
+			}
+
+			/*
+				Letters in Latin-1 Supplement, Greek and Cyrillic are mapped with
+				a simple offset and are encoded in two bytes before and after.
+			*/
+
+			mapped = code_point;
+
+			if (length == 2)
+			{
+				if (lowercase)
+				{
+					if ((code_point >= 0x00C0 && code_point <= 0x00DE && code_point != 0x00D7) ||
+						(code_point >= 0x0391 && code_point <= 0x03AB && code_point != 0x03A2 && code_point != CP_GREEK_CAPITAL_LETTER_SIGMA) ||
+						(code_point >= 0x0410 && code_point <= 0x042F))
+					{
+						mapped = code_point + 0x20;
+					}
+					else if (
+						code_point >= 0x0400 &&
+						code_point <= 0x040F)
+					{
+						mapped = code_point + 0x50;
+					}
+					else if (
+						code_point == CP_GREEK_CAPITAL_LETTER_SIGMA &&
+						!casefold)
+					{
+						/* Lowercase GREEK CAPITAL LETTER SIGMA depends on the code points around it */
+
+						break;
+					}
+				}
+				else
+				{
+					if ((code_point >= 0x00E0 && code_point <= 0x00FE && code_point != 0x00F7) ||
+						(code_point >= 0x03B1 && code_point <= 0x03CB && code_point != 0x03C2) ||
+						(code_point >= 0x0430 && code_point <= 0x044F))
+					{
+						mapped = code_point - 0x20;
+					}
+					else if (
+						code_point >= 0x0450 &&
+						code_point <= 0x045F)
+					{
+						mapped = code_point - 0x50;
+					}
+				}
+			}
+
+			if (mapped == code_point &&
+				(PROPERTY_GET_CM(code_point) & quickcheck_flags) == 0)
+			{
+				/* Code points unaffected by case mapping are copied as a single span */
+
+				if (dst != 0 &&
+					dst_size < span_size + length)
+				{
+					break;
+				}
+
+				span_size += length;
+
+				src += length;
+				src_size -= length;
+
+				continue;
+			}
+		}
+
+		/* Copy the span preceding the code point */
+
+		if (span_size > 0)
+		{
+			if (dst != 0)
+			{
+				memcpy(dst, src - span_size, span_size);
+
+				dst += span_size;
+				dst_size -= span_size;
+			}
+
+			written += span_size;
+			span_size = 0;
+		}
+
+		if (lead < 0x80)
+		{
+			/* Map eight Basic Latin code points at a time */
+
+			if (src_size >= 8 &&
+				(dst == 0 || dst_size >= 8))
+			{
+				uint64_t block;
+				memcpy(&block, src, 8);
+
+				if ((block & BASIC_LATIN_BLOCK_HIGH) == 0)
+				{
+					if (dst != 0)
+					{
+						/* Flip the case bit of every letter in the block */
+
+						uint64_t letters = (block + block_first) & ~(block + block_last) & BASIC_LATIN_BLOCK_HIGH;
+						block ^= letters >> 2;
+
+						memcpy(dst, &block, 8);
+
+						dst += 8;
+						dst_size -= 8;
+					}
+
+					written += 8;
+
+					src += 8;
+					src_size -= 8;
+
+					continue;
+				}
+			}
+
+			/* Map a single Basic Latin code point */
+
+			if (dst != 0)
+			{
+				if (dst_size < 1)
+				{
+					break;
+				}
+
+				if (lead >= 0x41 &&
+					lead <= 0x7A)
+				{
+					*dst = lowercase ? basic_latin_lowercase_table[lead - 0x41] : basic_latin_uppercase_table[lead - 0x41];
+				}
+				else
+				{
+					*dst = (char)lead;
+				}
+
+				dst++;
+				dst_size--;
+			}
+
+			written++;
+		}
+		else if (
+			mapped != code_point)
+		{
+			if (dst != 0)
+			{
+				if (dst_size < 2)
+				{
+					break;
+				}
+
+				dst[0] = (char)(0xC0 | (mapped >> 6));
+				dst[1] = (char)(0x80 | (mapped & 0x3F));
+
+				dst += 2;
+				dst_size -= 2;
+			}
+
+			written += 2;
+		}
+		else
+		{
+			uint8_t mapped_length;
+
+			/* Mappings to more than one code point are handled by the full case mapping */
+
+			if ((mapped = database_querysimplecasemapping(code_point, state->property_data)) == 0 ||
+				(mapped_length = codepoint_write(mapped, &dst, &dst_size)) == 0)
+			{
+				break;
+			}
+
+			written += mapped_length;
+		}
+
+		src += length;
+		src_size -= length;
+	}
+
+	/* Copy the remaining span */
+
+	if (span_size > 0)
+	{
+		if (dst != 0)
+		{
+			memcpy(dst, src - span_size, span_size);
+
+			dst += span_size;
+			dst_size -= span_size;
+		}
+
+		written += span_size;
+	}
+
+	state->src = src;
+	state->src_size = src_size;
+	state->dst = dst;
+	state->dst_size = dst_size;
+
+	return written;
+}
+
 size_t casemapping_execute(CaseMappingState* state, int32_t* errors)
 {
 	uint8_t qc_casemapped = 0;
@@ -627,6 +985,24 @@ writeregular:
 		qc_casemapped = PROPERTY_GET_CM(state->last_code_point);
 		if ((qc_casemapped & state->quickcheck_flags) != 0)
 		{
+			/* Most code points map to a single code point */
+
+			unicode_t mapped = database_querysimplecasemapping(state->last_code_point, state->property_data);
+			if (mapped != 0)
+			{
+				/* Code point properties */
+
+				state->last_general_category = UTF8_CATEGORY_LETTER;
+
+				bytes_needed = codepoint_write(mapped, &state->dst, &state->dst_size);
+				if (bytes_needed == 0)
+				{
+					goto outofspace;
+				}
+
+				return bytes_needed;
+			}
+
 			/* Attempt to resolve the case mapping */
 
 			resolved = database_querydecomposition(state->last_code_point, state->property_index1, state->property_index2, state->property_data, &bytes_needed);
@@ -716,4 +1092,834 @@ outofspace:
 	state->src_size = 0;
 
 	return 0;
+}
+
+size_t casemapping_executefold(CaseMappingState* state, int32_t* errors)
+{
+	const char* resolved = 0;
+	uint8_t bytes_needed = 0;
+
+	/* Read next code point */
+
+	state->last_code_point_size = codepoint_read(state->src, state->src_size, &state->last_code_point);
+	if (state->last_code_point_size == 0)
+	{
+		goto invaliddata;
+	}
+
+	/* Fixes for Turkish locale */
+
+	if (state->locale == CASEMAPPING_LOCALE_TURKISH_OR_AZERI_LATIN)
+	{
+		if (state->last_code_point == CP_LATIN_CAPITAL_LETTER_I)
+		{
+			resolved = "\xC4\xB1";
+			bytes_needed = 2;
+		}
+		else if (
+			state->last_code_point == CP_LATIN_CAPITAL_LETTER_I_WITH_DOT_ABOVE)
+		{
+			resolved = "i";
+			bytes_needed = 1;
+		}
+	}
+
+	/* Resolve case folding */
+
+	if (resolved == 0 &&
+		(PROPERTY_GET_CM(state->last_code_point) & QuickCheckCaseMapped_Casefolded) != 0)
+	{
+		unicode_t folded = database_querysimplecasemapping(state->last_code_point, state->property_data);
+		if (folded != 0)
+		{
+			state->last_code_point = folded;
+		}
+		else
+		{
+			resolved = database_querydecomposition(state->last_code_point, state->property_index1, state->property_index2, state->property_data, &bytes_needed);
+		}
+	}
+
+	/* Move source cursor */
+
+	if (state->src_size >= state->last_code_point_size)
+	{
+		state->src += state->last_code_point_size;
+		state->src_size -= state->last_code_point_size;
+	}
+	else
+	{
+		state->src_size = 0;
+	}
+
+	/* Write to output */
+
+	if (resolved != 0)
+	{
+		/* Write resolved string to output */
+
+		if (state->dst != 0)
+		{
+			if (state->dst_size < bytes_needed)
+			{
+				goto outofspace;
+			}
+
+			memcpy(state->dst, resolved, bytes_needed);
+
+			state->dst += bytes_needed;
+			state->dst_size -= bytes_needed;
+		}
+	}
+	else
+	{
+		/* Write code point to output */
+
+		bytes_needed = codepoint_write(state->last_code_point, &state->dst, &state->dst_size);
+		if (bytes_needed == 0)
+		{
+			goto outofspace;
+		}
+	}
+
+	return bytes_needed;
+
+invaliddata:
+	UTF8_SET_ERROR(INVALID_DATA);
+
+	state->src_size = 0;
+
+	return 0;
+
+outofspace:
+	UTF8_SET_ERROR(NOT_ENOUGH_SPACE);
+
+	state->src_size = 0;
+
+	return 0;
+}
+
+size_t casemapping_executeinplace(CaseMappingState* state, int32_t* errors)
+{
+	char converted[CASEMAPPING_INPLACE_BUFFER_SIZE];
+	char* rewrite = (char*)state->src;
+	uint8_t rewriting = 1;
+	uint8_t fast = 1;
+
+	while (state->src_size > 0)
+	{
+		const char* src_start = state->src;
+		size_t src_size_start = state->src_size;
+		size_t bytes_needed = 0;
+
+		/* Convert into a temporary buffer before writing over the input */
+
+		if (rewriting)
+		{
+			state->dst = converted;
+			state->dst_size = CASEMAPPING_INPLACE_BUFFER_SIZE;
+		}
+
+		if (fast)
+		{
+			bytes_needed = casemapping_executefast(state);
+		}
+
+		if (bytes_needed == 0)
+		{
+			if (state->property_data == CaseFoldingDataPtr)
+			{
+				bytes_needed = casemapping_executefold(state, errors);
+			}
+			else
+			{
+				bytes_needed = casemapping_execute(state, errors);
+			}
+
+			if (bytes_needed == 0)
+			{
+				return state->total_bytes_needed;
+			}
+		}
+
+		if (rewriting)
+		{
+			if (bytes_needed == (size_t)(state->src - src_start))
+			{
+				/* Replace the input with the converted text of the same length */
+
+				memcpy(rewrite, converted, bytes_needed);
+
+				rewrite += bytes_needed;
+			}
+			else if (
+				fast)
+			{
+				/* Find the code point that changed length one code point at a time */
+
+				state->src = src_start;
+				state->src_size = src_size_start;
+
+				fast = 0;
+
+				continue;
+			}
+			else
+			{
+				/* Only measure the size of the remaining text from now on */
+
+				state->dst = 0;
+				state->dst_size = 0;
+
+				rewriting = 0;
+				fast = 1;
+			}
+		}
+
+		state->total_bytes_needed += bytes_needed;
+	}
+
+	if (rewriting)
+	{
+		UTF8_SET_ERROR(NONE);
+	}
+	else
+	{
+		UTF8_SET_ERROR(NOT_ENOUGH_SPACE);
+	}
+
+	return state->total_bytes_needed;
+}
+
+const char* casemapping_boundaryforward(const char* input, const char* inputEnd)
+{
+	unicode_t previous = 0;
+	uint8_t previous_size = 0;
+
+	/* Move cursor past the rest of the current sequence */
+
+	while (input < inputEnd &&
+		codepoint_decoded_length[(uint8_t)*input] == 0)
+	{
+		input++;
+	}
+
+	while (input < inputEnd)
+	{
+		unicode_t decoded;
+		uint8_t decoded_size = codepoint_read(input, (size_t)(inputEnd - input), &decoded);
+		if (decoded_size == 0 ||
+			decoded_size > (size_t)(inputEnd - input))
+		{
+			return inputEnd;
+		}
+
+		/*
+			A code point after a starter can start a new segment when neither of
+			them depends on the other. Neither can be GREEK CAPITAL LETTER SIGMA,
+			because its lowercase mapping looks at the code points around it.
+			Titlecase depends on whether the previous code point was a letter,
+			unless the code point is not case mapped at all.
+		*/
+
+		if (previous_size > 0 &&
+			previous != REPLACEMENT_CHARACTER &&
+			previous != CP_GREEK_CAPITAL_LETTER_SIGMA &&
+			decoded != REPLACEMENT_CHARACTER &&
+			decoded != CP_GREEK_CAPITAL_LETTER_SIGMA &&
+			PROPERTY_GET_CCC(previous) == CCC_NOT_REORDERED &&
+			PROPERTY_GET_CCC(decoded) == CCC_NOT_REORDERED &&
+			(
+				(PROPERTY_GET_GC(previous) & UTF8_CATEGORY_LETTER) == 0 ||
+				PROPERTY_GET_CM(decoded) == 0
+			))
+		{
+			break;
+		}
+
+		previous = decoded;
+		previous_size = decoded_size;
+
+		input += decoded_size;
+	}
+
+	return input;
+}
+
+static size_t casemapping_comparefill(CaseMappingState* state, char* buffer, int32_t* errors)
+{
+	size_t filled;
+
+	state->dst = buffer;
+	state->dst_size = CASEMAPPING_COMPARE_BUFFER_SIZE;
+
+	if ((filled = casemapping_executefast(state)) == 0)
+	{
+		filled = casemapping_executefold(state, errors);
+	}
+
+	return filled;
+}
+
+int casemapping_compare(const char* left, size_t leftSize, const char* right, size_t rightSize, size_t count, size_t locale, int32_t* errors)
+{
+	CaseMappingState left_state;
+	CaseMappingState right_state;
+	char left_buffer[CASEMAPPING_COMPARE_BUFFER_SIZE];
+	char right_buffer[CASEMAPPING_COMPARE_BUFFER_SIZE];
+	const uint8_t* left_folded = (const uint8_t*)left_buffer;
+	const uint8_t* right_folded = (const uint8_t*)right_buffer;
+	size_t left_folded_size = 0;
+	size_t right_folded_size = 0;
+	uint8_t turkish = locale == CASEMAPPING_LOCALE_TURKISH_OR_AZERI_LATIN;
+
+	casemapping_initialize(&left_state, left, leftSize, 0, 0, CaseFoldingIndex1Ptr, CaseFoldingIndex2Ptr, CaseFoldingDataPtr, locale);
+	casemapping_initialize(&right_state, right, rightSize, 0, 0, CaseFoldingIndex1Ptr, CaseFoldingIndex2Ptr, CaseFoldingDataPtr, locale);
+
+	while (1)
+	{
+		/* Both sides are at the start of a code point here */
+
+		if (count == 0)
+		{
+			return 0;
+		}
+
+		if (left_folded_size == 0 &&
+			right_folded_size == 0)
+		{
+			uint8_t left_lead;
+			uint8_t right_lead;
+
+			if (left_state.src_size == 0 ||
+				right_state.src_size == 0)
+			{
+				break;
+			}
+
+			left_lead = (uint8_t)*left_state.src;
+			right_lead = (uint8_t)*right_state.src;
+
+			/* Compare eight Basic Latin code points at a time */
+
+			if (!turkish &&
+				count >= 8 &&
+				left_state.src_size >= 8 &&
+				right_state.src_size >= 8)
+			{
+				uint64_t left_block;
+				uint64_t right_block;
+				memcpy(&left_block, left_state.src, 8);
+				memcpy(&right_block, right_state.src, 8);
+
+				if (((left_block | right_block) & BASIC_LATIN_BLOCK_HIGH) == 0)
+				{
+					/* Set the case bit of every uppercase letter in both blocks */
+
+					left_block |= ((left_block + BASIC_LATIN_BLOCK_ONES * (0x80 - 0x41)) & ~(left_block + BASIC_LATIN_BLOCK_ONES * (0x80 - 0x5B)) & BASIC_LATIN_BLOCK_HIGH) >> 2;
+					right_block |= ((right_block + BASIC_LATIN_BLOCK_ONES * (0x80 - 0x41)) & ~(right_block + BASIC_LATIN_BLOCK_ONES * (0x80 - 0x5B)) & BASIC_LATIN_BLOCK_HIGH) >> 2;
+
+					if (left_block == right_block)
+					{
+						left_state.src += 8;
+						left_state.src_size -= 8;
+						right_state.src += 8;
+						right_state.src_size -= 8;
+
+						count -= 8;
+
+						continue;
+					}
+				}
+			}
+
+			/* Compare a single Basic Latin code point */
+
+			if (left_lead < 0x80 &&
+				right_lead < 0x80 &&
+				(!turkish || (left_lead != 'I' && right_lead != 'I')))
+			{
+				if (left_lead >= 'A' &&
+					left_lead <= 'Z')
+				{
+					left_lead += 0x20;
+				}
+
+				if (right_lead >= 'A' &&
+					right_lead <= 'Z')
+				{
+					right_lead += 0x20;
+				}
+
+				if (left_lead != right_lead)
+				{
+					return (left_lead < right_lead) ? -1 : 1;
+				}
+
+				left_state.src++;
+				left_state.src_size--;
+				right_state.src++;
+				right_state.src_size--;
+
+				count--;
+
+				continue;
+			}
+		}
+
+		/* Case fold the next code points of either side */
+
+		if (left_folded_size == 0)
+		{
+			if (left_state.src_size == 0)
+			{
+				break;
+			}
+
+			left_folded = (const uint8_t*)left_buffer;
+			left_folded_size = casemapping_comparefill(&left_state, left_buffer, errors);
+		}
+
+		if (right_folded_size == 0)
+		{
+			if (right_state.src_size == 0)
+			{
+				break;
+			}
+
+			right_folded = (const uint8_t*)right_buffer;
+			right_folded_size = casemapping_comparefill(&right_state, right_buffer, errors);
+		}
+
+		if (left_folded_size == 0 ||
+			right_folded_size == 0)
+		{
+			break;
+		}
+
+		/* Compare the case folded text until the first difference */
+
+		while (left_folded_size > 0 &&
+			right_folded_size > 0)
+		{
+			if ((*left_folded & 0xC0) != 0x80)
+			{
+				/* Count code points on the left side, the bytes so far are equal */
+
+				if (count == 0)
+				{
+					return 0;
+				}
+
+				count--;
+			}
+
+			if (*left_folded != *right_folded)
+			{
+				return (*left_folded < *right_folded) ? -1 : 1;
+			}
+
+			left_folded++;
+			left_folded_size--;
+			right_folded++;
+			right_folded_size--;
+		}
+	}
+
+	/* The side with case folded text remaining is greater */
+
+	if (left_folded_size > 0 ||
+		left_state.src_size > 0)
+	{
+		return 1;
+	}
+	else if (
+		right_folded_size > 0 ||
+		right_state.src_size > 0)
+	{
+		return -1;
+	}
+
+	return 0;
+}
+
+size_t casemapping_matchprefix(const char* input, size_t inputSize, const char* folded, size_t foldedSize, const char* needle, size_t needleSize, size_t locale, int32_t* errors)
+{
+	CaseMappingState input_state;
+	CaseMappingState needle_state;
+	char input_buffer[CASEMAPPING_COMPARE_BUFFER_SIZE];
+	char needle_buffer[CASEMAPPING_COMPARE_BUFFER_SIZE];
+	const char* input_folded = input_buffer;
+	size_t input_folded_size = 0;
+	uint8_t turkish = locale == CASEMAPPING_LOCALE_TURKISH_OR_AZERI_LATIN;
+
+	casemapping_initialize(&input_state, input, inputSize, 0, 0, CaseFoldingIndex1Ptr, CaseFoldingIndex2Ptr, CaseFoldingDataPtr, locale);
+	casemapping_initialize(&needle_state, needle, needleSize, 0, 0, CaseFoldingIndex1Ptr, CaseFoldingIndex2Ptr, CaseFoldingDataPtr, locale);
+
+	while (1)
+	{
+		uint8_t input_lead;
+		unicode_t code_point;
+		size_t length;
+
+		/* Case fold the rest of the needle when its folded start runs out */
+
+		if (foldedSize == 0)
+		{
+			if (needle_state.src_size == 0)
+			{
+				/* The match must end on a code point in the input */
+
+				return (input_folded_size == 0) ? (size_t)(input_state.src - input) : 0;
+			}
+
+			folded = needle_buffer;
+			foldedSize = casemapping_comparefill(&needle_state, needle_buffer, errors);
+
+			if (foldedSize == 0)
+			{
+				return 0;
+			}
+		}
+
+		/* Compare the case folded code point until either side runs out */
+
+		if (input_folded_size > 0)
+		{
+			while (input_folded_size > 0 &&
+				foldedSize > 0)
+			{
+				if (*input_folded != *folded)
+				{
+					return 0;
+				}
+
+				input_folded++;
+				input_folded_size--;
+				folded++;
+				foldedSize--;
+			}
+
+			continue;
+		}
+
+		if (input_state.src_size == 0)
+		{
+			return 0;
+		}
+
+		input_lead = (uint8_t)*input_state.src;
+
+		if (CASEMAPPING_BASIC_LATIN_PLAIN(input_lead, turkish))
+		{
+			/* Compare eight Basic Latin code points at a time */
+
+			if (!turkish &&
+				input_state.src_size >= 8 &&
+				foldedSize >= 8)
+			{
+				uint64_t input_block;
+				uint64_t folded_block;
+				memcpy(&input_block, input_state.src, 8);
+				memcpy(&folded_block, folded, 8);
+
+				if (((input_block | folded_block) & BASIC_LATIN_BLOCK_HIGH) == 0)
+				{
+					/* Set the case bit of every uppercase letter in the input */
+
+					input_block |= ((input_block + BASIC_LATIN_BLOCK_ONES * (0x80 - 0x41)) & ~(input_block + BASIC_LATIN_BLOCK_ONES * (0x80 - 0x5B)) & BASIC_LATIN_BLOCK_HIGH) >> 2;
+
+					if (input_block != folded_block)
+					{
+						return 0;
+					}
+
+					input_state.src += 8;
+					input_state.src_size -= 8;
+					folded += 8;
+					foldedSize -= 8;
+
+					continue;
+				}
+			}
+
+			/* Compare a single Basic Latin code point */
+
+			if (CASEMAPPING_BASIC_LATIN_FOLD(input_lead) != (uint8_t)*folded)
+			{
+				return 0;
+			}
+
+			input_state.src++;
+			input_state.src_size--;
+			folded++;
+			foldedSize--;
+
+			continue;
+		}
+
+		if ((length = casemapping_readfast(input_state.src, input_state.src_size, &code_point)) > 0 &&
+			(PROPERTY_GET_CM(code_point) & QuickCheckCaseMapped_Casefolded) == 0)
+		{
+			/* Code points unaffected by case folding are compared as they are */
+
+			input_folded = input_state.src;
+			input_folded_size = length;
+
+			input_state.src += length;
+			input_state.src_size -= length;
+		}
+		else
+		{
+			/* Case fold a single code point, the end of the match must be known in the input */
+
+			input_state.dst = input_buffer;
+			input_state.dst_size = CASEMAPPING_COMPARE_BUFFER_SIZE;
+
+			input_folded = input_buffer;
+			input_folded_size = casemapping_executefold(&input_state, errors);
+
+			if (input_folded_size == 0)
+			{
+				return 0;
+			}
+		}
+	}
+}
+
+const char* casemapping_search(const char* input, size_t inputSize, const char* needle, size_t needleSize, size_t locale, size_t* matchSize, int32_t* errors)
+{
+	CaseMappingState state;
+	char folded[CASEMAPPING_SEARCH_NEEDLE_SIZE];
+	uint8_t pattern[CASEMAPPING_SEARCH_PATTERN_SIZE];
+	uint8_t skip[MAX_BASIC_LATIN + 1];
+	unicode_t first_code_point = 0;
+	size_t folded_size = 0;
+	size_t pattern_size = 0;
+	size_t position = 0;
+	size_t special = 0;
+	size_t matched = 0;
+	uint8_t turkish = locale == CASEMAPPING_LOCALE_TURKISH_OR_AZERI_LATIN;
+	size_t i;
+
+	/*
+		Case fold the needle once instead of for every candidate match, the
+		rest of a needle that doesn't fit is folded while matching.
+	*/
+
+	casemapping_initialize(&state, needle, needleSize, 0, 0, CaseFoldingIndex1Ptr, CaseFoldingIndex2Ptr, CaseFoldingDataPtr, locale);
+
+	while (state.src_size > 0 &&
+		folded_size + CASEMAPPING_COMPARE_BUFFER_SIZE <= CASEMAPPING_SEARCH_NEEDLE_SIZE)
+	{
+		size_t filled = casemapping_comparefill(&state, folded + folded_size, errors);
+		if (filled == 0)
+		{
+			break;
+		}
+
+		folded_size += filled;
+	}
+
+	/*
+		The start of the folded needle up to the first code point that isn't
+		folded to Basic Latin is used as a pattern. Every Basic Latin code
+		point in the input is folded to a single byte, so this pattern can be
+		matched against the input without case folding it.
+	*/
+
+	if (folded_size > 0)
+	{
+		codepoint_read(folded, folded_size, &first_code_point);
+	}
+
+	while (pattern_size < CASEMAPPING_SEARCH_PATTERN_SIZE &&
+		pattern_size < folded_size &&
+		(uint8_t)folded[pattern_size] <= MAX_BASIC_LATIN)
+	{
+		pattern[pattern_size] = (uint8_t)folded[pattern_size];
+		pattern_size++;
+	}
+
+	/* Build the skip table for the pattern */
+
+	for (i = 0; i <= MAX_BASIC_LATIN; ++i)
+	{
+		skip[i] = (uint8_t)pattern_size;
+	}
+
+	for (i = 0; i + 1 < pattern_size; ++i)
+	{
+		skip[pattern[i]] = (uint8_t)(pattern_size - 1 - i);
+	}
+
+	while (position < inputSize)
+	{
+		uint8_t lead = (uint8_t)input[position];
+		uint8_t candidate;
+		size_t length;
+
+		if (pattern_size > 0)
+		{
+			/* Find the next byte in the input that isn't folded to a single byte */
+
+			if (special < position)
+			{
+				special = position;
+			}
+
+			if (!turkish)
+			{
+				while (special + 8 <= position + pattern_size &&
+					special + 8 <= inputSize)
+				{
+					uint64_t block;
+					memcpy(&block, input + special, 8);
+
+					if ((block & BASIC_LATIN_BLOCK_HIGH) != 0)
+					{
+						break;
+					}
+
+					special += 8;
+				}
+			}
+
+			while (special < position + pattern_size &&
+				special < inputSize &&
+				CASEMAPPING_BASIC_LATIN_PLAIN((uint8_t)input[special], turkish))
+			{
+				special++;
+			}
+
+			if (special >= position + pattern_size)
+			{
+				/* Skip ahead by the last byte of the window, every byte in it is Basic Latin */
+
+				uint8_t last = CASEMAPPING_BASIC_LATIN_FOLD((uint8_t)input[position + pattern_size - 1]);
+
+				if (last == pattern[pattern_size - 1] &&
+					(matched = casemapping_matchprefix(input + position, inputSize - position, folded, folded_size, state.src, state.src_size, locale, errors)) > 0)
+				{
+					goto found;
+				}
+
+				position += skip[last];
+
+				continue;
+			}
+		}
+
+		/*
+			Check every code point on its own near the end of the input and
+			around code points that aren't folded to Basic Latin.
+		*/
+
+		if ((lead & 0xC0) == 0x80)
+		{
+			position++;
+
+			continue;
+		}
+
+		if (CASEMAPPING_BASIC_LATIN_PLAIN(lead, turkish))
+		{
+			candidate = CASEMAPPING_BASIC_LATIN_FOLD(lead) == first_code_point;
+			length = 1;
+		}
+		else
+		{
+			unicode_t code_point;
+
+			if ((length = casemapping_readfast(input + position, inputSize - position, &code_point)) == 0)
+			{
+				length = codepoint_read(input + position, inputSize - position, &code_point);
+			}
+
+			/* Only code points changed by case folding can be folded to the start of the needle */
+
+			candidate =
+				code_point == first_code_point ||
+				(PROPERTY_GET_CM(code_point) & QuickCheckCaseMapped_Casefolded) != 0;
+		}
+
+		if (candidate &&
+			(matched = casemapping_matchprefix(input + position, inputSize - position, folded, folded_size, state.src, state.src_size, locale, errors)) > 0)
+		{
+			goto found;
+		}
+
+		position += (length > 0) ? length : 1;
+	}
+
+	return 0;
+
+found:
+	if (matchSize != 0)
+	{
+		*matchSize = matched;
+	}
+
+	return input + position;
+}
+
+uint64_t casemapping_hash(const char* input, size_t inputSize, size_t locale, int32_t* errors)
+{
+	CaseMappingState state;
+	char buffer[CASEMAPPING_COMPARE_BUFFER_SIZE];
+	uint64_t hash = CODEPOINT_HASH_INITIAL;
+	uint8_t turkish = locale == CASEMAPPING_LOCALE_TURKISH_OR_AZERI_LATIN;
+
+	casemapping_initialize(&state, input, inputSize, 0, 0, CaseFoldingIndex1Ptr, CaseFoldingIndex2Ptr, CaseFoldingDataPtr, locale);
+
+	while (state.src_size > 0)
+	{
+		uint8_t lead = (uint8_t)*state.src;
+		const char* folded;
+		size_t folded_size;
+
+		/* Hash Basic Latin code points without case folding them first */
+
+		if (lead < 0x80 &&
+			(!turkish || lead != 'I'))
+		{
+			if (lead >= 'A' &&
+				lead <= 'Z')
+			{
+				lead += 0x20;
+			}
+
+			hash = CODEPOINT_HASH(hash, lead);
+
+			state.src++;
+			state.src_size--;
+
+			continue;
+		}
+
+		/* Hash the case folded code points */
+
+		state.dst = buffer;
+		state.dst_size = CASEMAPPING_COMPARE_BUFFER_SIZE;
+
+		if ((folded_size = casemapping_executefold(&state, errors)) == 0)
+		{
+			break;
+		}
+
+		folded = buffer;
+
+		while (folded_size > 0)
+		{
+			unicode_t code_point;
+			uint8_t decoded_size = codepoint_read(folded, folded_size, &code_point);
+
+			hash = CODEPOINT_HASH(hash, code_point);
+
+			folded += decoded_size;
+			folded_size -= decoded_size;
+		}
+	}
+
+	return codepoint_hashfinalize(hash);
 }
\ No newline at end of file
@@ -35,9 +35,14 @@
 
 #include "utf8rewind.h"
 
-#define CASEMAPPING_LOCALE_DEFAULT                 0x00000000
-#define CASEMAPPING_LOCALE_LITHUANIAN              0x00000001
-#define CASEMAPPING_LOCALE_TURKISH_OR_AZERI_LATIN  0x00000002
+#define CASEMAPPING_LOCALE_DEFAULT                 UTF8_LOCALE_DEFAULT
+#define CASEMAPPING_LOCALE_LITHUANIAN              UTF8_LOCALE_LITHUANIAN
+#define CASEMAPPING_LOCALE_TURKISH_OR_AZERI_LATIN  UTF8_LOCALE_TURKISH_AND_AZERI_LATIN
+
+#define CASEMAPPING_INPLACE_BUFFER_SIZE            256
+#define CASEMAPPING_COMPARE_BUFFER_SIZE            64
+#define CASEMAPPING_SEARCH_PATTERN_SIZE            64
+#define CASEMAPPING_SEARCH_NEEDLE_SIZE             256
 
 uint32_t casemapping_locale();
 
@@ -58,10 +63,26 @@ typedef struct {
 	uint8_t quickcheck_flags;
 } CaseMappingState;
 
-uint8_t casemapping_initialize(CaseMappingState* state, const char* input, size_t inputSize, char* target, size_t targetSize, const uint32_t* propertyIndex1, const uint32_t* propertyIndex2, const uint32_t* propertyData);
+uint8_t casemapping_initialize(CaseMappingState* state, const char* input, size_t inputSize, char* target, size_t targetSize, const uint32_t* propertyIndex1, const uint32_t* propertyIndex2, const uint32_t* propertyData, size_t locale);
+
+size_t casemapping_executefast(CaseMappingState* state);
 
 size_t casemapping_execute(CaseMappingState* state, int32_t* errors);
 
+size_t casemapping_executefold(CaseMappingState* state, int32_t* errors);
+
+size_t casemapping_executeinplace(CaseMappingState* state, int32_t* errors);
+
+const char* casemapping_boundaryforward(const char* input, const char* inputEnd);
+
+int casemapping_compare(const char* left, size_t leftSize, const char* right, size_t rightSize, size_t count, size_t locale, int32_t* errors);
+
+size_t casemapping_matchprefix(const char* input, size_t inputSize, const char* folded, size_t foldedSize, const char* needle, size_t needleSize, size_t locale, int32_t* errors);
+
+const char* casemapping_search(const char* input, size_t inputSize, const char* needle, size_t needleSize, size_t locale, size_t* matchSize, int32_t* errors);
+
+uint64_t casemapping_hash(const char* input, size_t inputSize, size_t locale, int32_t* errors);
+
 /*! \endcond */
 
 #endif /* _UTF8REWIND_INTERNAL_CASEMAPPING_H_ */
\ No newline at end of file
@@ -191,7 +191,9 @@ uint8_t codepoint_read(const char* input, size_t inputSize, unicode_t* decoded)
 			0x10000, MAX_LEGAL_UNICODE, MAX_LEGAL_UNICODE
 		};
 
-		size_t src_size = inputSize;
+		/* Amount of bytes available after the first byte */
+
+		size_t src_size = inputSize - 1;
 		uint8_t src_index;
 
 		/* Length of sequence is determined by first byte */
@@ -269,4 +271,15 @@ uint8_t codepoint_read(const char* input, size_t inputSize, unicode_t* decoded)
 
 		return decoded_length;
 	}
+}
+
+uint64_t codepoint_hashfinalize(uint64_t hash)
+{
+	hash ^= hash >> 33;
+	hash *= 0xFF51AFD7ED558CCDULL;
+	hash ^= hash >> 33;
+	hash *= 0xC4CEB9FE1A85EC53ULL;
+	hash ^= hash >> 33;
+
+	return hash;
 }
\ No newline at end of file
@@ -220,6 +220,7 @@
 #define CP_COMBINING_GREEK_YPOGEGRAMMENI          0x0345
 #define CP_COMBINING_GRAPHEME_JOINER              0x034F
 #define CP_GREEK_CAPITAL_LETTER_SIGMA             0x03A3
+#define CP_GREEK_SMALL_LETTER_IOTA                0x03B9
 
 #define CCC_NOT_REORDERED                         0
 #define CCC_OVERLAY                               1
@@ -282,6 +283,40 @@ uint8_t codepoint_write(unicode_t encoded, char** target, size_t* targetSize);
 */
 uint8_t codepoint_read(const char* input, size_t inputSize, unicode_t* decoded);
 
+/*!
+	\def CODEPOINT_HASH_INITIAL
+	\brief Value of a hash before any code points were added.
+*/
+#define CODEPOINT_HASH_INITIAL               (0xCBF29CE484222325ULL)
+
+/*!
+	\def CODEPOINT_HASH_MULTIPLIER
+	\brief Odd multiplier used to spread code points over the hash.
+*/
+#define CODEPOINT_HASH_MULTIPLIER            (0x9E3779B97F4A7C15ULL)
+
+/*!
+	\def CODEPOINT_HASH
+	\brief Add a code point to a hash.
+
+	The upper half of the hash is folded into the lower half before mixing in
+	the code point, every step can be reversed for a given code point.
+*/
+#define CODEPOINT_HASH(_hash, _codepoint) \
+	((((_hash) ^ ((_hash) >> 32)) ^ (uint64_t)(_codepoint)) * CODEPOINT_HASH_MULTIPLIER)
+
+/*!
+	\brief Finalize a hash of code points.
+
+	Mixes all bits of the hash so that the lower bits can be used as an index
+	into a table.
+
+	\param[in]  hash  Hash built with #CODEPOINT_HASH
+
+	\return Final hash value.
+*/
+uint64_t codepoint_hashfinalize(uint64_t hash);
+
 /*!
 	\}
 */
@@ -147,6 +147,27 @@ uint8_t compose_execute(ComposeState* state)
 			{
 				unicode_t composed = 0;
 
+				if (state->contiguous == 1)
+				{
+					uint8_t cursor_between = cursor_current + 1;
+
+					/* FCC only composes codepoints that are adjacent after removing composed cells */
+
+					while (
+						cursor_between < cursor_next &&
+						state->output->codepoint[cursor_between] == 0)
+					{
+						cursor_between++;
+					}
+
+					if (cursor_between != cursor_next)
+					{
+						/* Codepoints after an uncomposed codepoint are never adjacent to the starter */
+
+						break;
+					}
+				}
+
 				/*
 					Hangul composition
 
@@ -172,9 +193,10 @@ uint8_t compose_execute(ComposeState* state)
 					state->output->codepoint[cursor_current] >= HANGUL_S_FIRST &&
 					state->output->codepoint[cursor_current] <= HANGUL_S_LAST)
 				{
-					/* Check for Hangul LV and T pair */ 
+					/* Check for Hangul LV and T pair, LVT syllables can't be composed further */ 
 
-					if (state->output->codepoint[cursor_next] >= HANGUL_T_FIRST &&
+					if (((state->output->codepoint[cursor_current] - HANGUL_S_FIRST) % HANGUL_T_COUNT) == 0 &&
+						state->output->codepoint[cursor_next] > HANGUL_T_FIRST &&
 						state->output->codepoint[cursor_next] <= HANGUL_T_LAST)
 					{
 						unicode_t t_index = state->output->codepoint[cursor_next] - HANGUL_T_FIRST;
@@ -238,6 +260,13 @@ uint8_t compose_execute(ComposeState* state)
 					cursor_current = output_index;
 					cursor_next = output_index;
 				}
+				else if (
+					state->output->canonical_combining_class[cursor_next] == CCC_NOT_REORDERED)
+				{
+					/* Starters that were not composed block composition with the codepoints after them */
+
+					break;
+				}
 			}
 			else if (
 				state->output->canonical_combining_class[cursor_next] == CCC_NOT_REORDERED)
@@ -324,9 +353,10 @@ uint8_t compose_execute(ComposeState* state)
 		}
 		else
 		{
-			/* Evaluated all sequences in output */
-
-			state->input = 0;
+			/*
+				Evaluated all sequences in output, the input is left as is
+				because the accumulation buffer can be filled again
+			*/
 
 			break;
 		}
@@ -41,6 +41,7 @@ typedef struct {
 	StreamState* output;
 	const size_t* qc_index;
 	const uint8_t* qc_data;
+	uint8_t contiguous;
 } ComposeState;
 
 uint8_t compose_initialize(ComposeState* state, StreamState* input, StreamState* output, uint8_t compatibility);
@@ -35,6 +35,146 @@ static const unicode_t DECOMPOSE_INDEX1_MASK = MAX_LEGAL_UNICODE;
 static const unicode_t DECOMPOSE_INDEX2_MASK = (1 << DECOMPOSE_INDEX1_SHIFT) - 1;
 static const unicode_t DECOMPOSE_DATA_MASK = (1 << DECOMPOSE_INDEX2_SHIFT) - 1;
 
+/* Abbreviations of General Category values used in the table below */
+
+#define Cc  UTF8_CATEGORY_CONTROL
+#define Ll  UTF8_CATEGORY_LETTER_LOWERCASE
+#define Lu  UTF8_CATEGORY_LETTER_UPPERCASE
+#define Nd  UTF8_CATEGORY_NUMBER_DECIMAL
+#define Pc  UTF8_CATEGORY_PUNCTUATION_CONNECTOR
+#define Pd  UTF8_CATEGORY_PUNCTUATION_DASH
+#define Pe  UTF8_CATEGORY_PUNCTUATION_CLOSE
+#define Po  UTF8_CATEGORY_PUNCTUATION_OTHER
+#define Ps  UTF8_CATEGORY_PUNCTUATION_OPEN
+#define Sc  UTF8_CATEGORY_SYMBOL_CURRENCY
+#define Sk  UTF8_CATEGORY_SYMBOL_MODIFIER
+#define Sm  UTF8_CATEGORY_SYMBOL_MATH
+#define Zs  UTF8_CATEGORY_SEPARATOR_SPACE
+
+const uint32_t database_basic_latin_general_category[128] = {
+	Cc, Cc, Cc, Cc, Cc, Cc, Cc, Cc, /* 0x00 - 0x07 */
+	Cc, Cc, Cc, Cc, Cc, Cc, Cc, Cc, /* 0x08 - 0x0F */
+	Cc, Cc, Cc, Cc, Cc, Cc, Cc, Cc, /* 0x10 - 0x17 */
+	Cc, Cc, Cc, Cc, Cc, Cc, Cc, Cc, /* 0x18 - 0x1F */
+	Zs, Po, Po, Po, Sc, Po, Po, Po, /* 0x20 - 0x27 */
+	Ps, Pe, Po, Sm, Po, Pd, Po, Po, /* 0x28 - 0x2F */
+	Nd, Nd, Nd, Nd, Nd, Nd, Nd, Nd, /* 0x30 - 0x37 */
+	Nd, Nd, Po, Po, Sm, Sm, Sm, Po, /* 0x38 - 0x3F */
+	Po, Lu, Lu, Lu, Lu, Lu, Lu, Lu, /* 0x40 - 0x47 */
+	Lu, Lu, Lu, Lu, Lu, Lu, Lu, Lu, /* 0x48 - 0x4F */
+	Lu, Lu, Lu, Lu, Lu, Lu, Lu, Lu, /* 0x50 - 0x57 */
+	Lu, Lu, Lu, Ps, Po, Pe, Sk, Pc, /* 0x58 - 0x5F */
+	Sk, Ll, Ll, Ll, Ll, Ll, Ll, Ll, /* 0x60 - 0x67 */
+	Ll, Ll, Ll, Ll, Ll, Ll, Ll, Ll, /* 0x68 - 0x6F */
+	Ll, Ll, Ll, Ll, Ll, Ll, Ll, Ll, /* 0x70 - 0x77 */
+	Ll, Ll, Ll, Ps, Sm, Pe, Sm, Cc  /* 0x78 - 0x7F */
+};
+
+#undef Cc
+#undef Ll
+#undef Lu
+#undef Nd
+#undef Pc
+#undef Pd
+#undef Pe
+#undef Po
+#undef Ps
+#undef Sc
+#undef Sk
+#undef Sm
+#undef Zs
+
+#define Bl  UTF8_CATEGORY_ISBLANK
+#define Sp  UTF8_CATEGORY_ISSPACE
+#define Xd  UTF8_CATEGORY_ISXDIGIT
+
+/* Basic Latin code points matching the POSIX `isblank` function */
+
+static const uint32_t database_basic_latin_isblank[128] = {
+	 0,  0,  0,  0,  0,  0,  0,  0, /* 0x00 - 0x07 */
+	 0, Bl,  0,  0,  0,  0,  0,  0, /* 0x08 - 0x0F */
+	 0,  0,  0,  0,  0,  0,  0,  0, /* 0x10 - 0x17 */
+	 0,  0,  0,  0,  0,  0,  0,  0, /* 0x18 - 0x1F */
+	Bl,  0,  0,  0,  0,  0,  0,  0, /* 0x20 - 0x27 */
+	 0,  0,  0,  0,  0,  0,  0,  0, /* 0x28 - 0x2F */
+	 0,  0,  0,  0,  0,  0,  0,  0, /* 0x30 - 0x37 */
+	 0,  0,  0,  0,  0,  0,  0,  0, /* 0x38 - 0x3F */
+	 0,  0,  0,  0,  0,  0,  0,  0, /* 0x40 - 0x47 */
+	 0,  0,  0,  0,  0,  0,  0,  0, /* 0x48 - 0x4F */
+	 0,  0,  0,  0,  0,  0,  0,  0, /* 0x50 - 0x57 */
+	 0,  0,  0,  0,  0,  0,  0,  0, /* 0x58 - 0x5F */
+	 0,  0,  0,  0,  0,  0,  0,  0, /* 0x60 - 0x67 */
+	 0,  0,  0,  0,  0,  0,  0,  0, /* 0x68 - 0x6F */
+	 0,  0,  0,  0,  0,  0,  0,  0, /* 0x70 - 0x77 */
+	 0,  0,  0,  0,  0,  0,  0,  0  /* 0x78 - 0x7F */
+};
+
+/* Basic Latin code points matching the POSIX `isspace` function */
+
+static const uint32_t database_basic_latin_isspace[128] = {
+	 0,  0,  0,  0,  0,  0,  0,  0, /* 0x00 - 0x07 */
+	 0, Sp, Sp, Sp, Sp, Sp,  0,  0, /* 0x08 - 0x0F */
+	 0,  0,  0,  0,  0,  0,  0,  0, /* 0x10 - 0x17 */
+	 0,  0,  0,  0,  0,  0,  0,  0, /* 0x18 - 0x1F */
+	Sp,  0,  0,  0,  0,  0,  0,  0, /* 0x20 - 0x27 */
+	 0,  0,  0,  0,  0,  0,  0,  0, /* 0x28 - 0x2F */
+	 0,  0,  0,  0,  0,  0,  0,  0, /* 0x30 - 0x37 */
+	 0,  0,  0,  0,  0,  0,  0,  0, /* 0x38 - 0x3F */
+	 0,  0,  0,  0,  0,  0,  0,  0, /* 0x40 - 0x47 */
+	 0,  0,  0,  0,  0,  0,  0,  0, /* 0x48 - 0x4F */
+	 0,  0,  0,  0,  0,  0,  0,  0, /* 0x50 - 0x57 */
+	 0,  0,  0,  0,  0,  0,  0,  0, /* 0x58 - 0x5F */
+	 0,  0,  0,  0,  0,  0,  0,  0, /* 0x60 - 0x67 */
+	 0,  0,  0,  0,  0,  0,  0,  0, /* 0x68 - 0x6F */
+	 0,  0,  0,  0,  0,  0,  0,  0, /* 0x70 - 0x77 */
+	 0,  0,  0,  0,  0,  0,  0,  0  /* 0x78 - 0x7F */
+};
+
+/* Basic Latin code points matching the POSIX `isxdigit` function */
+
+static const uint32_t database_basic_latin_isxdigit[128] = {
+	 0,  0,  0,  0,  0,  0,  0,  0, /* 0x00 - 0x07 */
+	 0,  0,  0,  0,  0,  0,  0,  0, /* 0x08 - 0x0F */
+	 0,  0,  0,  0,  0,  0,  0,  0, /* 0x10 - 0x17 */
+	 0,  0,  0,  0,  0,  0,  0,  0, /* 0x18 - 0x1F */
+	 0,  0,  0,  0,  0,  0,  0,  0, /* 0x20 - 0x27 */
+	 0,  0,  0,  0,  0,  0,  0,  0, /* 0x28 - 0x2F */
+	Xd, Xd, Xd, Xd, Xd, Xd, Xd, Xd, /* 0x30 - 0x37 */
+	Xd, Xd,  0,  0,  0,  0,  0,  0, /* 0x38 - 0x3F */
+	 0, Xd, Xd, Xd, Xd, Xd, Xd,  0, /* 0x40 - 0x47 */
+	 0,  0,  0,  0,  0,  0,  0,  0, /* 0x48 - 0x4F */
+	 0,  0,  0,  0,  0,  0,  0,  0, /* 0x50 - 0x57 */
+	 0,  0,  0,  0,  0,  0,  0,  0, /* 0x58 - 0x5F */
+	 0, Xd, Xd, Xd, Xd, Xd, Xd,  0, /* 0x60 - 0x67 */
+	 0,  0,  0,  0,  0,  0,  0,  0, /* 0x68 - 0x6F */
+	 0,  0,  0,  0,  0,  0,  0,  0, /* 0x70 - 0x77 */
+	 0,  0,  0,  0,  0,  0,  0,  0  /* 0x78 - 0x7F */
+};
+
+#undef Bl
+#undef Sp
+#undef Xd
+
+const uint32_t* database_querybasiclatincategory(size_t flags)
+{
+	switch (flags)
+	{
+
+	case UTF8_CATEGORY_ISBLANK:
+		return database_basic_latin_isblank;
+
+	case UTF8_CATEGORY_ISSPACE:
+		return database_basic_latin_isspace;
+
+	case UTF8_CATEGORY_ISXDIGIT:
+		return database_basic_latin_isxdigit;
+
+	default:
+		return database_basic_latin_general_category;
+
+	}
+}
+
 const char* database_querydecomposition(unicode_t codepoint, const uint32_t* index1Array, const uint32_t* index2Array, const uint32_t* dataArray, uint8_t* length)
 {
 	uint32_t index;
@@ -57,6 +197,45 @@ const char* database_querydecomposition(unicode_t codepoint, const uint32_t* ind
 	return CompressedStringData + (data & 0x00FFFFFF);
 }
 
+unicode_t database_querysimplecasemapping(unicode_t codepoint, const uint32_t* dataArray)
+{
+	const SimpleCaseMappingRecord* record = &UnicodeSimpleCaseMappingRecordPtr[PROPERTY_GET_SCM(codepoint)];
+	int32_t delta;
+
+	/* Mappings to more than one code point are not stored as an offset */
+
+	if (dataArray == UppercaseDataPtr)
+	{
+		delta = record->uppercase;
+	}
+	else if (
+		dataArray == LowercaseDataPtr)
+	{
+		delta = record->lowercase;
+	}
+	else if (
+		dataArray == TitlecaseDataPtr)
+	{
+		delta = record->titlecase;
+	}
+	else if (
+		dataArray == CaseFoldingDataPtr)
+	{
+		delta = record->casefolding;
+	}
+	else
+	{
+		return 0;
+	}
+
+	if (delta == 0)
+	{
+		return 0;
+	}
+
+	return (unicode_t)((int32_t)codepoint + delta);
+}
+
 unicode_t database_querycomposition(unicode_t left, unicode_t right)
 {
 	uint64_t key = ((uint64_t)left << 32) + (uint64_t)right;
@@ -52,6 +52,48 @@ enum QuickCheckResult
 	QuickCheckResult_No,
 };
 
+enum GraphemeClusterBreak
+{
+	GraphemeClusterBreak_Other,
+	GraphemeClusterBreak_CR,
+	GraphemeClusterBreak_LF,
+	GraphemeClusterBreak_Control,
+	GraphemeClusterBreak_Extend,
+	GraphemeClusterBreak_ZWJ,
+	GraphemeClusterBreak_RegionalIndicator,
+	GraphemeClusterBreak_Prepend,
+	GraphemeClusterBreak_SpacingMark,
+	GraphemeClusterBreak_L,
+	GraphemeClusterBreak_V,
+	GraphemeClusterBreak_T,
+	GraphemeClusterBreak_LV,
+	GraphemeClusterBreak_LVT,
+	GraphemeClusterBreak_ExtendedPictographic,
+};
+
+enum WordBreak
+{
+	WordBreak_Other,
+	WordBreak_CR,
+	WordBreak_LF,
+	WordBreak_Newline,
+	WordBreak_Extend,
+	WordBreak_ZWJ,
+	WordBreak_RegionalIndicator,
+	WordBreak_Format,
+	WordBreak_Katakana,
+	WordBreak_HebrewLetter,
+	WordBreak_ALetter,
+	WordBreak_SingleQuote,
+	WordBreak_DoubleQuote,
+	WordBreak_MidNumLet,
+	WordBreak_MidLetter,
+	WordBreak_MidNum,
+	WordBreak_Numeric,
+	WordBreak_ExtendNumLet,
+	WordBreak_WSegSpace,
+};
+
 #define PROPERTY_INDEX_SHIFT (5)
 
 static const unicode_t PROPERTY_DATA_MASK = (1 << PROPERTY_INDEX_SHIFT) - 1;
@@ -67,6 +109,12 @@ static const unicode_t PROPERTY_DATA_MASK = (1 << PROPERTY_INDEX_SHIFT) - 1;
 #define PROPERTY_GET_CCC(_cp) \
 	PROPERTY_GET(CanonicalCombiningClassIndexPtr, CanonicalCombiningClassDataPtr, _cp)
 
+#define PROPERTY_GET_LCCC(_cp) \
+	PROPERTY_GET(LeadingCanonicalCombiningClassIndexPtr, LeadingCanonicalCombiningClassDataPtr, _cp)
+
+#define PROPERTY_GET_TCCC(_cp) \
+	PROPERTY_GET(TrailingCanonicalCombiningClassIndexPtr, TrailingCanonicalCombiningClassDataPtr, _cp)
+
 #define PROPERTY_GET_CM(_cp) \
 	PROPERTY_GET(QuickCheckCaseMappedIndexPtr, QuickCheckCaseMappedDataPtr, _cp)
 
@@ -82,10 +130,55 @@ static const unicode_t PROPERTY_DATA_MASK = (1 << PROPERTY_INDEX_SHIFT) - 1;
 #define PROPERTY_GET_NFKD(_cp) \
 	PROPERTY_GET(QuickCheckNFKDIndexPtr, QuickCheckNFKDDataPtr, _cp)
 
+#define PROPERTY_GET_SCM(_cp) \
+	PROPERTY_GET(SimpleCaseMappingIndexPtr, SimpleCaseMappingDataPtr, _cp)
+
+#define PROPERTY_GET_GCB(_cp) \
+	PROPERTY_GET(GraphemeClusterBreakIndexPtr, GraphemeClusterBreakDataPtr, _cp)
+
+#define PROPERTY_GET_WB(_cp) \
+	PROPERTY_GET(WordBreakIndexPtr, WordBreakDataPtr, _cp)
+
+/*!
+	\brief Layout of a compiled #utf8charset_t.
+
+	The data starts with an index of every block of 2048 code points, storing
+	the offset of the bitmap for that block in the same array. Blocks with the
+	same bitmap share their storage.
+*/
+#define CHARSET_INDEX_SHIFT (11)
+#define CHARSET_INDEX_SIZE (0x110000 >> CHARSET_INDEX_SHIFT)
+#define CHARSET_BLOCK_SIZE (1 << (CHARSET_INDEX_SHIFT - 5))
+
+#define CHARSET_GET(_data, _cp) \
+	(((_data)[ \
+		(_data)[(_cp) >> CHARSET_INDEX_SHIFT] + \
+		(((_cp) >> 5) & (CHARSET_BLOCK_SIZE - 1))] >> ((_cp) & 31)) & 1)
+
+/*!
+	\brief General Category of every code point in Basic Latin.
+
+	Used to match Basic Latin code points without decoding them or querying
+	the property tables.
+*/
+extern const uint32_t database_basic_latin_general_category[128];
+
+/*!
+	\brief Table for matching Basic Latin code points against category flags.
+
+	Returns #database_basic_latin_general_category, except for the
+	UTF8_CATEGORY_ISBLANK, UTF8_CATEGORY_ISSPACE and UTF8_CATEGORY_ISXDIGIT
+	flags, which match Basic Latin the same way as their POSIX counterparts.
+	A code point matches when its entry has any of the flags set.
+*/
+const uint32_t* database_querybasiclatincategory(size_t flags);
+
 const char* database_querydecomposition(unicode_t codepoint, const uint32_t* index1Array, const uint32_t* index2Array, const uint32_t* dataArray, uint8_t* length);
 
 unicode_t database_querycomposition(unicode_t left, unicode_t right);
 
+unicode_t database_querysimplecasemapping(unicode_t codepoint, const uint32_t* dataArray);
+
 /*! \endcond */
 
 #endif /* _UTF8REWIND_INTERNAL_DATABASE_H_ */
\ No newline at end of file
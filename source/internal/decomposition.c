@@ -91,6 +91,7 @@ uint8_t decompose_execute(DecomposeState* state)
 
 	/* Set up output */
 
+execute:
 	state->output->current = 0;
 	state->output->index = 0;
 	state->output->stable = 1;
@@ -114,6 +115,13 @@ uint8_t decompose_execute(DecomposeState* state)
 
 				break;
 			}
+			else if (
+				state->output->current == STREAM_BUFFER_MAX)
+			{
+				/* Continue sequence on the next call when the output is full */
+
+				break;
+			}
 
 			*dst_codepoint++ = state->cache_codepoint[state->cache_current];
 			*dst_canonical_combining_class++ = state->cache_canonical_combining_class[state->cache_current];
@@ -135,14 +143,15 @@ uint8_t decompose_execute(DecomposeState* state)
 
 		if (state->input->index == state->input->current)
 		{
-			/* Don't compare canonical combining classes, output will always be stable */
+			/* Cached non-starters are stored in the order they were decomposed */
 
-			return state->output->current;
+			goto end;
 		}
 	}
 
 	/* Read next sequence from input */
 
+read:
 	if (state->input->index == state->input->current &&
 		!stream_read(state->input, state->qc_index, state->qc_data))
 	{
@@ -159,13 +168,31 @@ uint8_t decompose_execute(DecomposeState* state)
 
 	while (state->input->index < state->input->current)
 	{
+		/* Store the rest of the sequence in the cache when the output is full */
+
+		if (state->output->current == STREAM_BUFFER_MAX)
+		{
+			uncached = 0;
+		}
+
 		if (*src_codepoint <= MAX_BASIC_LATIN)
 		{
 			/* Basic Latin codepoints are already decomposed */
 
+			unicode_t basic_latin = *src_codepoint;
+
+			if (state->casefold &&
+				basic_latin >= 0x41 &&
+				basic_latin <= 0x5A)
+			{
+				/* Case folding maps uppercase letters to lowercase */
+
+				basic_latin += 0x20;
+			}
+
 			if (uncached)
 			{
-				*dst_codepoint++ = *src_codepoint;
+				*dst_codepoint++ = basic_latin;
 				*dst_canonical_combining_class++ = CCC_NOT_REORDERED;
 				*dst_quick_check++ = QuickCheckResult_Yes;
 
@@ -173,7 +200,7 @@ uint8_t decompose_execute(DecomposeState* state)
 			}
 			else
 			{
-				state->cache_codepoint[state->cache_filled] = *src_codepoint;
+				state->cache_codepoint[state->cache_filled] = basic_latin;
 				state->cache_canonical_combining_class[state->cache_filled] = CCC_NOT_REORDERED;
 
 				state->cache_filled++;
@@ -243,6 +270,7 @@ uint8_t decompose_execute(DecomposeState* state)
 					decoded_codepoint,
 					state->property_index1, state->property_index2, state->property_data,
 					&src_size);
+				const char* src_start = src;
 
 				while (src_size > 0)
 				{
@@ -256,6 +284,19 @@ uint8_t decompose_execute(DecomposeState* state)
 
 					decoded_canonical_combining_class = PROPERTY_GET_CCC(decoded_codepoint);
 
+					if (state->casefold &&
+						decoded_codepoint == CP_GREEK_SMALL_LETTER_IOTA &&
+						(src != src_start || *src_codepoint == CP_COMBINING_GREEK_YPOGEGRAMMENI))
+					{
+						/*
+							U+0345 COMBINING GREEK YPOGEGRAMMENI is folded to a starter,
+							but the sequence must be reordered using the class of the
+							source code point before the fold is applied
+						*/
+
+						decoded_canonical_combining_class = CCC_IOTA_SUBSCRIPT;
+					}
+
 					/* Check for end of sequence */
 
 					if (uncached &&
@@ -264,6 +305,11 @@ uint8_t decompose_execute(DecomposeState* state)
 					{
 						uncached = 0;
 					}
+					else if (
+						state->output->current == STREAM_BUFFER_MAX)
+					{
+						uncached = 0;
+					}
 
 					if (uncached)
 					{
@@ -317,6 +363,85 @@ uint8_t decompose_execute(DecomposeState* state)
 
 		src_codepoint++;
 		state->input->index++;
+
+		if (state->input->index == state->input->current &&
+			state->input->current < state->input->filled &&
+			state->output->current + state->cache_filled < STREAM_SAFE_MAX)
+		{
+			/*
+				Starters that decompose to a non-starter, like U+0F73, or that
+				are removed entirely, like default ignorable code points when
+				case folding, do not end the sequence. Their non-starters are
+				reordered with the ones before them.
+			*/
+
+			unicode_t next = state->input->codepoint[state->input->current];
+			unicode_t next_decoded = 0;
+			uint8_t next_size = 0;
+			const char* next_decomposed;
+
+			if (next != CP_COMBINING_GRAPHEME_JOINER &&
+				(next < HANGUL_S_FIRST || next > HANGUL_S_LAST) &&
+				PROPERTY_GET(state->qc_index, state->qc_data, next) == QuickCheckResult_No)
+			{
+				next_decomposed = database_querydecomposition(next, state->property_index1, state->property_index2, state->property_data, &next_size);
+				if (next_decomposed != 0)
+				{
+					codepoint_read(next_decomposed, next_size, &next_decoded);
+				}
+
+				if ((next_decomposed == 0 || PROPERTY_GET_CCC(next_decoded) != CCC_NOT_REORDERED) &&
+					stream_read(state->input, state->qc_index, state->qc_data))
+				{
+					src_codepoint = state->input->codepoint + state->input->index;
+				}
+			}
+		}
+	}
+
+	if (state->output->current == 0 &&
+		state->cache_filled == 0)
+	{
+		/* Sequence was removed entirely, e.g. default ignorable code points when case folding */
+
+		goto read;
+	}
+
+end:
+	if (state->strip_marks)
+	{
+		/* Remove nonspacing marks from the decomposed sequence */
+
+		uint8_t kept = 0;
+		uint8_t i;
+
+		for (i = 0; i < state->output->current; ++i)
+		{
+			unicode_t codepoint = state->output->codepoint[i];
+
+			if (codepoint > MAX_BASIC_LATIN &&
+				(PROPERTY_GET_GC(codepoint) & UTF8_CATEGORY_MARK_NON_SPACING) != 0)
+			{
+				continue;
+			}
+
+			state->output->codepoint[kept] = codepoint;
+			state->output->canonical_combining_class[kept] = state->output->canonical_combining_class[i];
+			state->output->quick_check[kept] = state->output->quick_check[i];
+
+			kept++;
+		}
+
+		state->output->current = kept;
+
+		if (kept == 0)
+		{
+			/* Sequence only consisted of nonspacing marks */
+
+			uncached = 1;
+
+			goto execute;
+		}
 	}
 
 	if (state->output->current > 1)
@@ -44,10 +44,12 @@ typedef struct {
 	const uint32_t* property_index1;
 	const uint32_t* property_index2;
 	const uint32_t* property_data;
-	unicode_t cache_codepoint[STREAM_BUFFER_MAX];
-	uint8_t cache_canonical_combining_class[STREAM_BUFFER_MAX];
+	unicode_t cache_codepoint[STREAM_BUFFER_MAX * 2];
+	uint8_t cache_canonical_combining_class[STREAM_BUFFER_MAX * 2];
 	uint8_t cache_current;
 	uint8_t cache_filled;
+	uint8_t casefold;
+	uint8_t strip_marks;
 } DecomposeState;
 
 uint8_t decompose_initialize(DecomposeState* state, StreamState* input, StreamState* output, uint8_t compatibility);
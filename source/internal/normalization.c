@@ -0,0 +1,845 @@
+/*
+	Copyright (C) 2014-2016 Quinten Lansu
+
+	Permission is hereby granted, free of charge, to any person
+	obtaining a copy of this software and associated documentation
+	files (the "Software"), to deal in the Software without
+	restriction, including without limitation the rights to use,
+	copy, modify, merge, publish, distribute, sublicense, and/or
+	sell copies of the Software, and to permit persons to whom the
+	Software is furnished to do so, subject to the following
+	conditions:
+
+	The above copyright notice and this permission notice shall be
+	included in all copies or substantial portions of the Software.
+
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+	EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+	OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+	NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+	HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+	WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+	FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+	OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+#include "normalization.h"
+
+#include "codepoint.h"
+#include "database.h"
+#include "decomposition.h"
+
+#define BASIC_LATIN_BLOCK_HIGH  (0x8080808080808080ULL)
+
+uint8_t normalization_quickcheck(size_t flags, const size_t** propertyIndex, const uint8_t** propertyData)
+{
+	/* The FCD and FCC forms are only defined for canonical equivalence */
+
+	if ((flags & UTF8_NORMALIZE_FAST) != 0 &&
+		(flags & UTF8_NORMALIZE_COMPATIBILITY) != 0)
+	{
+		return 0;
+	}
+
+	if ((flags & UTF8_NORMALIZE_CASEFOLD) != 0)
+	{
+		/* Case folding is only defined for compatibility normalization */
+
+		if ((flags & UTF8_NORMALIZE_COMPATIBILITY) == 0)
+		{
+			return 0;
+		}
+
+		if ((flags & UTF8_NORMALIZE_COMPOSE) != 0)
+		{
+			*propertyIndex = QuickCheckNFKCCasefoldIndexPtr;
+			*propertyData = QuickCheckNFKCCasefoldDataPtr;
+		}
+		else if (
+			(flags & UTF8_NORMALIZE_DECOMPOSE) != 0)
+		{
+			*propertyIndex = QuickCheckNFKDCasefoldIndexPtr;
+			*propertyData = QuickCheckNFKDCasefoldDataPtr;
+		}
+		else
+		{
+			/* Invalid flags */
+
+			return 0;
+		}
+	}
+	else if (
+		(flags & UTF8_NORMALIZE_COMPOSE) != 0)
+	{
+		if ((flags & UTF8_NORMALIZE_COMPATIBILITY) != 0)
+		{
+			*propertyIndex = QuickCheckNFKCIndexPtr;
+			*propertyData = QuickCheckNFKCDataPtr;
+		}
+		else
+		{
+			*propertyIndex = QuickCheckNFCIndexPtr;
+			*propertyData = QuickCheckNFCDataPtr;
+		}
+	}
+	else if (
+		(flags & UTF8_NORMALIZE_DECOMPOSE) != 0)
+	{
+		if ((flags & UTF8_NORMALIZE_COMPATIBILITY) != 0)
+		{
+			*propertyIndex = QuickCheckNFKDIndexPtr;
+			*propertyData = QuickCheckNFKDDataPtr;
+		}
+		else
+		{
+			*propertyIndex = QuickCheckNFDIndexPtr;
+			*propertyData = QuickCheckNFDDataPtr;
+		}
+	}
+	else
+	{
+		/* Invalid flags */
+
+		return 0;
+	}
+
+	return 1;
+}
+
+uint8_t normalization_initialize(NormalizationState* state, size_t flags)
+{
+	memset(state, 0, sizeof(NormalizationState));
+
+	/* Set up codepoint quickcheck property */
+
+	if (!normalization_quickcheck(flags, &state->qc_index, &state->qc_data))
+	{
+		return 0;
+	}
+
+	/* Set up decomposition property */
+
+	if ((flags & UTF8_NORMALIZE_CASEFOLD) != 0)
+	{
+		state->property_index1 = NFKCCasefoldIndex1Ptr;
+		state->property_index2 = NFKCCasefoldIndex2Ptr;
+		state->property_data = NFKCCasefoldDataPtr;
+	}
+	else if (
+		(flags & UTF8_NORMALIZE_COMPATIBILITY) != 0)
+	{
+		state->property_index1 = NFKDIndex1Ptr;
+		state->property_index2 = NFKDIndex2Ptr;
+		state->property_data = NFKDDataPtr;
+	}
+	else
+	{
+		state->property_index1 = NFDIndex1Ptr;
+		state->property_index2 = NFDIndex2Ptr;
+		state->property_data = NFDDataPtr;
+	}
+
+	return 1;
+}
+
+uint8_t normalization_isstable(const NormalizationState* state, unicode_t codepoint)
+{
+	uint8_t quick_check;
+
+	/* Non-starters are reordered with the code points before them */
+
+	if (PROPERTY_GET_CCC(codepoint) != CCC_NOT_REORDERED)
+	{
+		return 0;
+	}
+
+	/*
+		A starter with a quick check value of YES cannot interact with the
+		code points before it, which means the text can be split in front of
+		it without changing the result of normalization.
+	*/
+
+	quick_check = PROPERTY_GET(state->qc_index, state->qc_data, codepoint);
+	if (quick_check == QuickCheckResult_Yes)
+	{
+		return 1;
+	}
+	else if (
+		quick_check == QuickCheckResult_No)
+	{
+		/*
+			A starter that is changed by normalization is stable as well, as
+			long as its decomposition begins with a starter that does not
+			compose with the code point before it.
+		*/
+
+		uint8_t decomposed_length = 0;
+		const char* decomposed = database_querydecomposition(
+			codepoint,
+			state->property_index1, state->property_index2, state->property_data,
+			&decomposed_length);
+
+		if (decomposed != 0 &&
+			decomposed_length > 0)
+		{
+			codepoint_read(decomposed, decomposed_length, &codepoint);
+		}
+		else if (
+			codepoint < HANGUL_S_FIRST ||
+			codepoint > HANGUL_S_LAST)
+		{
+			/* Code points that are removed, like default ignorables when case folding */
+
+			return 0;
+		}
+
+		return
+			PROPERTY_GET_CCC(codepoint) == CCC_NOT_REORDERED &&
+			PROPERTY_GET(state->qc_index, state->qc_data, codepoint) != QuickCheckResult_Maybe;
+	}
+
+	/* Code points with a quick check value of MAYBE may compose with the code point before them */
+
+	return 0;
+}
+
+const char* normalization_boundaryrewind(const NormalizationState* state, const char* inputStart, const char* input, const char* inputEnd)
+{
+	/*
+		Continuation bytes are never the start of a sequence, which means the
+		cursor is always aligned on the start of a code point after skipping
+		them.
+	*/
+
+	while (input > inputStart &&
+		(input == inputEnd || codepoint_decoded_length[(uint8_t)*input] == 0))
+	{
+		input--;
+	}
+
+	while (input > inputStart)
+	{
+		unicode_t decoded;
+
+		/* Check if code point at the cursor is stable */
+
+		if (codepoint_read(input, (size_t)(inputEnd - input), &decoded) > 0 &&
+			normalization_isstable(state, decoded))
+		{
+			break;
+		}
+
+		/* Move cursor to the start of the previous sequence */
+
+		do
+		{
+			input--;
+		}
+		while (
+			input > inputStart &&
+			codepoint_decoded_length[(uint8_t)*input] == 0);
+	}
+
+	return input;
+}
+
+const char* normalization_boundaryforward(const NormalizationState* state, const char* input, const char* inputEnd)
+{
+	/* Move cursor past the rest of the current sequence */
+
+	while (input < inputEnd &&
+		codepoint_decoded_length[(uint8_t)*input] == 0)
+	{
+		input++;
+	}
+
+	while (input < inputEnd)
+	{
+		unicode_t decoded;
+
+		/* Check if code point at the cursor is stable */
+
+		uint8_t decoded_size = codepoint_read(input, (size_t)(inputEnd - input), &decoded);
+		if (decoded_size == 0 ||
+			normalization_isstable(state, decoded))
+		{
+			break;
+		}
+
+		/* Move cursor to the next sequence */
+
+		if (decoded_size >= (size_t)(inputEnd - input))
+		{
+			input = inputEnd;
+
+			break;
+		}
+
+		input += decoded_size;
+	}
+
+	return input;
+}
+
+const char* normalization_segmentend(const NormalizationState* state, const char* input, const char* inputEnd)
+{
+	const char* last = inputEnd;
+
+	if (input >= inputEnd)
+	{
+		return input;
+	}
+
+	/* Find the start of the last sequence */
+
+	do
+	{
+		last--;
+	}
+	while (
+		last > input &&
+		codepoint_decoded_length[(uint8_t)*last] == 0);
+
+	/* Exclude an encoded sequence that could still be completed by more input */
+
+	if (codepoint_decoded_length[(uint8_t)*last] > (size_t)(inputEnd - last))
+	{
+		inputEnd = last;
+	}
+
+	/*
+		The last stable code point could still interact with the code points
+		that follow it, which means the segment must end in front of it.
+	*/
+
+	return normalization_boundaryrewind(state, input, inputEnd, inputEnd);
+}
+
+static void normalization_decomposeinitialize(DecomposeState* state, StreamState* input, StreamState* output, const char* src, size_t srcSize, size_t flags)
+{
+	stream_initialize(input, src, srcSize);
+
+	decompose_initialize(state, input, output, (flags & UTF8_NORMALIZE_COMPATIBILITY) != 0);
+
+	if ((flags & UTF8_NORMALIZE_CASEFOLD) != 0)
+	{
+		state->qc_index = QuickCheckNFKDCasefoldIndexPtr;
+		state->qc_data = QuickCheckNFKDCasefoldDataPtr;
+
+		state->property_index1 = NFKCCasefoldIndex1Ptr;
+		state->property_index2 = NFKCCasefoldIndex2Ptr;
+		state->property_data = NFKCCasefoldDataPtr;
+
+		state->casefold = 1;
+	}
+}
+
+int normalization_compare(const char* left, size_t leftSize, const char* right, size_t rightSize, size_t flags)
+{
+	NormalizationState state;
+	StreamState stream[4];
+	DecomposeState decompose_state[2];
+	uint8_t finished[2] = { 0, 0 };
+	size_t common = 0;
+	uint8_t i;
+
+	/* Skip the bytes that are identical in both strings */
+
+	while (common < leftSize &&
+		common < rightSize &&
+		left[common] == right[common])
+	{
+		common++;
+	}
+
+	if (common == leftSize &&
+		common == rightSize)
+	{
+		return 0;
+	}
+
+	/* Move back to the start of a code point on both sides */
+
+	while (common > 0 &&
+		((common < leftSize && codepoint_decoded_length[(uint8_t)left[common]] == 0) ||
+		(common < rightSize && codepoint_decoded_length[(uint8_t)right[common]] == 0)))
+	{
+		common--;
+	}
+
+	/*
+		The code points before the cursor are the same in both strings, which
+		means both can be decomposed from the last stable code point in front
+		of it.
+	*/
+
+	normalization_initialize(&state, flags | UTF8_NORMALIZE_DECOMPOSE);
+
+	common = (size_t)(normalization_boundaryrewind(&state, left, left + common, left + common) - left);
+
+	/* Decompose both strings side by side */
+
+	normalization_decomposeinitialize(&decompose_state[0], &stream[0], &stream[1], left + common, leftSize - common, flags);
+	normalization_decomposeinitialize(&decompose_state[1], &stream[2], &stream[3], right + common, rightSize - common, flags);
+
+	while (1)
+	{
+		StreamState* left_output = &stream[1];
+		StreamState* right_output = &stream[3];
+
+		/* Decompose the next sequence on either side that ran out of code points */
+
+		for (i = 0; i < 2; ++i)
+		{
+			StreamState* output = &stream[i * 2 + 1];
+
+			if (!finished[i] &&
+				output->index == output->current)
+			{
+				if (!decompose_execute(&decompose_state[i]))
+				{
+					output->index = 0;
+					output->current = 0;
+
+					finished[i] = 1;
+				}
+				else if (
+					!output->stable)
+				{
+					stream_reorder(output);
+				}
+			}
+		}
+
+		if (left_output->index == left_output->current ||
+			right_output->index == right_output->current)
+		{
+			/* The string that ends first is ordered first */
+
+			if (finished[0] &&
+				left_output->index == left_output->current)
+			{
+				if (right_output->index < right_output->current)
+				{
+					return -1;
+				}
+				else if (
+					finished[1])
+				{
+					return 0;
+				}
+			}
+			else if (
+				finished[1] &&
+				right_output->index == right_output->current)
+			{
+				return 1;
+			}
+
+			continue;
+		}
+
+		/* Compare decomposed code points until the first difference */
+
+		while (left_output->index < left_output->current &&
+			right_output->index < right_output->current)
+		{
+			unicode_t left_codepoint = left_output->codepoint[left_output->index++];
+			unicode_t right_codepoint = right_output->codepoint[right_output->index++];
+
+			if (left_codepoint != right_codepoint)
+			{
+				return (left_codepoint < right_codepoint) ? -1 : 1;
+			}
+		}
+	}
+}
+
+uint64_t normalization_hash(const char* input, size_t inputSize, size_t flags)
+{
+	StreamState stream[2];
+	DecomposeState decompose_state;
+	const uint8_t* src = (const uint8_t*)input;
+	const uint8_t* src_end = src + inputSize;
+	uint64_t hash = CODEPOINT_HASH_INITIAL;
+
+	while (src < src_end)
+	{
+		const uint8_t* sequence;
+
+		/*
+			Basic Latin code points are starters that decompose to themselves,
+			but the starter in front of other code points is decomposed with
+			them to insert COMBINING GRAPHEME JOINER at the same position.
+		*/
+
+		if (*src <= MAX_BASIC_LATIN &&
+			(src + 1 == src_end || src[1] <= MAX_BASIC_LATIN))
+		{
+			uint8_t lead = *src++;
+
+			if ((flags & UTF8_NORMALIZE_CASEFOLD) != 0 &&
+				lead >= 'A' &&
+				lead <= 'Z')
+			{
+				lead += 0x20;
+			}
+
+			hash = CODEPOINT_HASH(hash, lead);
+
+			continue;
+		}
+
+		/* Decompose the code points up to the next Basic Latin code point */
+
+		sequence = src++;
+
+		while (src < src_end &&
+			*src > MAX_BASIC_LATIN)
+		{
+			src++;
+		}
+
+		normalization_decomposeinitialize(&decompose_state, &stream[0], &stream[1], (const char*)sequence, (size_t)(src - sequence), flags);
+
+		while (decompose_execute(&decompose_state))
+		{
+			uint8_t i;
+
+			if (!stream[1].stable)
+			{
+				stream_reorder(&stream[1]);
+			}
+
+			for (i = 0; i < stream[1].current; ++i)
+			{
+				hash = CODEPOINT_HASH(hash, stream[1].codepoint[i]);
+			}
+		}
+	}
+
+	return codepoint_hashfinalize(hash);
+}
+
+typedef struct {
+	const char* needle;
+	size_t needle_size;
+	size_t flags;
+	const unicode_t* pattern;
+	size_t pattern_size;
+	uint8_t pattern_complete;
+	size_t index;
+	size_t skip;
+	uint8_t started;
+	StreamState stream[2];
+	DecomposeState decompose_state;
+} NormalizationNeedleState;
+
+static uint8_t normalization_readneedle(NormalizationNeedleState* state, unicode_t* codepoint)
+{
+	/* Most needles are read from the pattern decomposed in advance */
+
+	if (state->index < state->pattern_size)
+	{
+		*codepoint = state->pattern[state->index++];
+
+		return 1;
+	}
+	else if (
+		state->pattern_complete)
+	{
+		return 0;
+	}
+
+	/* Decompose the needle again to read the code points after the pattern */
+
+	if (!state->started)
+	{
+		normalization_decomposeinitialize(&state->decompose_state, &state->stream[0], &state->stream[1], state->needle, state->needle_size, state->flags);
+
+		state->skip = state->pattern_size;
+		state->started = 1;
+	}
+
+	while (1)
+	{
+		while (state->stream[1].index == state->stream[1].current)
+		{
+			if (!decompose_execute(&state->decompose_state))
+			{
+				return 0;
+			}
+
+			if (!state->stream[1].stable)
+			{
+				stream_reorder(&state->stream[1]);
+			}
+		}
+
+		*codepoint = state->stream[1].codepoint[state->stream[1].index++];
+
+		if (state->skip == 0)
+		{
+			return 1;
+		}
+
+		state->skip--;
+	}
+}
+
+static size_t normalization_matchprefix(const NormalizationState* state, NormalizationNeedleState* needleState, const char* input, size_t inputSize)
+{
+	StreamState stream[2];
+	DecomposeState decompose_state;
+	const char* src = input;
+	const char* src_end = input + inputSize;
+	unicode_t needle_codepoint;
+
+	needleState->index = 0;
+	needleState->started = 0;
+
+	if (!normalization_readneedle(needleState, &needle_codepoint))
+	{
+		return 0;
+	}
+
+	while (src < src_end)
+	{
+		const char* segment;
+
+		/* Basic Latin followed by Basic Latin is a segment on its own */
+
+		if ((uint8_t)*src <= MAX_BASIC_LATIN &&
+			(src + 1 == src_end || (uint8_t)src[1] <= MAX_BASIC_LATIN))
+		{
+			unicode_t basic_latin = (uint8_t)*src++;
+
+			if ((needleState->flags & UTF8_NORMALIZE_CASEFOLD) != 0 &&
+				basic_latin >= 0x41 &&
+				basic_latin <= 0x5A)
+			{
+				basic_latin += 0x20;
+			}
+
+			if (basic_latin != needle_codepoint)
+			{
+				return 0;
+			}
+
+			if (!normalization_readneedle(needleState, &needle_codepoint))
+			{
+				return (size_t)(src - input);
+			}
+
+			continue;
+		}
+
+		/*
+			Decompose the code points up to the next stable code point, which
+			is decomposed the same way regardless of the code points before it.
+		*/
+
+		segment = src;
+		src = normalization_boundaryforward(state, src + 1, src_end);
+
+		if (codepoint_decoded_length[(uint8_t)*segment] == (size_t)(src - segment))
+		{
+			/* Code points that are not changed by decomposition are compared directly */
+
+			unicode_t decoded;
+
+			if (codepoint_read(segment, (size_t)(src - segment), &decoded) > 0 &&
+				PROPERTY_GET(state->qc_index, state->qc_data, decoded) == QuickCheckResult_Yes)
+			{
+				if (decoded != needle_codepoint)
+				{
+					return 0;
+				}
+
+				if (!normalization_readneedle(needleState, &needle_codepoint))
+				{
+					return (size_t)(src - input);
+				}
+
+				continue;
+			}
+		}
+
+		normalization_decomposeinitialize(&decompose_state, &stream[0], &stream[1], segment, (size_t)(src - segment), needleState->flags);
+
+		while (decompose_execute(&decompose_state))
+		{
+			if (!stream[1].stable)
+			{
+				stream_reorder(&stream[1]);
+			}
+
+			while (stream[1].index < stream[1].current)
+			{
+				if (stream[1].codepoint[stream[1].index++] != needle_codepoint)
+				{
+					return 0;
+				}
+
+				if (!normalization_readneedle(needleState, &needle_codepoint))
+				{
+					/* The match must end on the end of a segment */
+
+					if (stream[1].index < stream[1].current ||
+						decompose_execute(&decompose_state))
+					{
+						return 0;
+					}
+
+					return (size_t)(src - input);
+				}
+			}
+		}
+	}
+
+	/* Input ended before the needle */
+
+	return 0;
+}
+
+const char* normalization_search(const char* input, size_t inputSize, const char* needle, size_t needleSize, size_t flags, size_t* matchSize)
+{
+	NormalizationState state;
+	NormalizationNeedleState needle_state;
+	unicode_t pattern[NORMALIZATION_SEARCH_PATTERN_SIZE];
+	const char* src = input;
+	const char* src_end = input + inputSize;
+	size_t matched = 0;
+	unicode_t first;
+
+	normalization_initialize(&state, flags | UTF8_NORMALIZE_DECOMPOSE);
+
+	/* Decompose the start of the needle only once */
+
+	memset(&needle_state, 0, sizeof(NormalizationNeedleState));
+	needle_state.needle = needle;
+	needle_state.needle_size = needleSize;
+	needle_state.flags = flags;
+	needle_state.pattern = pattern;
+	needle_state.pattern_complete = 1;
+
+	normalization_decomposeinitialize(&needle_state.decompose_state, &needle_state.stream[0], &needle_state.stream[1], needle, needleSize, flags);
+
+	while (needle_state.pattern_complete &&
+		decompose_execute(&needle_state.decompose_state))
+	{
+		StreamState* output = &needle_state.stream[1];
+
+		if (!output->stable)
+		{
+			stream_reorder(output);
+		}
+
+		while (output->index < output->current)
+		{
+			if (needle_state.pattern_size == NORMALIZATION_SEARCH_PATTERN_SIZE)
+			{
+				needle_state.pattern_complete = 0;
+
+				break;
+			}
+
+			pattern[needle_state.pattern_size++] = output->codepoint[output->index++];
+		}
+	}
+
+	if (needle_state.pattern_size == 0)
+	{
+		/* Needle was removed entirely, e.g. default ignorable code points when case folding */
+
+		goto found;
+	}
+
+	first = pattern[0];
+
+	while (src < src_end)
+	{
+		uint8_t lead = (uint8_t)*src;
+		uint8_t length = 1;
+		uint8_t candidate;
+
+		if (lead <= MAX_BASIC_LATIN)
+		{
+			if (first > MAX_BASIC_LATIN)
+			{
+				/* Skip Basic Latin in blocks, it is never changed by decomposition */
+
+				while ((size_t)(src_end - src) >= 8)
+				{
+					uint64_t block;
+					memcpy(&block, src, 8);
+
+					if ((block & BASIC_LATIN_BLOCK_HIGH) != 0)
+					{
+						break;
+					}
+
+					src += 8;
+				}
+
+				while (src < src_end &&
+					(uint8_t)*src <= MAX_BASIC_LATIN)
+				{
+					src++;
+				}
+
+				continue;
+			}
+
+			if ((flags & UTF8_NORMALIZE_CASEFOLD) != 0 &&
+				lead >= 0x41 &&
+				lead <= 0x5A)
+			{
+				lead += 0x20;
+			}
+
+			candidate = lead == first;
+		}
+		else if (
+			codepoint_decoded_length[lead] == 0)
+		{
+			/* Continuation bytes are not the start of a code point */
+
+			candidate = 0;
+		}
+		else
+		{
+			unicode_t decoded;
+
+			length = codepoint_read(src, (size_t)(src_end - src), &decoded);
+
+			/*
+				A match can only start on a stable code point. Code points that
+				are not changed by decomposition must be equal to the start of
+				the needle.
+			*/
+
+			candidate =
+				normalization_isstable(&state, decoded) &&
+				(decoded == first || PROPERTY_GET(state.qc_index, state.qc_data, decoded) != QuickCheckResult_Yes);
+		}
+
+		if (candidate &&
+			(matched = normalization_matchprefix(&state, &needle_state, src, (size_t)(src_end - src))) > 0)
+		{
+			goto found;
+		}
+
+		src += (length > 0) ? length : 1;
+	}
+
+	return 0;
+
+found:
+	if (matchSize != 0)
+	{
+		*matchSize = matched;
+	}
+
+	return src;
+}
\ No newline at end of file
@@ -0,0 +1,68 @@
+/*
+	Copyright (C) 2014-2016 Quinten Lansu
+
+	Permission is hereby granted, free of charge, to any person
+	obtaining a copy of this software and associated documentation
+	files (the "Software"), to deal in the Software without
+	restriction, including without limitation the rights to use,
+	copy, modify, merge, publish, distribute, sublicense, and/or
+	sell copies of the Software, and to permit persons to whom the
+	Software is furnished to do so, subject to the following
+	conditions:
+
+	The above copyright notice and this permission notice shall be
+	included in all copies or substantial portions of the Software.
+
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+	EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+	OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+	NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+	HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+	WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+	FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+	OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+#ifndef _UTF8REWIND_INTERNAL_NORMALIZATION_H_
+#define _UTF8REWIND_INTERNAL_NORMALIZATION_H_
+
+/*!
+	\file
+	\brief Normalization interface.
+
+	\cond INTERNAL
+*/
+
+#include "utf8rewind.h"
+
+typedef struct {
+	const size_t* qc_index;
+	const uint8_t* qc_data;
+	const uint32_t* property_index1;
+	const uint32_t* property_index2;
+	const uint32_t* property_data;
+} NormalizationState;
+
+#define NORMALIZATION_SEARCH_PATTERN_SIZE 32
+
+uint8_t normalization_quickcheck(size_t flags, const size_t** propertyIndex, const uint8_t** propertyData);
+
+uint8_t normalization_initialize(NormalizationState* state, size_t flags);
+
+uint8_t normalization_isstable(const NormalizationState* state, unicode_t codepoint);
+
+const char* normalization_boundaryrewind(const NormalizationState* state, const char* inputStart, const char* input, const char* inputEnd);
+
+const char* normalization_boundaryforward(const NormalizationState* state, const char* input, const char* inputEnd);
+
+const char* normalization_segmentend(const NormalizationState* state, const char* input, const char* inputEnd);
+
+int normalization_compare(const char* left, size_t leftSize, const char* right, size_t rightSize, size_t flags);
+
+uint64_t normalization_hash(const char* input, size_t inputSize, size_t flags);
+
+const char* normalization_search(const char* input, size_t inputSize, const char* needle, size_t needleSize, size_t flags, size_t* matchSize);
+
+/*! \endcond */
+
+#endif /* _UTF8REWIND_INTERNAL_NORMALIZATION_H_ */
\ No newline at end of file
@@ -27,6 +27,8 @@
 
 #include "codepoint.h"
 
+#define BASIC_LATIN_BLOCK_HIGH  (0x8080808080808080ULL)
+
 const char* seeking_forward(const char* input, const char* inputEnd, size_t inputSize, off_t offset)
 {
 	if (inputEnd <= input ||  /* Swapped parameters */
@@ -43,9 +45,29 @@ const char* seeking_forward(const char* input, const char* inputEnd, size_t inpu
 
 	do
 	{
+		uint8_t codepoint_length;
+
+		/* Skip eight Basic Latin code points at a time */
+
+		while ((uint8_t)*input < 0x80 &&
+			offset > 8 &&
+			inputEnd - input > 8)
+		{
+			uint64_t block;
+			memcpy(&block, input, 8);
+
+			if ((block & BASIC_LATIN_BLOCK_HIGH) != 0)
+			{
+				break;
+			}
+
+			input += 8;
+			offset -= 8;
+		}
+
 		/* Get decoded length of next sequence */
 
-		uint8_t codepoint_length = codepoint_decoded_length[(uint8_t)*input];
+		codepoint_length = codepoint_decoded_length[(uint8_t)*input];
 
 		if (codepoint_length > 1 &&
 			codepoint_length < 7)
@@ -103,6 +125,95 @@ const char* seeking_rewind(const char* inputStart, const char* input, size_t inp
 
 	do
 	{
+		/* Step over well-formed data without the marker when it is not reading a sequence */
+
+		if (marker == input - 1 &&
+			marker_valid == marker &&
+			input - inputStart > 8)
+		{
+			if ((uint8_t)*marker < 0x80)
+			{
+				uint64_t block;
+				memcpy(&block, input - 8, 8);
+
+				if (offset <= -8 &&
+					(block & BASIC_LATIN_BLOCK_HIGH) == 0)
+				{
+					/* Skip eight Basic Latin code points at a time */
+
+					input -= 8;
+					offset += 7;
+				}
+				else
+				{
+					input--;
+				}
+
+				marker = input - 1;
+				marker_valid = marker;
+
+				continue;
+			}
+			else
+			{
+				/* Step over well-formed sequences one at a time */
+
+				const char* sequence_end = input;
+
+				while (input - inputStart > 8)
+				{
+					const char* lead = input - 1;
+					uint8_t codepoint_length;
+
+					/* Leave runs of Basic Latin to the block skip */
+
+					if (((uint8_t)lead[0] | (uint8_t)lead[-1]) < 0x80)
+					{
+						break;
+					}
+
+					/* Find the start of the sequence */
+
+					while (((uint8_t)*lead & 0xC0) == 0x80 &&
+						input - lead < 4)
+					{
+						lead--;
+					}
+
+					codepoint_length = codepoint_decoded_length[(uint8_t)*lead];
+
+					if (codepoint_length < 1 ||
+						codepoint_length > 6 ||
+						input - lead > codepoint_length)
+					{
+						break;
+					}
+
+					/* The last sequence is counted by the loop condition */
+
+					if (input != sequence_end)
+					{
+						offset++;
+					}
+
+					input = lead;
+
+					if (offset == -1)
+					{
+						break;
+					}
+				}
+
+				if (input != sequence_end)
+				{
+					marker = input - 1;
+					marker_valid = marker;
+
+					continue;
+				}
+			}
+		}
+
 		/* Move the cursor */
 
 		input--;
@@ -184,4 +295,496 @@ const char* seeking_rewind(const char* inputStart, const char* input, size_t inp
 		++offset < 0);
 
 	return input;
+}
+
+static const char* seeking_next(const char* input, const char* inputEnd)
+{
+	/* Move past the next sequence the same way as seeking_forward */
+
+	uint8_t codepoint_length = codepoint_decoded_length[(uint8_t)*input];
+
+	if (codepoint_length > 1 &&
+		codepoint_length < 7)
+	{
+		uint8_t i;
+
+		for (i = 0; i < codepoint_length; ++i)
+		{
+			input++;
+
+			if (input == inputEnd ||
+				codepoint_decoded_length[(uint8_t)*input] != 0)
+			{
+				break;
+			}
+		}
+	}
+	else
+	{
+		input++;
+	}
+
+	return input;
+}
+
+size_t seeking_indexappend(utf8seekindex_t* index, const char* inputStart, const char* inputEnd)
+{
+	const char* src = inputStart + index->size;
+
+	while (src < inputEnd)
+	{
+		const char* next;
+
+		/* Store the offset of every code point on an interval */
+
+		if ((index->length % index->interval) == 0 &&
+			index->length / index->interval == index->count)
+		{
+			if (index->count == index->offsets_size)
+			{
+				break;
+			}
+
+			index->offsets[index->count++] = (size_t)(src - inputStart);
+		}
+
+		/*
+			A sequence cut off by the end of the input is only counted when
+			the rest of it is appended, otherwise it would be split in two.
+		*/
+
+		next = seeking_next(src, inputEnd);
+		if (next == inputEnd &&
+			(size_t)(next - src) < codepoint_decoded_length[(uint8_t)*src] &&
+			codepoint_decoded_length[(uint8_t)*src] < 7)
+		{
+			break;
+		}
+
+		src = next;
+		index->length++;
+	}
+
+	index->size = (size_t)(src - inputStart);
+
+	return index->length;
+}
+
+size_t seeking_indexposition(const utf8seekindex_t* index, const char* inputStart, const char* input)
+{
+	size_t offset = (size_t)(input - inputStart);
+	size_t low = 0;
+	size_t high = index->count;
+	size_t position;
+	const char* src;
+
+	if (index->count == 0)
+	{
+		position = 0;
+		src = inputStart;
+	}
+	else
+	{
+		/* Find the last entry at or before the offset */
+
+		while (high - low > 1)
+		{
+			size_t middle = low + (high - low) / 2;
+
+			if (index->offsets[middle] <= offset)
+			{
+				low = middle;
+			}
+			else
+			{
+				high = middle;
+			}
+		}
+
+		position = low * index->interval;
+		src = inputStart + index->offsets[low];
+	}
+
+	/* Count the remaining code points */
+
+	while (src < input)
+	{
+		src = seeking_next(src, input);
+		position++;
+	}
+
+	return position;
+}
+
+const char* seeking_indexforward(const utf8seekindex_t* index, const char* inputStart, const char* inputEnd, size_t position)
+{
+	size_t entry;
+	const char* src;
+
+	if (index->count == 0)
+	{
+		return seeking_forward(inputStart, inputEnd, (size_t)(inputEnd - inputStart), (off_t)position);
+	}
+
+	/* Start from the closest entry before the position */
+
+	entry = position / index->interval;
+	if (entry >= index->count)
+	{
+		entry = index->count - 1;
+	}
+
+	src = inputStart + index->offsets[entry];
+	if (src >= inputEnd)
+	{
+		return inputEnd;
+	}
+
+	return seeking_forward(src, inputEnd, (size_t)(inputEnd - src), (off_t)(position - entry * index->interval));
+}
+
+size_t seeking_indexwrite(const utf8seekindex_t* index, char* target)
+{
+	size_t i;
+
+	/* Every value is stored as a 64-bit little-endian integer */
+
+	for (i = 0; i < index->count + 4; ++i)
+	{
+		uint64_t value;
+		uint8_t j;
+
+		switch (i)
+		{
+
+		case 0:
+			value = index->interval;
+			break;
+
+		case 1:
+			value = index->count;
+			break;
+
+		case 2:
+			value = index->length;
+			break;
+
+		case 3:
+			value = index->size;
+			break;
+
+		default:
+			value = index->offsets[i - 4];
+			break;
+
+		}
+
+		for (j = 0; j < 8; ++j)
+		{
+			*target++ = (char)(value & 0xFF);
+			value >>= 8;
+		}
+	}
+
+	return SEEKING_INDEX_HEADER_SIZE + index->count * 8;
+}
+
+uint8_t seeking_indexread(utf8seekindex_t* index, const char* input, size_t inputSize)
+{
+	size_t i;
+
+	if (inputSize < SEEKING_INDEX_HEADER_SIZE)
+	{
+		return 0;
+	}
+
+	for (i = 0; i * 8 < inputSize; ++i)
+	{
+		uint64_t value = 0;
+		uint8_t j;
+
+		for (j = 8; j > 0; --j)
+		{
+			value = (value << 8) | (uint8_t)input[i * 8 + j - 1];
+		}
+
+		if (value > (uint64_t)SIZE_MAX)
+		{
+			return 0;
+		}
+
+		switch (i)
+		{
+
+		case 0:
+			index->interval = (size_t)value;
+			break;
+
+		case 1:
+			index->count = (size_t)value;
+			break;
+
+		case 2:
+			index->length = (size_t)value;
+			break;
+
+		case 3:
+			index->size = (size_t)value;
+
+			/* The stored entries must fit in the input and the offsets array */
+
+			if (index->interval == 0 ||
+				index->count > index->offsets_size ||
+				index->count > (inputSize - SEEKING_INDEX_HEADER_SIZE) / 8 ||
+				inputSize != SEEKING_INDEX_HEADER_SIZE + index->count * 8 ||
+				(index->count == 0 && (index->length > 0 || index->size > 0)) ||
+				index->count > index->length / index->interval + 1)
+			{
+				return 0;
+			}
+
+			break;
+
+		default:
+			index->offsets[i - 4] = (size_t)value;
+
+			/* Offsets start at zero and are strictly increasing */
+
+			if ((i == 4 && value != 0) ||
+				(i > 4 && value <= index->offsets[i - 5]) ||
+				value > index->size)
+			{
+				return 0;
+			}
+
+			break;
+
+		}
+	}
+
+	return 1;
+}
+
+static const char* seeking_linenext(const char* input, const char* inputEnd, utf8position_t* position)
+{
+	unicode_t decoded;
+	uint8_t decoded_size = codepoint_read(input, (size_t)(inputEnd - input), &decoded);
+	size_t units;
+
+	/* Code points outside the Basic Multilingual Plane are encoded as a surrogate pair */
+
+	units = (decoded <= MAX_BASIC_MULTILINGUAL_PLANE) ? 1 : 2;
+
+	position->offset += decoded_size;
+	position->codepoint++;
+	position->utf16 += units;
+
+	/* Lines end on LF, CR LF or a single CR */
+
+	if (decoded == 0x0A ||
+		(decoded == 0x0D && (input + 1 == inputEnd || input[1] != 0x0A)))
+	{
+		position->line++;
+		position->column = 0;
+	}
+	else
+	{
+		position->column += units;
+	}
+
+	return input + decoded_size;
+}
+
+static uint8_t seeking_linebefore(const utf8position_t* position, const utf8position_t* target, size_t unit)
+{
+	switch (unit)
+	{
+
+	case UTF8_POSITION_CODEPOINT:
+		return position->codepoint <= target->codepoint;
+
+	case UTF8_POSITION_UTF16:
+		return position->utf16 <= target->utf16;
+
+	case UTF8_POSITION_LINE:
+		return
+			position->line < target->line ||
+			(position->line == target->line && position->column <= target->column);
+
+	default:
+		return position->offset <= target->offset;
+
+	}
+}
+
+static size_t seeking_linesearch(const utf8lineindex_t* index, size_t unit, const utf8position_t* target)
+{
+	size_t low = 0;
+	size_t high = index->count;
+
+	/* Find the last mark at or before the target */
+
+	while (high - low > 1)
+	{
+		size_t middle = low + (high - low) / 2;
+
+		if (seeking_linebefore(&index->marks[middle], target, unit))
+		{
+			low = middle;
+		}
+		else
+		{
+			high = middle;
+		}
+	}
+
+	return low;
+}
+
+static void seeking_lineshift(utf8position_t* position, const utf8position_t* from, const utf8position_t* to, size_t removedSize, size_t insertedSize)
+{
+	/* Columns only change on the line of the edit */
+
+	if (position->line == from->line)
+	{
+		position->column = position->column - from->column + to->column;
+	}
+
+	position->offset = position->offset - removedSize + insertedSize;
+	position->codepoint = position->codepoint - from->codepoint + to->codepoint;
+	position->utf16 = position->utf16 - from->utf16 + to->utf16;
+	position->line = position->line - from->line + to->line;
+}
+
+uint8_t seeking_lineupdate(utf8lineindex_t* index, const char* inputStart, const char* inputEnd, size_t editOffset, size_t removedSize, size_t insertedSize)
+{
+	utf8position_t* marks = index->marks;
+	utf8position_t target;
+	utf8position_t position;
+	utf8position_t last;
+	const char* src;
+	size_t count;
+	size_t tail_start;
+	size_t tail_count;
+	uint8_t result = 1;
+
+	/*
+		Marks before the edit are kept. The mark that starts the scan must come
+		before the edit, because a changed byte after it can change both the
+		sequence and the line ending in front of it.
+	*/
+
+	target.offset = (editOffset > 0) ? editOffset - 1 : 0;
+	count = seeking_linesearch(index, UTF8_POSITION_OFFSET, &target) + 1;
+
+	/* Marks after the edit are moved out of the way until they can be shifted */
+
+	target.offset = editOffset + removedSize;
+	tail_count = index->count - (seeking_linesearch(index, UTF8_POSITION_OFFSET, &target) + 1);
+	tail_start = index->marks_size - tail_count;
+
+	memmove(marks + tail_start, marks + index->count - tail_count, tail_count * sizeof(utf8position_t));
+
+	index->count = count;
+
+	/* Scan the text from the last mark before the edit */
+
+	position = marks[count - 1];
+	last = position;
+	src = inputStart + position.offset;
+
+	while (src < inputEnd)
+	{
+		src = seeking_linenext(src, inputEnd, &position);
+
+		/* Drop marks that were moved or removed by the edit */
+
+		while (tail_count > 0 &&
+			marks[tail_start].offset - removedSize + insertedSize < position.offset)
+		{
+			tail_start++;
+			tail_count--;
+		}
+
+		if (tail_count > 0 &&
+			marks[tail_start].offset - removedSize + insertedSize == position.offset)
+		{
+			/* The rest of the text is unchanged, shift the remaining marks */
+
+			utf8position_t from = marks[tail_start];
+			size_t i;
+
+			for (i = tail_start; i < tail_start + tail_count; ++i)
+			{
+				seeking_lineshift(&marks[i], &from, &position, removedSize, insertedSize);
+			}
+
+			seeking_lineshift(&index->end, &from, &position, removedSize, insertedSize);
+
+			memmove(marks + count, marks + tail_start, tail_count * sizeof(utf8position_t));
+			index->count = count + tail_count;
+
+			return result;
+		}
+
+		/* Add a mark at the start of every line and on every interval, but not inside CR LF */
+
+		if (position.line != last.line ||
+			(position.codepoint - last.codepoint >= index->interval && src[-1] != 0x0D))
+		{
+			if (count == tail_start)
+			{
+				result = 0;
+
+				continue;
+			}
+
+			marks[count++] = position;
+			last = position;
+		}
+	}
+
+	index->count = count;
+	index->end = position;
+
+	return result;
+}
+
+uint8_t seeking_linefind(const utf8lineindex_t* index, const char* inputStart, const char* inputEnd, size_t unit, utf8position_t* position)
+{
+	utf8position_t target = *position;
+	const char* src;
+
+	/* Start from the closest mark */
+
+	*position = index->marks[seeking_linesearch(index, unit, &target)];
+	src = inputStart + position->offset;
+
+	while (src < inputEnd)
+	{
+		utf8position_t next = *position;
+		const char* next_src;
+
+		/* Columns past the end of a line resolve to the end of the line */
+
+		if (unit == UTF8_POSITION_LINE &&
+			position->line == target.line &&
+			(*src == 0x0A || *src == 0x0D))
+		{
+			break;
+		}
+
+		next_src = seeking_linenext(src, inputEnd, &next);
+		if (!seeking_linebefore(&next, &target, unit))
+		{
+			break;
+		}
+
+		*position = next;
+		src = next_src;
+	}
+
+	/* Check if the position was found exactly */
+
+	return seeking_linebefore(&target, position, unit);
 }
\ No newline at end of file
@@ -39,6 +39,26 @@ const char* seeking_forward(const char* input, const char* inputEnd, size_t inpu
 
 const char* seeking_rewind(const char* inputStart, const char* input, size_t inputSize, off_t offset);
 
+/*!
+	\def SEEKING_INDEX_HEADER_SIZE
+	\brief Size in bytes of the header of a serialized seek index.
+*/
+#define SEEKING_INDEX_HEADER_SIZE  32
+
+size_t seeking_indexappend(utf8seekindex_t* index, const char* inputStart, const char* inputEnd);
+
+size_t seeking_indexposition(const utf8seekindex_t* index, const char* inputStart, const char* input);
+
+const char* seeking_indexforward(const utf8seekindex_t* index, const char* inputStart, const char* inputEnd, size_t position);
+
+size_t seeking_indexwrite(const utf8seekindex_t* index, char* target);
+
+uint8_t seeking_indexread(utf8seekindex_t* index, const char* input, size_t inputSize);
+
+uint8_t seeking_lineupdate(utf8lineindex_t* index, const char* inputStart, const char* inputEnd, size_t editOffset, size_t removedSize, size_t insertedSize);
+
+uint8_t seeking_linefind(const utf8lineindex_t* index, const char* inputStart, const char* inputEnd, size_t unit, utf8position_t* position);
+
 /*! \endcond */
 
 #endif /* _UTF8REWIND_INTERNAL_SEEKING_H_ */
\ No newline at end of file
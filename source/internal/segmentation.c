@@ -0,0 +1,428 @@
+/*
+	Copyright (C) 2014-2016 Quinten Lansu
+
+	Permission is hereby granted, free of charge, to any person
+	obtaining a copy of this software and associated documentation
+	files (the "Software"), to deal in the Software without
+	restriction, including without limitation the rights to use,
+	copy, modify, merge, publish, distribute, sublicense, and/or
+	sell copies of the Software, and to permit persons to whom the
+	Software is furnished to do so, subject to the following
+	conditions:
+
+	The above copyright notice and this permission notice shall be
+	included in all copies or substantial portions of the Software.
+
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+	EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+	OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+	NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+	HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+	WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+	FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+	OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+#include "segmentation.h"
+
+#include "codepoint.h"
+#include "database.h"
+#include "seeking.h"
+
+/*
+	Grapheme cluster boundaries are found with a DFA over the
+	Grapheme_Cluster_Break property of each code point, implementing
+	the rules of UAX #29 (GB3 to GB13).
+
+	The state is the class of the previous code point, except that a
+	pictographic sequence (Extended_Pictographic Extend* ZWJ?) and an odd
+	number of regional indicators get states of their own. Each entry in
+	the transition table is the next state, with GRAPHEME_BREAK set when
+	there is a boundary before the code point.
+*/
+
+#define GRAPHEME_BREAK                      0x80
+
+#define GRAPHEME_STATE_START                0
+#define GRAPHEME_STATE_OTHER                1
+#define GRAPHEME_STATE_CR                   2
+#define GRAPHEME_STATE_CONTROL              3
+#define GRAPHEME_STATE_PREPEND              4
+#define GRAPHEME_STATE_L                    5
+#define GRAPHEME_STATE_LV                   6
+#define GRAPHEME_STATE_LVT                  7
+#define GRAPHEME_STATE_REGIONAL_INDICATOR   8
+#define GRAPHEME_STATE_PICTOGRAPHIC         9
+#define GRAPHEME_STATE_PICTOGRAPHIC_ZWJ     10
+
+static const uint8_t GraphemeTransitions[11][15] = {
+	/* Other CR    LF    Ctrl  Ext   ZWJ   RI    Prep  SpM   L     V     T     LV    LVT   Pict */
+	{ 0x01, 0x02, 0x03, 0x03, 0x01, 0x01, 0x08, 0x04, 0x01, 0x05, 0x06, 0x07, 0x06, 0x07, 0x09 },  /* Start */
+	{ 0x81, 0x82, 0x83, 0x83, 0x01, 0x01, 0x88, 0x84, 0x01, 0x85, 0x86, 0x87, 0x86, 0x87, 0x89 },  /* Other */
+	{ 0x81, 0x82, 0x03, 0x83, 0x81, 0x81, 0x88, 0x84, 0x81, 0x85, 0x86, 0x87, 0x86, 0x87, 0x89 },  /* CR */
+	{ 0x81, 0x82, 0x83, 0x83, 0x81, 0x81, 0x88, 0x84, 0x81, 0x85, 0x86, 0x87, 0x86, 0x87, 0x89 },  /* Control */
+	{ 0x01, 0x82, 0x83, 0x83, 0x01, 0x01, 0x08, 0x04, 0x01, 0x05, 0x06, 0x07, 0x06, 0x07, 0x09 },  /* Prepend */
+	{ 0x81, 0x82, 0x83, 0x83, 0x01, 0x01, 0x88, 0x84, 0x01, 0x05, 0x06, 0x87, 0x06, 0x07, 0x89 },  /* L */
+	{ 0x81, 0x82, 0x83, 0x83, 0x01, 0x01, 0x88, 0x84, 0x01, 0x85, 0x06, 0x07, 0x86, 0x87, 0x89 },  /* LV */
+	{ 0x81, 0x82, 0x83, 0x83, 0x01, 0x01, 0x88, 0x84, 0x01, 0x85, 0x86, 0x07, 0x86, 0x87, 0x89 },  /* LVT */
+	{ 0x81, 0x82, 0x83, 0x83, 0x01, 0x01, 0x01, 0x84, 0x01, 0x85, 0x86, 0x87, 0x86, 0x87, 0x89 },  /* Regional indicator */
+	{ 0x81, 0x82, 0x83, 0x83, 0x09, 0x0A, 0x88, 0x84, 0x01, 0x85, 0x86, 0x87, 0x86, 0x87, 0x89 },  /* Pictographic */
+	{ 0x81, 0x82, 0x83, 0x83, 0x01, 0x01, 0x88, 0x84, 0x01, 0x85, 0x86, 0x87, 0x86, 0x87, 0x09 },  /* Pictographic ZWJ */
+};
+
+static uint8_t segmentation_graphemeclass(const char* input, const char* inputEnd, uint8_t* length)
+{
+	unicode_t decoded;
+
+	*length = codepoint_read(input, inputEnd - input, &decoded);
+
+	return PROPERTY_GET_GCB(decoded);
+}
+
+static const char* segmentation_graphemenext(const char* input, const char* inputEnd)
+{
+	uint8_t state = GRAPHEME_STATE_START;
+
+	/* Printable Basic Latin followed by Basic Latin is always a cluster on its own */
+
+	if ((uint8_t)*input >= 0x20 &&
+		(uint8_t)*input < 0x7F &&
+		(input + 1 == inputEnd || (uint8_t)input[1] < 0x80))
+	{
+		return input + 1;
+	}
+
+	do
+	{
+		uint8_t length;
+		uint8_t transition = GraphemeTransitions[state][segmentation_graphemeclass(input, inputEnd, &length)];
+
+		if ((transition & GRAPHEME_BREAK) != 0)
+		{
+			break;
+		}
+
+		state = transition;
+		input += length;
+	}
+	while (input < inputEnd);
+
+	return input;
+}
+
+static const char* segmentation_graphemeanchor(const char* inputStart, const char* input, const char* inputEnd)
+{
+	const char* src = input;
+	uint8_t next_class = GraphemeClusterBreak_Other;
+	uint8_t length;
+
+	if (input < inputEnd)
+	{
+		next_class = segmentation_graphemeclass(input, inputEnd, &length);
+	}
+
+	/* Walk backwards to a boundary that does not depend on the code points before it */
+
+	while (src > inputStart)
+	{
+		const char* previous = seeking_rewind(inputStart, src, (size_t)(src - inputStart), -1);
+		uint8_t previous_class = segmentation_graphemeclass(previous, inputEnd, &length);
+
+		/* Joining pictographs and pairing regional indicators depend on the whole sequence */
+
+		if (src < input &&
+			(GraphemeTransitions[GraphemeTransitions[GRAPHEME_STATE_START][previous_class]][next_class] & GRAPHEME_BREAK) != 0 &&
+			(previous_class != GraphemeClusterBreak_ZWJ || next_class != GraphemeClusterBreak_ExtendedPictographic))
+		{
+			return src;
+		}
+
+		src = previous;
+		next_class = previous_class;
+	}
+
+	return inputStart;
+}
+
+const char* segmentation_graphemeforward(const char* input, const char* inputEnd, off_t offset)
+{
+	while (offset > 0 &&
+		input < inputEnd)
+	{
+		input = segmentation_graphemenext(input, inputEnd);
+		offset--;
+	}
+
+	return input;
+}
+
+const char* segmentation_graphemerewind(const char* inputStart, const char* input, const char* inputEnd, off_t offset)
+{
+	while (offset < 0 &&
+		input > inputStart)
+	{
+		const char* anchor = segmentation_graphemeanchor(inputStart, input, inputEnd);
+		const char* src = anchor;
+		off_t count = 0;
+
+		/* Count the clusters starting between the anchor and the input */
+
+		while (src < input)
+		{
+			src = segmentation_graphemenext(src, inputEnd);
+			count++;
+		}
+
+		if (count + offset >= 0)
+		{
+			return segmentation_graphemeforward(anchor, inputEnd, count + offset);
+		}
+
+		offset += count;
+		input = anchor;
+	}
+
+	return input;
+}
+
+size_t segmentation_graphemecount(const char* input, const char* inputEnd)
+{
+	size_t count = 0;
+
+	while (input < inputEnd)
+	{
+		input = segmentation_graphemenext(input, inputEnd);
+		count++;
+	}
+
+	return count;
+}
+
+/*
+	Word boundaries follow the rules of UAX #29 (WB3 to WB16). Extend,
+	Format and ZWJ code points are attached to the code point before them
+	(WB4), which turns the input into a sequence of units. A boundary
+	between two units depends on the two units before it and the one after
+	it, so the state keeps a window of four units and the length of the
+	current run of regional indicators.
+*/
+
+#define WORD_BREAK_NONE                     31
+
+#define WORD_UNIT_SINGLE                    0x01
+#define WORD_UNIT_ZWJ                       0x02
+
+#define WB(_value)                          ((uint32_t)1 << WordBreak_ ## _value)
+#define WORD_BREAK_MATCH(_value, _mask)     ((((uint32_t)1 << (_value)) & (_mask)) != 0)
+
+#define WORD_BREAK_NEWLINE                  (WB(CR) | WB(LF) | WB(Newline))
+#define WORD_BREAK_IGNORED                  (WB(Extend) | WB(Format) | WB(ZWJ))
+#define WORD_BREAK_AHLETTER                 (WB(ALetter) | WB(HebrewLetter))
+#define WORD_BREAK_MIDLETTER                (WB(MidLetter) | WB(MidNumLet) | WB(SingleQuote))
+#define WORD_BREAK_MIDNUM                   (WB(MidNum) | WB(MidNumLet) | WB(SingleQuote))
+
+/* Units that are never split, by the class of the unit before them (WB5, WB7a, WB8 to WB10 and WB13 to WB13b) */
+
+static const uint32_t WordBreakJoins[19] = {
+	0,                                                                       /* Other */
+	0,                                                                       /* CR */
+	0,                                                                       /* LF */
+	0,                                                                       /* Newline */
+	0,                                                                       /* Extend */
+	0,                                                                       /* ZWJ */
+	0,                                                                       /* Regional indicator */
+	0,                                                                       /* Format */
+	WB(Katakana) | WB(ExtendNumLet),                                         /* Katakana */
+	WORD_BREAK_AHLETTER | WB(Numeric) | WB(ExtendNumLet) | WB(SingleQuote),  /* Hebrew letter */
+	WORD_BREAK_AHLETTER | WB(Numeric) | WB(ExtendNumLet),                    /* ALetter */
+	0,                                                                       /* Single quote */
+	0,                                                                       /* Double quote */
+	0,                                                                       /* MidNumLet */
+	0,                                                                       /* MidLetter */
+	0,                                                                       /* MidNum */
+	WORD_BREAK_AHLETTER | WB(Numeric) | WB(ExtendNumLet),                    /* Numeric */
+	WORD_BREAK_AHLETTER | WB(Numeric) | WB(Katakana) | WB(ExtendNumLet),     /* ExtendNumLet */
+	0,                                                                       /* WSegSpace */
+};
+
+static void segmentation_wordread(WordSegmentationState* state)
+{
+	if (state->src < state->src_end)
+	{
+		if ((uint8_t)*state->src <= MAX_BASIC_LATIN)
+		{
+			state->next_code_point = (unicode_t)*state->src;
+			state->next_length = 1;
+		}
+		else
+		{
+			state->next_length = codepoint_read(state->src, state->src_end - state->src, &state->next_code_point);
+		}
+
+		state->next_word_break = PROPERTY_GET_WB(state->next_code_point);
+	}
+	else
+	{
+		state->next_length = 0;
+		state->next_word_break = WORD_BREAK_NONE;
+	}
+}
+
+static void segmentation_wordunit(WordSegmentationState* state, WordSegmentationUnit* unit)
+{
+	unit->start = state->src;
+	unit->first_code_point = state->next_code_point;
+	unit->word_break = state->next_word_break;
+	unit->flags = WORD_UNIT_SINGLE;
+
+	if (unit->word_break == WORD_BREAK_NONE)
+	{
+		return;
+	}
+
+	if (unit->word_break == WordBreak_ZWJ)
+	{
+		unit->flags |= WORD_UNIT_ZWJ;
+	}
+
+	state->src += state->next_length;
+	segmentation_wordread(state);
+
+	if (WORD_BREAK_MATCH(unit->word_break, WORD_BREAK_NEWLINE))
+	{
+		return;
+	}
+
+	/* A run of letters, numbers or Katakana of the same class is never split (WB5, WB8 and WB13) */
+
+	if (WORD_BREAK_MATCH(unit->word_break, WORD_BREAK_AHLETTER | WB(Numeric) | WB(Katakana)))
+	{
+		while (state->next_word_break == unit->word_break)
+		{
+			unit->flags = 0;
+
+			state->src += state->next_length;
+			segmentation_wordread(state);
+		}
+	}
+
+	/* Attach Extend, Format and ZWJ to the unit (WB4) */
+
+	while (state->next_word_break != WORD_BREAK_NONE &&
+		WORD_BREAK_MATCH(state->next_word_break, WORD_BREAK_IGNORED))
+	{
+		unit->flags = (state->next_word_break == WordBreak_ZWJ) ? WORD_UNIT_ZWJ : 0;
+
+		state->src += state->next_length;
+		segmentation_wordread(state);
+	}
+}
+
+static uint8_t segmentation_wordjoined(const WordSegmentationState* state)
+{
+	uint8_t before_previous = state->units[0].word_break;
+	uint8_t previous = state->units[1].word_break;
+	uint8_t current = state->units[2].word_break;
+	uint8_t next = state->units[3].word_break;
+
+	/* Never split CR LF, always split around newlines (WB3 to WB3b) */
+
+	if (previous == WordBreak_CR &&
+		current == WordBreak_LF)
+	{
+		return 1;
+	}
+
+	if (WORD_BREAK_MATCH(previous, WORD_BREAK_NEWLINE) ||
+		WORD_BREAK_MATCH(current, WORD_BREAK_NEWLINE))
+	{
+		return 0;
+	}
+
+	/* Emoji joined with ZWJ and horizontal whitespace (WB3c and WB3d) */
+
+	if ((state->units[1].flags & WORD_UNIT_ZWJ) != 0 &&
+		PROPERTY_GET_GCB(state->units[2].first_code_point) == GraphemeClusterBreak_ExtendedPictographic)
+	{
+		return 1;
+	}
+
+	if (previous == WordBreak_WSegSpace &&
+		current == WordBreak_WSegSpace &&
+		(state->units[1].flags & WORD_UNIT_SINGLE) != 0)
+	{
+		return 1;
+	}
+
+	if (WORD_BREAK_MATCH(current, WordBreakJoins[previous]))
+	{
+		return 1;
+	}
+
+	/* Letters and numbers around punctuation (WB6, WB7, WB7b, WB7c, WB11 and WB12) */
+
+	if ((WORD_BREAK_MATCH(previous, WORD_BREAK_AHLETTER) && WORD_BREAK_MATCH(current, WORD_BREAK_MIDLETTER) && WORD_BREAK_MATCH(next, WORD_BREAK_AHLETTER)) ||
+		(previous == WordBreak_HebrewLetter && current == WordBreak_DoubleQuote && next == WordBreak_HebrewLetter) ||
+		(previous == WordBreak_Numeric && WORD_BREAK_MATCH(current, WORD_BREAK_MIDNUM) && next == WordBreak_Numeric))
+	{
+		return 1;
+	}
+
+	if ((WORD_BREAK_MATCH(before_previous, WORD_BREAK_AHLETTER) && WORD_BREAK_MATCH(previous, WORD_BREAK_MIDLETTER) && WORD_BREAK_MATCH(current, WORD_BREAK_AHLETTER)) ||
+		(before_previous == WordBreak_HebrewLetter && previous == WordBreak_DoubleQuote && current == WordBreak_HebrewLetter) ||
+		(before_previous == WordBreak_Numeric && WORD_BREAK_MATCH(previous, WORD_BREAK_MIDNUM) && current == WordBreak_Numeric))
+	{
+		return 1;
+	}
+
+	/* Pairs of regional indicators (WB15 and WB16) */
+
+	return
+		previous == WordBreak_RegionalIndicator &&
+		current == WordBreak_RegionalIndicator &&
+		(state->regional_indicators & 1) != 0;
+}
+
+void segmentation_wordinitialize(WordSegmentationState* state, const char* input, const char* inputEnd)
+{
+	memset(state, 0, sizeof(WordSegmentationState));
+
+	state->src = input;
+	state->src_end = inputEnd;
+	state->units[0].word_break = WORD_BREAK_NONE;
+	state->units[1].word_break = WORD_BREAK_NONE;
+
+	segmentation_wordread(state);
+	segmentation_wordunit(state, &state->units[2]);
+	segmentation_wordunit(state, &state->units[3]);
+}
+
+const char* segmentation_wordnext(WordSegmentationState* state)
+{
+	do
+	{
+		/* Move the window by one unit */
+
+		state->units[0] = state->units[1];
+		state->units[1] = state->units[2];
+		state->units[2] = state->units[3];
+		segmentation_wordunit(state, &state->units[3]);
+
+		if (state->units[1].word_break == WordBreak_RegionalIndicator)
+		{
+			state->regional_indicators++;
+		}
+		else
+		{
+			state->regional_indicators = 0;
+		}
+
+		if (state->units[2].word_break == WORD_BREAK_NONE)
+		{
+			return state->src_end;
+		}
+	}
+	while (segmentation_wordjoined(state));
+
+	return state->units[2].start;
+}
\ No newline at end of file
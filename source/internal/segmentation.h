@@ -0,0 +1,67 @@
+/*
+	Copyright (C) 2014-2016 Quinten Lansu
+
+	Permission is hereby granted, free of charge, to any person
+	obtaining a copy of this software and associated documentation
+	files (the "Software"), to deal in the Software without
+	restriction, including without limitation the rights to use,
+	copy, modify, merge, publish, distribute, sublicense, and/or
+	sell copies of the Software, and to permit persons to whom the
+	Software is furnished to do so, subject to the following
+	conditions:
+
+	The above copyright notice and this permission notice shall be
+	included in all copies or substantial portions of the Software.
+
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+	EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+	OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+	NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+	HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+	WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+	FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+	OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+#ifndef _UTF8REWIND_INTERNAL_SEGMENTATION_H_
+#define _UTF8REWIND_INTERNAL_SEGMENTATION_H_
+
+/*!
+	\file
+	\brief Text segmentation interface.
+
+	\cond INTERNAL
+*/
+
+#include "utf8rewind.h"
+
+const char* segmentation_graphemeforward(const char* input, const char* inputEnd, off_t offset);
+
+const char* segmentation_graphemerewind(const char* inputStart, const char* input, const char* inputEnd, off_t offset);
+
+size_t segmentation_graphemecount(const char* input, const char* inputEnd);
+
+typedef struct {
+	const char* start;
+	unicode_t first_code_point;
+	uint8_t word_break;
+	uint8_t flags;
+} WordSegmentationUnit;
+
+typedef struct {
+	const char* src;
+	const char* src_end;
+	unicode_t next_code_point;
+	uint8_t next_length;
+	uint8_t next_word_break;
+	uint8_t regional_indicators;
+	WordSegmentationUnit units[4];
+} WordSegmentationState;
+
+void segmentation_wordinitialize(WordSegmentationState* state, const char* input, const char* inputEnd);
+
+const char* segmentation_wordnext(WordSegmentationState* state);
+
+/*! \endcond */
+
+#endif /* _UTF8REWIND_INTERNAL_SEGMENTATION_H_ */
\ No newline at end of file
@@ -141,9 +141,13 @@ uint8_t stream_read(StreamState* state, const size_t* propertyIndex, const uint8
 		state->current++;
 	}
 
-	if (state->filled == STREAM_SAFE_MAX)
+	if (state->filled == STREAM_SAFE_MAX &&
+		state->current == STREAM_SAFE_MAX)
 	{
-		/* Insert COMBINING GRAPHEME JOINER into output */
+		/*
+			Insert COMBINING GRAPHEME JOINER into output, unless the sequence
+			ended on a starter, which would be overwritten by it.
+		*/
 
 		state->codepoint[state->filled]                  = CP_COMBINING_GRAPHEME_JOINER;
 		state->quick_check[state->filled]                = QuickCheckResult_Yes;
@@ -17,7 +17,7 @@ TEST(CaseMappingInitialize, Initialize)
 	char o[256] = { 0 };
 	size_t os = 255;
 
-	EXPECT_TRUE(casemapping_initialize(&state, i, is, o, os, TitlecaseIndex1Ptr, TitlecaseIndex2Ptr, TitlecaseDataPtr));
+	EXPECT_TRUE(casemapping_initialize(&state, i, is, o, os, TitlecaseIndex1Ptr, TitlecaseIndex2Ptr, TitlecaseDataPtr, casemapping_locale()));
 	EXPECT_EQ(i, state.src);
 	EXPECT_EQ(is, state.src_size);
 	EXPECT_EQ(o, state.dst);
@@ -27,6 +27,29 @@ TEST(CaseMappingInitialize, Initialize)
 	EXPECT_EQ(TitlecaseDataPtr, state.property_data);
 }
 
+TEST(CaseMappingInitialize, InvalidLocale)
+{
+	CaseMappingState state;
+	const char* i = "Greetings";
+	size_t is = strlen(i);
+	char o[256] = { 0 };
+	size_t os = 255;
+
+	EXPECT_FALSE(casemapping_initialize(&state, i, is, o, os, TitlecaseIndex1Ptr, TitlecaseIndex2Ptr, TitlecaseDataPtr, UTF8_LOCALE_MAXIMUM));
+}
+
+TEST(CaseMappingInitialize, LocaleExplicit)
+{
+	CaseMappingState state;
+	const char* i = "Istanbul";
+	size_t is = strlen(i);
+	char o[256] = { 0 };
+	size_t os = 255;
+
+	EXPECT_TRUE(casemapping_initialize(&state, i, is, o, os, LowercaseIndex1Ptr, LowercaseIndex2Ptr, LowercaseDataPtr, UTF8_LOCALE_TURKISH_AND_AZERI_LATIN));
+	EXPECT_LOCALE_EQ(CASEMAPPING_LOCALE_TURKISH_OR_AZERI_LATIN, state.locale);
+}
+
 TEST(CaseMappingInitialize, LocaleEnglishUS)
 {
 	CaseMappingState state;
@@ -36,7 +59,7 @@ TEST(CaseMappingInitialize, LocaleEnglishUS)
 	size_t os = 255;
 
 	SET_LOCALE_ENGLISH();
-	EXPECT_TRUE(casemapping_initialize(&state, i, is, o, os, TitlecaseIndex1Ptr, TitlecaseIndex2Ptr, TitlecaseDataPtr));
+	EXPECT_TRUE(casemapping_initialize(&state, i, is, o, os, TitlecaseIndex1Ptr, TitlecaseIndex2Ptr, TitlecaseDataPtr, casemapping_locale()));
 	EXPECT_LOCALE_EQ(CASEMAPPING_LOCALE_DEFAULT, state.locale);
 	RESET_LOCALE();
 }
@@ -50,7 +73,7 @@ TEST(CaseMappingInitialize, LocaleLithuanian)
 	size_t os = 255;
 
 	SET_LOCALE_LITHUANIAN();
-	EXPECT_TRUE(casemapping_initialize(&state, i, is, o, os, UppercaseIndex1Ptr, UppercaseIndex2Ptr, UppercaseDataPtr));
+	EXPECT_TRUE(casemapping_initialize(&state, i, is, o, os, UppercaseIndex1Ptr, UppercaseIndex2Ptr, UppercaseDataPtr, casemapping_locale()));
 	EXPECT_LOCALE_EQ(CASEMAPPING_LOCALE_LITHUANIAN, state.locale);
 	RESET_LOCALE();
 }
@@ -64,7 +87,7 @@ TEST(CaseMappingInitialize, LocaleTurkish)
 	size_t os = 255;
 
 	SET_LOCALE_TURKISH();
-	EXPECT_TRUE(casemapping_initialize(&state, i, is, o, os, UppercaseIndex1Ptr, UppercaseIndex2Ptr, UppercaseDataPtr));
+	EXPECT_TRUE(casemapping_initialize(&state, i, is, o, os, UppercaseIndex1Ptr, UppercaseIndex2Ptr, UppercaseDataPtr, casemapping_locale()));
 	EXPECT_LOCALE_EQ(CASEMAPPING_LOCALE_TURKISH_OR_AZERI_LATIN, state.locale);
 	RESET_LOCALE();
 }
@@ -78,7 +101,7 @@ TEST(CaseMappingInitialize, LocaleAzeri)
 	size_t os = 255;
 
 	SET_LOCALE_AZERI();
-	EXPECT_TRUE(casemapping_initialize(&state, i, is, o, os, UppercaseIndex1Ptr, UppercaseIndex2Ptr, UppercaseDataPtr));
+	EXPECT_TRUE(casemapping_initialize(&state, i, is, o, os, UppercaseIndex1Ptr, UppercaseIndex2Ptr, UppercaseDataPtr, casemapping_locale()));
 	EXPECT_LOCALE_EQ(CASEMAPPING_LOCALE_TURKISH_OR_AZERI_LATIN, state.locale);
 	RESET_LOCALE();
 }
\ No newline at end of file
@@ -216,6 +216,16 @@ TEST(CodepointRead, ThreeBytesNotEnoughDataTwoBytes)
 	EXPECT_CPEQ(0xFFFD, o);
 }
 
+TEST(CodepointRead, ThreeBytesNotEnoughDataInputSize)
+{
+	const char* i = "\xE3\x81\x81";
+	size_t is = 2;
+	unicode_t o;
+
+	EXPECT_EQ(2, codepoint_read(i, is, &o));
+	EXPECT_CPEQ(0xFFFD, o);
+}
+
 TEST(CodepointRead, ThreeBytesInvalidContinuationFirstLower)
 {
 	const char* i = "\xED\x25\x89";
@@ -336,6 +346,16 @@ TEST(CodepointRead, FourBytesNotEnoughDataThreeBytes)
 	EXPECT_CPEQ(0xFFFD, o);
 }
 
+TEST(CodepointRead, FourBytesNotEnoughDataInputSize)
+{
+	const char* i = "\xF0\x90\xA8\x80";
+	size_t il = 3;
+	unicode_t o;
+
+	EXPECT_EQ(3, codepoint_read(i, il, &o));
+	EXPECT_CPEQ(0xFFFD, o);
+}
+
 TEST(CodepointRead, FourBytesInvalidContinuationFirstLower)
 {
 	const char* i = "\xF3\x1A\x8F\xAA";
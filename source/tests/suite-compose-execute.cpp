@@ -709,6 +709,61 @@ TEST(ComposeExecute, SequenceHangulSTDecomposed)
 	EXPECT_FALSE(compose_execute(&state));
 }
 
+TEST(ComposeExecute, SequenceHangulLVTUnaffected)
+{
+	/*
+		U+AC01 U+11A8
+		     Y      M
+		     0      0
+	*/
+
+	const char* i = "\xEA\xB0\x81\xE1\x86\xA8";
+	size_t il = strlen(i);
+
+	StreamState input;
+	EXPECT_TRUE(stream_initialize(&input, i, il));
+
+	StreamState output = { 0 };
+
+	ComposeState state;
+	EXPECT_TRUE(compose_initialize(&state, &input, &output, 0));
+
+	EXPECT_TRUE(compose_execute(&state));
+	EXPECT_EQ(2, (int)state.output->current);
+	CHECK_STREAM_ENTRY(*state.output, 0, 0xAC01, Yes, 0);
+	CHECK_STREAM_ENTRY(*state.output, 1, 0x11A8, Maybe, 0);
+
+	EXPECT_FALSE(compose_execute(&state));
+}
+
+TEST(ComposeExecute, SequenceBlockedByStarter)
+{
+	/*
+		U+0061 U+1161 U+0301
+		     Y      M      M
+		     0      0    230
+	*/
+
+	const char* i = "a\xE1\x85\xA1\xCC\x81";
+	size_t il = strlen(i);
+
+	StreamState input;
+	EXPECT_TRUE(stream_initialize(&input, i, il));
+
+	StreamState output = { 0 };
+
+	ComposeState state;
+	EXPECT_TRUE(compose_initialize(&state, &input, &output, 0));
+
+	EXPECT_TRUE(compose_execute(&state));
+	EXPECT_EQ(3, (int)state.output->current);
+	CHECK_STREAM_ENTRY(*state.output, 0, 0x0061, Yes, 0);
+	CHECK_STREAM_ENTRY(*state.output, 1, 0x1161, Maybe, 0);
+	CHECK_STREAM_ENTRY(*state.output, 2, 0x0301, Maybe, 230);
+
+	EXPECT_FALSE(compose_execute(&state));
+}
+
 TEST(ComposeExecute, MultipleSequenceCompose)
 {
 	/*
@@ -890,6 +890,92 @@ TEST(DecomposeExecute, MultipleHangul)
 	EXPECT_EQ(0, decompose_execute(&state));
 }
 
+TEST(DecomposeExecute, LongSequenceOutputFull)
+{
+	/*
+		U+0061 U+0344 (20 times)
+		     Y      N
+		     0    230
+	*/
+
+	std::string i = "a";
+
+	for (size_t k = 0; k < 20; ++k)
+	{
+		i += "\xCD\x84";
+	}
+
+	StreamState input;
+	EXPECT_TRUE(stream_initialize(&input, i.c_str(), i.length()));
+
+	StreamState output = { 0 };
+
+	DecomposeState state;
+	EXPECT_TRUE(decompose_initialize(&state, &input, &output, 0));
+
+	EXPECT_EQ(32, decompose_execute(&state));
+	CHECK_STREAM_ENTRY(*state.output, 0, 0x0061, Yes, 0);
+	for (uint8_t k = 1; k < 32; k += 2)
+	{
+		CHECK_STREAM_ENTRY(*state.output, k, 0x0308, Yes, 230);
+	}
+	for (uint8_t k = 2; k < 32; k += 2)
+	{
+		CHECK_STREAM_ENTRY(*state.output, k, 0x0301, Yes, 230);
+	}
+	EXPECT_TRUE(state.output->stable);
+
+	EXPECT_EQ(9, decompose_execute(&state));
+	for (uint8_t k = 0; k < 9; k += 2)
+	{
+		CHECK_STREAM_ENTRY(*state.output, k, 0x0301, Yes, 230);
+	}
+	for (uint8_t k = 1; k < 9; k += 2)
+	{
+		CHECK_STREAM_ENTRY(*state.output, k, 0x0308, Yes, 230);
+	}
+	EXPECT_TRUE(state.output->stable);
+
+	EXPECT_EQ(0, decompose_execute(&state));
+}
+
+TEST(DecomposeExecute, LongSequenceCacheUnordered)
+{
+	/*
+		U+0061 U+0344 (16 times) U+0301 U+0316
+		     Y      N                 Y      Y
+		     0    230               230    220
+	*/
+
+	std::string i = "a";
+
+	for (size_t k = 0; k < 16; ++k)
+	{
+		i += "\xCD\x84";
+	}
+
+	i += "\xCC\x81\xCC\x96";
+
+	StreamState input;
+	EXPECT_TRUE(stream_initialize(&input, i.c_str(), i.length()));
+
+	StreamState output = { 0 };
+
+	DecomposeState state;
+	EXPECT_TRUE(decompose_initialize(&state, &input, &output, 0));
+
+	EXPECT_EQ(32, decompose_execute(&state));
+	EXPECT_TRUE(state.output->stable);
+
+	EXPECT_EQ(3, decompose_execute(&state));
+	CHECK_STREAM_ENTRY(*state.output, 0, 0x0301, Yes, 230);
+	CHECK_STREAM_ENTRY(*state.output, 1, 0x0301, Yes, 230);
+	CHECK_STREAM_ENTRY(*state.output, 2, 0x0316, Yes, 220);
+	EXPECT_FALSE(state.output->stable);
+
+	EXPECT_EQ(0, decompose_execute(&state));
+}
+
 TEST(DecomposeExecute, ContinueAfterEnd)
 {
 	/*
@@ -703,6 +703,67 @@ TEST(StreamRead, BufferOverflow)
 	EXPECT_FALSE(stream_read(&state, QuickCheckNFCIndexPtr, QuickCheckNFCDataPtr));
 }
 
+TEST(StreamRead, BufferOverflowEndsOnStarter)
+{
+	/*
+		U+0032 U+0308 U+0308 U+0308 U+0308 U+0308 U+0308 U+0308 U+0308 U+0308 U+0308 U+0308 U+0308 U+0308 U+0308 U+0308
+		     Y      M      M      M      M      M      M      M      M      M      M      M      M      M      M      M
+		     0    230    230    230    230    230    230    230    230    230    230    230    230    230    230    230
+
+		U+0308 U+0308 U+0308 U+0308 U+0308 U+0308 U+0308 U+0308 U+0308 U+0308 U+0308 U+0308 U+0308 U+0033
+		     M      M      M      M      M      M      M      M      M      M      M      M      M      Y
+		   230    230    230    230    230    230    230    230    230    230    230    230    230      0
+	*/
+
+	const char* i = "2\xCC\x88\xCC\x88\xCC\x88\xCC\x88\xCC\x88\xCC\x88\xCC\x88\xCC\x88\xCC\x88\xCC\x88\xCC\x88\xCC\x88\
+\xCC\x88\xCC\x88\xCC\x88\xCC\x88\xCC\x88\xCC\x88\xCC\x88\xCC\x88\xCC\x88\xCC\x88\xCC\x88\xCC\x88\xCC\x88\xCC\x88\
+\xCC\x88\xCC\x88" "3";
+	size_t il = strlen(i);
+
+	StreamState state;
+	EXPECT_TRUE(stream_initialize(&state, i, il));
+
+	EXPECT_TRUE(stream_read(&state, QuickCheckNFCIndexPtr, QuickCheckNFCDataPtr));
+	EXPECT_EQ(29, state.current);
+	CHECK_STREAM_ENTRY(state, 0, 0x0032, Yes, 0);
+	CHECK_STREAM_ENTRY(state, 1, 0x0308, Maybe, 230);
+	CHECK_STREAM_ENTRY(state, 2, 0x0308, Maybe, 230);
+	CHECK_STREAM_ENTRY(state, 3, 0x0308, Maybe, 230);
+	CHECK_STREAM_ENTRY(state, 4, 0x0308, Maybe, 230);
+	CHECK_STREAM_ENTRY(state, 5, 0x0308, Maybe, 230);
+	CHECK_STREAM_ENTRY(state, 6, 0x0308, Maybe, 230);
+	CHECK_STREAM_ENTRY(state, 7, 0x0308, Maybe, 230);
+	CHECK_STREAM_ENTRY(state, 8, 0x0308, Maybe, 230);
+	CHECK_STREAM_ENTRY(state, 9, 0x0308, Maybe, 230);
+	CHECK_STREAM_ENTRY(state, 10, 0x0308, Maybe, 230);
+	CHECK_STREAM_ENTRY(state, 11, 0x0308, Maybe, 230);
+	CHECK_STREAM_ENTRY(state, 12, 0x0308, Maybe, 230);
+	CHECK_STREAM_ENTRY(state, 13, 0x0308, Maybe, 230);
+	CHECK_STREAM_ENTRY(state, 14, 0x0308, Maybe, 230);
+	CHECK_STREAM_ENTRY(state, 15, 0x0308, Maybe, 230);
+	CHECK_STREAM_ENTRY(state, 16, 0x0308, Maybe, 230);
+	CHECK_STREAM_ENTRY(state, 17, 0x0308, Maybe, 230);
+	CHECK_STREAM_ENTRY(state, 18, 0x0308, Maybe, 230);
+	CHECK_STREAM_ENTRY(state, 19, 0x0308, Maybe, 230);
+	CHECK_STREAM_ENTRY(state, 20, 0x0308, Maybe, 230);
+	CHECK_STREAM_ENTRY(state, 21, 0x0308, Maybe, 230);
+	CHECK_STREAM_ENTRY(state, 22, 0x0308, Maybe, 230);
+	CHECK_STREAM_ENTRY(state, 23, 0x0308, Maybe, 230);
+	CHECK_STREAM_ENTRY(state, 24, 0x0308, Maybe, 230);
+	CHECK_STREAM_ENTRY(state, 25, 0x0308, Maybe, 230);
+	CHECK_STREAM_ENTRY(state, 26, 0x0308, Maybe, 230);
+	CHECK_STREAM_ENTRY(state, 27, 0x0308, Maybe, 230);
+	CHECK_STREAM_ENTRY(state, 28, 0x0308, Maybe, 230);
+	EXPECT_TRUE(state.stable);
+
+	EXPECT_TRUE(stream_read(&state, QuickCheckNFCIndexPtr, QuickCheckNFCDataPtr));
+	EXPECT_EQ(1, state.current);
+	CHECK_STREAM_ENTRY(state, 0, 0x0033, Yes, 0);
+	EXPECT_TRUE(state.stable);
+
+	EXPECT_FALSE(stream_read(&state, QuickCheckNFCIndexPtr, QuickCheckNFCDataPtr));
+}
+
 TEST(StreamRead, ContinueAfterEnd)
 {
 	/*
@@ -0,0 +1,174 @@
+#include "tests-base.hpp"
+
+#include "utf8rewind.h"
+
+#include "../helpers/helpers-strings.hpp"
+
+TEST(Utf8CaseCmp, Equal)
+{
+	const char* l = "Hello World";
+	const char* r = "hELLO wORLD";
+	int32_t errors = UTF8_ERR_NONE;
+
+	EXPECT_EQ(0, utf8casecmp(l, strlen(l), r, strlen(r), UTF8_LOCALE_DEFAULT, &errors));
+	EXPECT_ERROREQ(UTF8_ERR_NONE, errors);
+}
+
+TEST(Utf8CaseCmp, Less)
+{
+	const char* l = "apple";
+	const char* r = "BANANA";
+	int32_t errors = UTF8_ERR_NONE;
+
+	EXPECT_GT(0, utf8casecmp(l, strlen(l), r, strlen(r), UTF8_LOCALE_DEFAULT, &errors));
+	EXPECT_ERROREQ(UTF8_ERR_NONE, errors);
+}
+
+TEST(Utf8CaseCmp, Greater)
+{
+	const char* l = "Zebra";
+	const char* r = "yak";
+	int32_t errors = UTF8_ERR_NONE;
+
+	EXPECT_LT(0, utf8casecmp(l, strlen(l), r, strlen(r), UTF8_LOCALE_DEFAULT, &errors));
+	EXPECT_ERROREQ(UTF8_ERR_NONE, errors);
+}
+
+TEST(Utf8CaseCmp, Prefix)
+{
+	const char* l = "Straight";
+	const char* r = "STRAIGHTFORWARD";
+	int32_t errors = UTF8_ERR_NONE;
+
+	EXPECT_GT(0, utf8casecmp(l, strlen(l), r, strlen(r), UTF8_LOCALE_DEFAULT, &errors));
+	EXPECT_LT(0, utf8casecmp(r, strlen(r), l, strlen(l), UTF8_LOCALE_DEFAULT, &errors));
+	EXPECT_ERROREQ(UTF8_ERR_NONE, errors);
+}
+
+TEST(Utf8CaseCmp, BasicLatinPunctuation)
+{
+	// LEFT SQUARE BRACKET must not be folded to LEFT CURLY BRACKET
+
+	const char* l = "abcdefgh[";
+	const char* r = "ABCDEFGH{";
+	int32_t errors = UTF8_ERR_NONE;
+
+	EXPECT_GT(0, utf8casecmp(l, strlen(l), r, strlen(r), UTF8_LOCALE_DEFAULT, &errors));
+	EXPECT_ERROREQ(UTF8_ERR_NONE, errors);
+}
+
+TEST(Utf8CaseCmp, Cyrillic)
+{
+	const char* l = "\xD0\x9F\xD1\x80\xD0\xB8\xD0\xB2\xD0\xB5\xD1\x82";
+	const char* r = "\xD0\xBF\xD0\xA0\xD0\x98\xD0\x92\xD0\x95\xD0\xA2";
+	int32_t errors = UTF8_ERR_NONE;
+
+	EXPECT_EQ(0, utf8casecmp(l, strlen(l), r, strlen(r), UTF8_LOCALE_DEFAULT, &errors));
+	EXPECT_ERROREQ(UTF8_ERR_NONE, errors);
+}
+
+TEST(Utf8CaseCmp, LengthChanges)
+{
+	// LATIN SMALL LETTER SHARP S and LATIN CAPITAL LETTER SHARP S
+
+	const char* l = "Stra\xC3\x9F" "e";
+	const char* r = "STRASSE";
+	const char* x = "stra\xE1\xBA\x9E" "e";
+	int32_t errors = UTF8_ERR_NONE;
+
+	EXPECT_EQ(0, utf8casecmp(l, strlen(l), r, strlen(r), UTF8_LOCALE_DEFAULT, &errors));
+	EXPECT_EQ(0, utf8casecmp(r, strlen(r), x, strlen(x), UTF8_LOCALE_DEFAULT, &errors));
+	EXPECT_ERROREQ(UTF8_ERR_NONE, errors);
+}
+
+TEST(Utf8CaseCmp, OrderedByCodePoint)
+{
+	const char* l = "\xC3\x89t\xC3\xA9";
+	const char* r = "\xE2\x84\xAA";
+	int32_t errors = UTF8_ERR_NONE;
+
+	EXPECT_LT(0, utf8casecmp(l, strlen(l), r, strlen(r), UTF8_LOCALE_DEFAULT, &errors));
+	EXPECT_ERROREQ(UTF8_ERR_NONE, errors);
+}
+
+TEST(Utf8CaseCmp, Turkish)
+{
+	const char* l = "DIYARBAKIR";
+	const char* r = "d\xC4\xB1yarbak\xC4\xB1r";
+	int32_t errors = UTF8_ERR_NONE;
+
+	EXPECT_NE(0, utf8casecmp(l, strlen(l), r, strlen(r), UTF8_LOCALE_DEFAULT, &errors));
+	EXPECT_EQ(0, utf8casecmp(l, strlen(l), r, strlen(r), UTF8_LOCALE_TURKISH_AND_AZERI_LATIN, &errors));
+	EXPECT_ERROREQ(UTF8_ERR_NONE, errors);
+}
+
+TEST(Utf8CaseCmp, InvalidData)
+{
+	const char* l = "ab\xFF";
+	const char* r = "AB\xEF\xBF\xBD";
+	int32_t errors = UTF8_ERR_NONE;
+
+	EXPECT_EQ(0, utf8casecmp(l, strlen(l), r, strlen(r), UTF8_LOCALE_DEFAULT, &errors));
+	EXPECT_ERROREQ(UTF8_ERR_NONE, errors);
+}
+
+TEST(Utf8CaseCmp, Empty)
+{
+	const char* l = "";
+	const char* r = "a";
+	int32_t errors = UTF8_ERR_NONE;
+
+	EXPECT_EQ(0, utf8casecmp(l, 0, l, 0, UTF8_LOCALE_DEFAULT, &errors));
+	EXPECT_GT(0, utf8casecmp(l, 0, r, 1, UTF8_LOCALE_DEFAULT, &errors));
+	EXPECT_ERROREQ(UTF8_ERR_NONE, errors);
+}
+
+TEST(Utf8CaseCmp, InputNull)
+{
+	int32_t errors = UTF8_ERR_NONE;
+
+	EXPECT_EQ(0, utf8casecmp(nullptr, 1, "a", 1, UTF8_LOCALE_DEFAULT, &errors));
+	EXPECT_ERROREQ(UTF8_ERR_INVALID_DATA, errors);
+}
+
+TEST(Utf8CaseCmp, InvalidLocale)
+{
+	int32_t errors = UTF8_ERR_NONE;
+
+	EXPECT_EQ(0, utf8casecmp("a", 1, "b", 1, UTF8_LOCALE_MAXIMUM, &errors));
+	EXPECT_ERROREQ(UTF8_ERR_INVALID_LOCALE, errors);
+}
+
+TEST(Utf8NCaseCmp, Prefix)
+{
+	const char* l = "Straight";
+	const char* r = "STRAIGHTFORWARD";
+	int32_t errors = UTF8_ERR_NONE;
+
+	EXPECT_EQ(0, utf8ncasecmp(l, strlen(l), r, strlen(r), 8, UTF8_LOCALE_DEFAULT, &errors));
+	EXPECT_GT(0, utf8ncasecmp(l, strlen(l), r, strlen(r), 9, UTF8_LOCALE_DEFAULT, &errors));
+	EXPECT_ERROREQ(UTF8_ERR_NONE, errors);
+}
+
+TEST(Utf8NCaseCmp, CountsCaseFoldedCodePoints)
+{
+	// LATIN SMALL LETTER SHARP S is folded to two code points
+
+	const char* l = "\xC3\x9F" "x";
+	const char* r = "sT";
+	int32_t errors = UTF8_ERR_NONE;
+
+	EXPECT_EQ(0, utf8ncasecmp(l, strlen(l), r, strlen(r), 1, UTF8_LOCALE_DEFAULT, &errors));
+	EXPECT_GT(0, utf8ncasecmp(l, strlen(l), r, strlen(r), 2, UTF8_LOCALE_DEFAULT, &errors));
+	EXPECT_ERROREQ(UTF8_ERR_NONE, errors);
+}
+
+TEST(Utf8NCaseCmp, Zero)
+{
+	const char* l = "abc";
+	const char* r = "xyz";
+	int32_t errors = UTF8_ERR_NONE;
+
+	EXPECT_EQ(0, utf8ncasecmp(l, strlen(l), r, strlen(r), 0, UTF8_LOCALE_DEFAULT, &errors));
+	EXPECT_ERROREQ(UTF8_ERR_NONE, errors);
+}
\ No newline at end of file
@@ -137,6 +137,54 @@ TEST_F(Utf8CaseFold, BasicLatinMultipleNotEnoughSpace)
 	EXPECT_ERROREQ(UTF8_ERR_NOT_ENOUGH_SPACE, errors);
 }
 
+TEST_F(Utf8CaseFold, BasicLatinLongSentence)
+{
+	const char* c = "The Quick Brown Fox Jumps Over The Lazy Dog";
+	const size_t s = 255;
+	char b[256] = { 0 };
+	int32_t errors = UTF8_ERR_NONE;
+
+	EXPECT_EQ(43, utf8casefold(c, strlen(c), b, s, &errors));
+	EXPECT_UTF8EQ("the quick brown fox jumps over the lazy dog", b);
+	EXPECT_ERROREQ(UTF8_ERR_NONE, errors);
+}
+
+TEST_F(Utf8CaseFold, BasicLatinLongNotEnoughSpace)
+{
+	const char* c = "The Quick Brown Fox Jumps Over The Lazy Dog";
+	const size_t s = 10;
+	char b[256] = { 0 };
+	int32_t errors = UTF8_ERR_NONE;
+
+	EXPECT_EQ(10, utf8casefold(c, strlen(c), b, s, &errors));
+	EXPECT_UTF8EQ("the quick ", b);
+	EXPECT_ERROREQ(UTF8_ERR_NOT_ENOUGH_SPACE, errors);
+}
+
+TEST_F(Utf8CaseFold, GreekWord)
+{
+	const char* c = "\xCE\xA3\xCE\x9F\xCE\xA6\xCE\x99\xCE\x91 \xCE\x9B\xCF\x8C\xCE\xB3\xCE\xBF\xCF\x82";
+	const size_t s = 255;
+	char b[256] = { 0 };
+	int32_t errors = UTF8_ERR_NONE;
+
+	EXPECT_EQ(21, utf8casefold(c, strlen(c), b, s, &errors));
+	EXPECT_UTF8EQ("\xCF\x83\xCE\xBF\xCF\x86\xCE\xB9\xCE\xB1 \xCE\xBB\xCF\x8C\xCE\xB3\xCE\xBF\xCF\x83", b);
+	EXPECT_ERROREQ(UTF8_ERR_NONE, errors);
+}
+
+TEST_F(Utf8CaseFold, SimpleMappingLengthChanges)
+{
+	const char* c = "\xE2\x84\xAA\xE1\xBA\x9E\xC2\xB5 \xC5\xBF";
+	const size_t s = 255;
+	char b[256] = { 0 };
+	int32_t errors = UTF8_ERR_NONE;
+
+	EXPECT_EQ(7, utf8casefold(c, strlen(c), b, s, &errors));
+	EXPECT_UTF8EQ("kss\xCE\xBC s", b);
+	EXPECT_ERROREQ(UTF8_ERR_NONE, errors);
+}
+
 TEST_F(Utf8CaseFold, GeneralCategoryCaseMappedSingleUppercase)
 {
 	// LATIN CAPITAL LETTER N WITH LEFT HOOK
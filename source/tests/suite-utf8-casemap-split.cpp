@@ -0,0 +1,181 @@
+#include "tests-base.hpp"
+
+#include "utf8rewind.h"
+
+#include "../helpers/helpers-strings.hpp"
+
+TEST(Utf8CaseMapSplit, InvalidData)
+{
+	size_t o[8] = { 0 };
+	size_t os = 8;
+	int32_t errors = UTF8_ERR_NONE;
+
+	EXPECT_EQ(0, utf8casemapsplit(nullptr, 4, 2, o, os, &errors));
+	EXPECT_ERROREQ(UTF8_ERR_INVALID_DATA, errors);
+}
+
+TEST(Utf8CaseMapSplit, InvalidSegmentSize)
+{
+	const char* i = "Zero";
+	size_t is = strlen(i);
+	size_t o[8] = { 0 };
+	size_t os = 8;
+	int32_t errors = UTF8_ERR_NONE;
+
+	EXPECT_EQ(0, utf8casemapsplit(i, is, 0, o, os, &errors));
+	EXPECT_ERROREQ(UTF8_ERR_INVALID_DATA, errors);
+}
+
+TEST(Utf8CaseMapSplit, Empty)
+{
+	const char* i = "";
+	size_t o[8] = { 0 };
+	size_t os = 8;
+	int32_t errors = UTF8_ERR_NONE;
+
+	EXPECT_EQ(0, utf8casemapsplit(i, 0, 2, o, os, &errors));
+	EXPECT_ERROREQ(UTF8_ERR_NONE, errors);
+}
+
+TEST(Utf8CaseMapSplit, Words)
+{
+	const char* i = "Hello World, how are you?";
+	size_t is = strlen(i);
+	size_t o[8] = { 0 };
+	size_t os = 8;
+	int32_t errors = UTF8_ERR_NONE;
+
+	EXPECT_EQ(5, utf8casemapsplit(i, is, 4, o, os, &errors));
+	EXPECT_EQ(0, o[0]);
+	EXPECT_EQ(5, o[1]);
+	EXPECT_EQ(11, o[2]);
+	EXPECT_EQ(16, o[3]);
+	EXPECT_EQ(21, o[4]);
+	EXPECT_ERROREQ(UTF8_ERR_NONE, errors);
+}
+
+TEST(Utf8CaseMapSplit, SingleWord)
+{
+	const char* i = "HELLO";
+	size_t is = strlen(i);
+	size_t o[8] = { 0 };
+	size_t os = 8;
+	int32_t errors = UTF8_ERR_NONE;
+
+	EXPECT_EQ(1, utf8casemapsplit(i, is, 2, o, os, &errors));
+	EXPECT_EQ(0, o[0]);
+	EXPECT_ERROREQ(UTF8_ERR_NONE, errors);
+}
+
+TEST(Utf8CaseMapSplit, Uncased)
+{
+	const char* i = "\xE4\xB8\xAD\xE6\x96\x87\xE4\xB8\xAD\xE6\x96\x87";
+	size_t is = strlen(i);
+	size_t o[8] = { 0 };
+	size_t os = 8;
+	int32_t errors = UTF8_ERR_NONE;
+
+	EXPECT_EQ(2, utf8casemapsplit(i, is, 3, o, os, &errors));
+	EXPECT_EQ(0, o[0]);
+	EXPECT_EQ(6, o[1]);
+	EXPECT_ERROREQ(UTF8_ERR_NONE, errors);
+}
+
+TEST(Utf8CaseMapSplit, CombiningSequence)
+{
+	/*
+		U+0061 U+0301 U+0020 U+0062 U+0301 U+0020 U+0063
+		     0    230      0      0    230      0      0
+	*/
+
+	const char* i = "a\xCC\x81 b\xCC\x81 c";
+	size_t is = strlen(i);
+	size_t o[8] = { 0 };
+	size_t os = 8;
+	int32_t errors = UTF8_ERR_NONE;
+
+	EXPECT_EQ(3, utf8casemapsplit(i, is, 1, o, os, &errors));
+	EXPECT_EQ(0, o[0]);
+	EXPECT_EQ(4, o[1]);
+	EXPECT_EQ(8, o[2]);
+	EXPECT_ERROREQ(UTF8_ERR_NONE, errors);
+}
+
+TEST(Utf8CaseMapSplit, GreekCapitalLetterSigma)
+{
+	const char* i = "\xCE\x9F\xCE\x94\xCE\x9F\xCE\xA3 \xCE\xA3 x";
+	size_t is = strlen(i);
+	size_t o[8] = { 0 };
+	size_t os = 8;
+	int32_t errors = UTF8_ERR_NONE;
+
+	EXPECT_EQ(2, utf8casemapsplit(i, is, 1, o, os, &errors));
+	EXPECT_EQ(0, o[0]);
+	EXPECT_EQ(12, o[1]);
+	EXPECT_ERROREQ(UTF8_ERR_NONE, errors);
+}
+
+TEST(Utf8CaseMapSplit, InvalidSequence)
+{
+	const char* i = "a\xFF b";
+	size_t is = strlen(i);
+	size_t o[8] = { 0 };
+	size_t os = 8;
+	int32_t errors = UTF8_ERR_NONE;
+
+	EXPECT_EQ(2, utf8casemapsplit(i, is, 1, o, os, &errors));
+	EXPECT_EQ(0, o[0]);
+	EXPECT_EQ(3, o[1]);
+	EXPECT_ERROREQ(UTF8_ERR_NONE, errors);
+}
+
+TEST(Utf8CaseMapSplit, AmountOfSegments)
+{
+	const char* i = "Hello World, how are you?";
+	size_t is = strlen(i);
+	int32_t errors = UTF8_ERR_NONE;
+
+	EXPECT_EQ(5, utf8casemapsplit(i, is, 4, nullptr, 0, &errors));
+	EXPECT_ERROREQ(UTF8_ERR_NONE, errors);
+}
+
+TEST(Utf8CaseMapSplit, NotEnoughSpace)
+{
+	const char* i = "Hello World, how are you?";
+	size_t is = strlen(i);
+	size_t o[8] = { 0 };
+	size_t os = 2;
+	int32_t errors = UTF8_ERR_NONE;
+
+	EXPECT_EQ(2, utf8casemapsplit(i, is, 4, o, os, &errors));
+	EXPECT_EQ(0, o[0]);
+	EXPECT_EQ(5, o[1]);
+	EXPECT_ERROREQ(UTF8_ERR_NOT_ENOUGH_SPACE, errors);
+}
+
+TEST(Utf8CaseMapSplit, ConcatenatedTitlecase)
+{
+	const char* i = "\xCE\x9F\xCE\x94\xCE\x9F\xCE\xA3 \xC7\x86ungla \xE4\xB8\xAD\xE6\x96\x87x istanbul";
+	size_t is = strlen(i);
+	size_t o[16] = { 0 };
+	size_t os = 15;
+	char b[256] = { 0 };
+	size_t bs = 0;
+	int32_t errors = UTF8_ERR_NONE;
+
+	size_t count = utf8casemapsplit(i, is, 1, o, os, &errors);
+	EXPECT_EQ(5, count);
+	EXPECT_ERROREQ(UTF8_ERR_NONE, errors);
+
+	o[count] = is;
+
+	for (size_t k = 0; k < count; ++k)
+	{
+		bs += utf8totitle_l(i + o[k], o[k + 1] - o[k], b + bs, 255 - bs, UTF8_LOCALE_TURKISH_AND_AZERI_LATIN, &errors);
+		EXPECT_ERROREQ(UTF8_ERR_NONE, errors);
+	}
+
+	char e[256] = { 0 };
+	EXPECT_EQ(utf8totitle_l(i, is, e, 255, UTF8_LOCALE_TURKISH_AND_AZERI_LATIN, &errors), bs);
+	EXPECT_UTF8EQ(e, b);
+}
\ No newline at end of file
@@ -0,0 +1,240 @@
+#include "tests-base.hpp"
+
+#include "utf8rewind.h"
+
+#include "../helpers/helpers-strings.hpp"
+
+TEST(Utf8CaseSearch, BasicLatin)
+{
+	const char* i = "The quick brown fox jumps over the lazy dog";
+	const char* n = "JUMPS Over";
+	size_t ms = 0;
+	int32_t errors = UTF8_ERR_NONE;
+
+	EXPECT_EQ(i + 20, utf8casesearch(i, strlen(i), n, strlen(n), UTF8_LOCALE_DEFAULT, &ms, &errors));
+	EXPECT_EQ(10, ms);
+	EXPECT_ERROREQ(UTF8_ERR_NONE, errors);
+}
+
+TEST(Utf8CaseSearch, NotFound)
+{
+	const char* i = "The quick brown fox jumps over the lazy dog";
+	const char* n = "cat";
+	size_t ms = 7;
+	int32_t errors = UTF8_ERR_NONE;
+
+	EXPECT_EQ(nullptr, utf8casesearch(i, strlen(i), n, strlen(n), UTF8_LOCALE_DEFAULT, &ms, &errors));
+	EXPECT_EQ(7, ms);
+	EXPECT_ERROREQ(UTF8_ERR_NONE, errors);
+}
+
+TEST(Utf8CaseSearch, NeedleLongerThanInput)
+{
+	const char* i = "dog";
+	const char* n = "DOGS";
+	int32_t errors = UTF8_ERR_NONE;
+
+	EXPECT_EQ(nullptr, utf8casesearch(i, strlen(i), n, strlen(n), UTF8_LOCALE_DEFAULT, nullptr, &errors));
+	EXPECT_ERROREQ(UTF8_ERR_NONE, errors);
+}
+
+TEST(Utf8CaseSearch, LengthChanges)
+{
+	// LATIN SMALL LETTER SHARP S
+
+	const char* i = "Die Stra\xC3\x9F" "e ist lang";
+	const char* n = "STRASSE";
+	size_t ms = 0;
+	int32_t errors = UTF8_ERR_NONE;
+
+	EXPECT_EQ(i + 4, utf8casesearch(i, strlen(i), n, strlen(n), UTF8_LOCALE_DEFAULT, &ms, &errors));
+	EXPECT_EQ(7, ms);
+	EXPECT_ERROREQ(UTF8_ERR_NONE, errors);
+}
+
+TEST(Utf8CaseSearch, LengthChangesInNeedle)
+{
+	// LATIN CAPITAL LETTER SHARP S
+
+	const char* i = "Die STRASSE ist lang";
+	const char* n = "stra\xE1\xBA\x9E" "e";
+	size_t ms = 0;
+	int32_t errors = UTF8_ERR_NONE;
+
+	EXPECT_EQ(i + 4, utf8casesearch(i, strlen(i), n, strlen(n), UTF8_LOCALE_DEFAULT, &ms, &errors));
+	EXPECT_EQ(7, ms);
+	EXPECT_ERROREQ(UTF8_ERR_NONE, errors);
+}
+
+TEST(Utf8CaseSearch, CodePointBoundary)
+{
+	// LATIN SMALL LETTER SHARP S is folded to "ss", which can't be matched halfway
+
+	const char* i = "gro\xC3\x9F";
+	const char* n = "sS";
+	const char* x = "s";
+	size_t ms = 0;
+	int32_t errors = UTF8_ERR_NONE;
+
+	EXPECT_EQ(i + 3, utf8casesearch(i, strlen(i), n, strlen(n), UTF8_LOCALE_DEFAULT, &ms, &errors));
+	EXPECT_EQ(2, ms);
+	EXPECT_EQ(nullptr, utf8casesearch(i, strlen(i), x, strlen(x), UTF8_LOCALE_DEFAULT, &ms, &errors));
+	EXPECT_ERROREQ(UTF8_ERR_NONE, errors);
+}
+
+TEST(Utf8CaseSearch, KelvinSign)
+{
+	const char* i = "273.15 \xE2\x84\xAA" "elvin";
+	const char* n = "kelvin";
+	size_t ms = 0;
+	int32_t errors = UTF8_ERR_NONE;
+
+	EXPECT_EQ(i + 7, utf8casesearch(i, strlen(i), n, strlen(n), UTF8_LOCALE_DEFAULT, &ms, &errors));
+	EXPECT_EQ(8, ms);
+	EXPECT_ERROREQ(UTF8_ERR_NONE, errors);
+}
+
+TEST(Utf8CaseSearch, Greek)
+{
+	const char* i = "\xCE\x9F\xCE\x94\xCE\x9F\xCE\xA3 \xCE\xBF\xCE\xB4\xCE\xBF\xCF\x82";
+	const char* n = "\xCE\xB4\xCE\xBF\xCF\x83";
+	size_t ms = 0;
+	int32_t errors = UTF8_ERR_NONE;
+
+	EXPECT_EQ(i + 2, utf8casesearch(i, strlen(i), n, strlen(n), UTF8_LOCALE_DEFAULT, &ms, &errors));
+	EXPECT_EQ(6, ms);
+	EXPECT_EQ(i + 11, utf8casesearch(i + 8, strlen(i) - 8, n, strlen(n), UTF8_LOCALE_DEFAULT, &ms, &errors));
+	EXPECT_EQ(6, ms);
+	EXPECT_ERROREQ(UTF8_ERR_NONE, errors);
+}
+
+TEST(Utf8CaseSearch, Turkish)
+{
+	const char* i = "Welcome to D\xC4\xB0YARBAKIR";
+	const char* n = "diyarbak\xC4\xB1r";
+	size_t ms = 0;
+	int32_t errors = UTF8_ERR_NONE;
+
+	EXPECT_EQ(nullptr, utf8casesearch(i, strlen(i), n, strlen(n), UTF8_LOCALE_DEFAULT, &ms, &errors));
+	EXPECT_EQ(i + 11, utf8casesearch(i, strlen(i), n, strlen(n), UTF8_LOCALE_TURKISH_AND_AZERI_LATIN, &ms, &errors));
+	EXPECT_EQ(11, ms);
+	EXPECT_ERROREQ(UTF8_ERR_NONE, errors);
+}
+
+TEST(Utf8CaseSearch, LongInput)
+{
+	std::string i;
+
+	for (size_t k = 0; k < 100; ++k)
+	{
+		i += "abcdefgh \xD0\x90\xD0\x91\xD0\x92 ";
+	}
+
+	i += "Needle in a haystack";
+
+	const char* n = "NEEDLE IN A HAYSTACK";
+	size_t ms = 0;
+	int32_t errors = UTF8_ERR_NONE;
+
+	EXPECT_EQ(i.c_str() + 1600, utf8casesearch(i.c_str(), i.length(), n, strlen(n), UTF8_LOCALE_DEFAULT, &ms, &errors));
+	EXPECT_EQ(20, ms);
+	EXPECT_ERROREQ(UTF8_ERR_NONE, errors);
+}
+
+TEST(Utf8CaseSearch, LongNeedle)
+{
+	std::string i = "x";
+	std::string n;
+
+	for (size_t k = 0; k < 60; ++k)
+	{
+		i += "Stra\xC3\x9F" "e ";
+		n += "STRASSE ";
+	}
+
+	i += "y";
+
+	size_t ms = 0;
+	int32_t errors = UTF8_ERR_NONE;
+
+	EXPECT_EQ(i.c_str() + 1, utf8casesearch(i.c_str(), i.length(), n.c_str(), n.length(), UTF8_LOCALE_DEFAULT, &ms, &errors));
+	EXPECT_EQ(480, ms);
+	EXPECT_EQ(nullptr, utf8casesearch(i.c_str() + 2, i.length() - 2, n.c_str(), n.length(), UTF8_LOCALE_DEFAULT, &ms, &errors));
+	EXPECT_ERROREQ(UTF8_ERR_NONE, errors);
+}
+
+TEST(Utf8CaseSearch, MultipleMatches)
+{
+	const char* i = "Ab ab \xC3\x85" "B aB";
+	const char* n = "ab";
+	const char* s = i;
+	const char* s_end = i + strlen(i);
+	const char* m;
+	size_t ms = 0;
+	size_t count = 0;
+	int32_t errors = UTF8_ERR_NONE;
+
+	while ((m = utf8casesearch(s, s_end - s, n, strlen(n), UTF8_LOCALE_DEFAULT, &ms, &errors)) != nullptr)
+	{
+		count++;
+		s = m + ms;
+	}
+
+	EXPECT_EQ(3, count);
+	EXPECT_ERROREQ(UTF8_ERR_NONE, errors);
+}
+
+TEST(Utf8CaseSearch, InvalidData)
+{
+	const char* i = "ab\xFF" "cd";
+	const char* n = "B\xEF\xBF\xBD" "C";
+	size_t ms = 0;
+	int32_t errors = UTF8_ERR_NONE;
+
+	EXPECT_EQ(i + 1, utf8casesearch(i, strlen(i), n, strlen(n), UTF8_LOCALE_DEFAULT, &ms, &errors));
+	EXPECT_EQ(3, ms);
+	EXPECT_ERROREQ(UTF8_ERR_NONE, errors);
+}
+
+TEST(Utf8CaseSearch, EmptyNeedle)
+{
+	const char* i = "abc";
+	size_t ms = 7;
+	int32_t errors = UTF8_ERR_NONE;
+
+	EXPECT_EQ(i, utf8casesearch(i, strlen(i), "", 0, UTF8_LOCALE_DEFAULT, &ms, &errors));
+	EXPECT_EQ(0, ms);
+	EXPECT_ERROREQ(UTF8_ERR_NONE, errors);
+}
+
+TEST(Utf8CaseSearch, EmptyInput)
+{
+	int32_t errors = UTF8_ERR_NONE;
+
+	EXPECT_EQ(nullptr, utf8casesearch("", 0, "a", 1, UTF8_LOCALE_DEFAULT, nullptr, &errors));
+	EXPECT_ERROREQ(UTF8_ERR_NONE, errors);
+}
+
+TEST(Utf8CaseSearch, InputNull)
+{
+	int32_t errors = UTF8_ERR_NONE;
+
+	EXPECT_EQ(nullptr, utf8casesearch(nullptr, 1, "a", 1, UTF8_LOCALE_DEFAULT, nullptr, &errors));
+	EXPECT_ERROREQ(UTF8_ERR_INVALID_DATA, errors);
+}
+
+TEST(Utf8CaseSearch, NeedleNull)
+{
+	int32_t errors = UTF8_ERR_NONE;
+
+	EXPECT_EQ(nullptr, utf8casesearch("a", 1, nullptr, 1, UTF8_LOCALE_DEFAULT, nullptr, &errors));
+	EXPECT_ERROREQ(UTF8_ERR_INVALID_DATA, errors);
+}
+
+TEST(Utf8CaseSearch, InvalidLocale)
+{
+	int32_t errors = UTF8_ERR_NONE;
+
+	EXPECT_EQ(nullptr, utf8casesearch("a", 1, "a", 1, UTF8_LOCALE_MAXIMUM, nullptr, &errors));
+	EXPECT_ERROREQ(UTF8_ERR_INVALID_LOCALE, errors);
+}
\ No newline at end of file
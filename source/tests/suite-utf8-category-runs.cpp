@@ -0,0 +1,263 @@
+#include "tests-base.hpp"
+
+#include "utf8rewind.h"
+
+TEST(Utf8CategoryRuns, InvalidData)
+{
+	const size_t c[] = { UTF8_CATEGORY_LETTER };
+	utf8categoryrun_t r[8];
+	int32_t errors = UTF8_ERR_NONE;
+
+	EXPECT_EQ(0, utf8categoryruns(nullptr, 4, c, 1, r, 8, &errors));
+	EXPECT_ERROREQ(UTF8_ERR_INVALID_DATA, errors);
+}
+
+TEST(Utf8CategoryRuns, InvalidFlag)
+{
+	const char* i = "Hello";
+	size_t is = strlen(i);
+	const size_t c[] = { UTF8_CATEGORY_LETTER };
+	utf8categoryrun_t r[8];
+	int32_t errors = UTF8_ERR_NONE;
+
+	EXPECT_EQ(0, utf8categoryruns(i, is, c, 0, r, 8, &errors));
+	EXPECT_ERROREQ(UTF8_ERR_INVALID_FLAG, errors);
+
+	EXPECT_EQ(0, utf8categoryruns(i, is, nullptr, 1, r, 8, &errors));
+	EXPECT_ERROREQ(UTF8_ERR_INVALID_FLAG, errors);
+}
+
+TEST(Utf8CategoryRuns, Empty)
+{
+	const size_t c[] = { UTF8_CATEGORY_LETTER };
+	utf8categoryrun_t r[8];
+	int32_t errors = UTF8_ERR_NONE;
+
+	EXPECT_EQ(0, utf8categoryruns("", 0, c, 1, r, 8, &errors));
+	EXPECT_ERROREQ(UTF8_ERR_NONE, errors);
+}
+
+TEST(Utf8CategoryRuns, BasicLatin)
+{
+	const char* i = "abc 123, de";
+	size_t is = strlen(i);
+	const size_t c[] = { UTF8_CATEGORY_LETTER, UTF8_CATEGORY_NUMBER, UTF8_CATEGORY_SEPARATOR_SPACE };
+	utf8categoryrun_t r[8];
+	int32_t errors = UTF8_ERR_NONE;
+
+	EXPECT_EQ(6, utf8categoryruns(i, is, c, 3, r, 8, &errors));
+	EXPECT_EQ(0, r[0].offset);
+	EXPECT_EQ(3, r[0].length);
+	EXPECT_EQ(0, r[0].category);
+	EXPECT_EQ(3, r[1].offset);
+	EXPECT_EQ(1, r[1].length);
+	EXPECT_EQ(2, r[1].category);
+	EXPECT_EQ(4, r[2].offset);
+	EXPECT_EQ(3, r[2].length);
+	EXPECT_EQ(1, r[2].category);
+	EXPECT_EQ(7, r[3].offset);
+	EXPECT_EQ(1, r[3].length);
+	EXPECT_EQ(3, r[3].category);
+	EXPECT_EQ(8, r[4].offset);
+	EXPECT_EQ(1, r[4].length);
+	EXPECT_EQ(2, r[4].category);
+	EXPECT_EQ(9, r[5].offset);
+	EXPECT_EQ(2, r[5].length);
+	EXPECT_EQ(0, r[5].category);
+	EXPECT_ERROREQ(UTF8_ERR_NONE, errors);
+}
+
+TEST(Utf8CategoryRuns, FirstMatchingCategory)
+{
+	const char* i = "AbC";
+	size_t is = strlen(i);
+	const size_t c[] = { UTF8_CATEGORY_LETTER_UPPERCASE, UTF8_CATEGORY_LETTER };
+	utf8categoryrun_t r[8];
+	int32_t errors = UTF8_ERR_NONE;
+
+	EXPECT_EQ(3, utf8categoryruns(i, is, c, 2, r, 8, &errors));
+	EXPECT_EQ(0, r[0].category);
+	EXPECT_EQ(1, r[1].category);
+	EXPECT_EQ(0, r[2].category);
+	EXPECT_ERROREQ(UTF8_ERR_NONE, errors);
+}
+
+TEST(Utf8CategoryRuns, MultiByte)
+{
+	const char* i = "\xCE\x9A\xCE\xB1\xE3\x80\x80\xD9\xA1\xD9\xA2" "3";
+	size_t is = strlen(i);
+	const size_t c[] = { UTF8_CATEGORY_LETTER, UTF8_CATEGORY_NUMBER, UTF8_CATEGORY_SEPARATOR_SPACE };
+	utf8categoryrun_t r[8];
+	int32_t errors = UTF8_ERR_NONE;
+
+	EXPECT_EQ(3, utf8categoryruns(i, is, c, 3, r, 8, &errors));
+	EXPECT_EQ(0, r[0].offset);
+	EXPECT_EQ(4, r[0].length);
+	EXPECT_EQ(0, r[0].category);
+	EXPECT_EQ(4, r[1].offset);
+	EXPECT_EQ(3, r[1].length);
+	EXPECT_EQ(2, r[1].category);
+	EXPECT_EQ(7, r[2].offset);
+	EXPECT_EQ(5, r[2].length);
+	EXPECT_EQ(1, r[2].category);
+	EXPECT_ERROREQ(UTF8_ERR_NONE, errors);
+}
+
+TEST(Utf8CategoryRuns, GraphemeCluster)
+{
+	// LATIN SMALL LETTER E and COMBINING ACUTE ACCENT
+
+	const char* i = "e\xCC\x81" "1\xCC\x81";
+	size_t is = strlen(i);
+	const size_t c[] = { UTF8_CATEGORY_LETTER, UTF8_CATEGORY_NUMBER };
+	utf8categoryrun_t r[8];
+	int32_t errors = UTF8_ERR_NONE;
+
+	EXPECT_EQ(2, utf8categoryruns(i, is, c, 2, r, 8, &errors));
+	EXPECT_EQ(0, r[0].offset);
+	EXPECT_EQ(3, r[0].length);
+	EXPECT_EQ(0, r[0].category);
+	EXPECT_EQ(3, r[1].offset);
+	EXPECT_EQ(3, r[1].length);
+	EXPECT_EQ(1, r[1].category);
+	EXPECT_ERROREQ(UTF8_ERR_NONE, errors);
+}
+
+TEST(Utf8CategoryRuns, IgnoreGraphemeCluster)
+{
+	const char* i = "e\xCC\x81" "f";
+	size_t is = strlen(i);
+	const size_t c[] = { UTF8_CATEGORY_LETTER | UTF8_CATEGORY_IGNORE_GRAPHEME_CLUSTER };
+	utf8categoryrun_t r[8];
+	int32_t errors = UTF8_ERR_NONE;
+
+	EXPECT_EQ(3, utf8categoryruns(i, is, c, 1, r, 8, &errors));
+	EXPECT_EQ(0, r[0].offset);
+	EXPECT_EQ(1, r[0].length);
+	EXPECT_EQ(0, r[0].category);
+	EXPECT_EQ(1, r[1].offset);
+	EXPECT_EQ(2, r[1].length);
+	EXPECT_EQ(1, r[1].category);
+	EXPECT_EQ(3, r[2].offset);
+	EXPECT_EQ(1, r[2].length);
+	EXPECT_EQ(0, r[2].category);
+	EXPECT_ERROREQ(UTF8_ERR_NONE, errors);
+}
+
+TEST(Utf8CategoryRuns, Compatibility)
+{
+	const char* i = "ff\tx";
+	size_t is = strlen(i);
+	const size_t c[] = { UTF8_CATEGORY_ISXDIGIT, UTF8_CATEGORY_ISSPACE };
+	utf8categoryrun_t r[8];
+	int32_t errors = UTF8_ERR_NONE;
+
+	EXPECT_EQ(3, utf8categoryruns(i, is, c, 2, r, 8, &errors));
+	EXPECT_EQ(0, r[0].category);
+	EXPECT_EQ(2, r[0].length);
+	EXPECT_EQ(1, r[1].category);
+	EXPECT_EQ(1, r[1].length);
+	EXPECT_EQ(2, r[2].category);
+	EXPECT_EQ(1, r[2].length);
+	EXPECT_ERROREQ(UTF8_ERR_NONE, errors);
+}
+
+TEST(Utf8CategoryRuns, InvalidSequence)
+{
+	const char* i = "ab\xFF\xFE" "c";
+	size_t is = strlen(i);
+	const size_t c[] = { UTF8_CATEGORY_LETTER };
+	utf8categoryrun_t r[8];
+	int32_t errors = UTF8_ERR_NONE;
+
+	EXPECT_EQ(3, utf8categoryruns(i, is, c, 1, r, 8, &errors));
+	EXPECT_EQ(2, r[1].offset);
+	EXPECT_EQ(2, r[1].length);
+	EXPECT_EQ(1, r[1].category);
+	EXPECT_ERROREQ(UTF8_ERR_NONE, errors);
+}
+
+TEST(Utf8CategoryRuns, AmountOfRuns)
+{
+	const char* i = "abc 123, de";
+	size_t is = strlen(i);
+	const size_t c[] = { UTF8_CATEGORY_LETTER, UTF8_CATEGORY_NUMBER, UTF8_CATEGORY_SEPARATOR_SPACE };
+	int32_t errors = UTF8_ERR_NONE;
+
+	EXPECT_EQ(6, utf8categoryruns(i, is, c, 3, nullptr, 0, &errors));
+	EXPECT_ERROREQ(UTF8_ERR_NONE, errors);
+}
+
+TEST(Utf8CategoryRuns, NotEnoughSpace)
+{
+	const char* i = "abc 123, de";
+	size_t is = strlen(i);
+	const size_t c[] = { UTF8_CATEGORY_LETTER, UTF8_CATEGORY_NUMBER, UTF8_CATEGORY_SEPARATOR_SPACE };
+	utf8categoryrun_t r[8];
+	int32_t errors = UTF8_ERR_NONE;
+
+	EXPECT_EQ(2, utf8categoryruns(i, is, c, 3, r, 2, &errors));
+	EXPECT_EQ(0, r[0].offset);
+	EXPECT_EQ(3, r[0].length);
+	EXPECT_EQ(3, r[1].offset);
+	EXPECT_EQ(1, r[1].length);
+	EXPECT_ERROREQ(UTF8_ERR_NOT_ENOUGH_SPACE, errors);
+}
+
+TEST(Utf8CategoryCspan, BasicLatin)
+{
+	const char* i = "abc 123";
+	size_t is = strlen(i);
+
+	EXPECT_EQ(4, utf8categorycspan(i, is, UTF8_CATEGORY_NUMBER));
+	EXPECT_EQ(3, utf8categorycspan(i, is, UTF8_CATEGORY_SEPARATOR_SPACE));
+	EXPECT_EQ(0, utf8categorycspan(i, is, UTF8_CATEGORY_LETTER));
+}
+
+TEST(Utf8CategoryCspan, NotFound)
+{
+	const char* i = "abc def";
+	size_t is = strlen(i);
+
+	EXPECT_EQ(7, utf8categorycspan(i, is, UTF8_CATEGORY_NUMBER));
+}
+
+TEST(Utf8CategoryCspan, MultiByte)
+{
+	const char* i = "\xCE\x9A\xCE\xB1\xE3\x80\x80\xD9\xA1";
+	size_t is = strlen(i);
+
+	EXPECT_EQ(4, utf8categorycspan(i, is, UTF8_CATEGORY_SEPARATOR_SPACE));
+	EXPECT_EQ(7, utf8categorycspan(i, is, UTF8_CATEGORY_NUMBER));
+}
+
+TEST(Utf8CategoryCspan, GraphemeCluster)
+{
+	// COMBINING ACUTE ACCENT is part of the grapheme cluster of LATIN SMALL LETTER E
+
+	const char* i = "e\xCC\x81\xCC\x81";
+	size_t is = strlen(i);
+
+	EXPECT_EQ(5, utf8categorycspan(i, is, UTF8_CATEGORY_MARK));
+	EXPECT_EQ(1, utf8categorycspan(i, is, UTF8_CATEGORY_MARK | UTF8_CATEGORY_IGNORE_GRAPHEME_CLUSTER));
+	EXPECT_EQ(0, utf8categorycspan(i + 1, is - 1, UTF8_CATEGORY_MARK));
+}
+
+TEST(Utf8CategoryCspan, Compatibility)
+{
+	const char* i = "xyz\t0";
+	size_t is = strlen(i);
+
+	EXPECT_EQ(3, utf8categorycspan(i, is, UTF8_CATEGORY_ISBLANK));
+	EXPECT_EQ(4, utf8categorycspan(i, is, UTF8_CATEGORY_ISXDIGIT));
+}
+
+TEST(Utf8CategoryCspan, InputNull)
+{
+	EXPECT_EQ(0, utf8categorycspan(nullptr, 1, UTF8_CATEGORY_NUMBER));
+}
+
+TEST(Utf8CategoryCspan, InputEmpty)
+{
+	EXPECT_EQ(0, utf8categorycspan("", 0, UTF8_CATEGORY_NUMBER));
+}
\ No newline at end of file
@@ -0,0 +1,226 @@
+#include "tests-base.hpp"
+
+#include "utf8rewind.h"
+
+class Utf8CharSet
+	: public ::testing::Test
+{
+
+protected:
+
+	size_t compile(size_t flags, const utf8range_t* include, size_t includeSize, const utf8range_t* exclude, size_t excludeSize)
+	{
+		int32_t errors = UTF8_ERR_NONE;
+
+		size_t size = utf8charsetcompile(nullptr, flags, include, includeSize, exclude, excludeSize, nullptr, 0, &errors);
+		EXPECT_ERROREQ(UTF8_ERR_NONE, errors);
+
+		data.resize(size);
+
+		EXPECT_EQ(size, utf8charsetcompile(&set, flags, include, includeSize, exclude, excludeSize, &data[0], data.size(), &errors));
+		EXPECT_ERROREQ(UTF8_ERR_NONE, errors);
+
+		return size;
+	}
+
+	utf8charset_t set;
+	std::vector<uint32_t> data;
+
+};
+
+TEST_F(Utf8CharSet, CompileInvalidRange)
+{
+	const utf8range_t r[] = { { 0x0041, 0x005A }, { 0x0100, 0x00FF } };
+	int32_t errors = UTF8_ERR_NONE;
+
+	EXPECT_EQ(0, utf8charsetcompile(nullptr, 0, r, 2, nullptr, 0, nullptr, 0, &errors));
+	EXPECT_ERROREQ(UTF8_ERR_INVALID_DATA, errors);
+}
+
+TEST_F(Utf8CharSet, CompileRangeOutOfBounds)
+{
+	const utf8range_t r[] = { { 0x10FFFF, 0x110000 } };
+	int32_t errors = UTF8_ERR_NONE;
+
+	EXPECT_EQ(0, utf8charsetcompile(nullptr, 0, nullptr, 0, r, 1, nullptr, 0, &errors));
+	EXPECT_ERROREQ(UTF8_ERR_INVALID_DATA, errors);
+}
+
+TEST_F(Utf8CharSet, CompileRangesNull)
+{
+	int32_t errors = UTF8_ERR_NONE;
+
+	EXPECT_EQ(0, utf8charsetcompile(nullptr, 0, nullptr, 1, nullptr, 0, nullptr, 0, &errors));
+	EXPECT_ERROREQ(UTF8_ERR_INVALID_DATA, errors);
+}
+
+TEST_F(Utf8CharSet, CompileSetNull)
+{
+	uint32_t d[1024];
+	int32_t errors = UTF8_ERR_NONE;
+
+	EXPECT_EQ(0, utf8charsetcompile(nullptr, UTF8_CATEGORY_LETTER, nullptr, 0, nullptr, 0, d, 1024, &errors));
+	EXPECT_ERROREQ(UTF8_ERR_INVALID_DATA, errors);
+}
+
+TEST_F(Utf8CharSet, CompileNotEnoughSpace)
+{
+	const utf8range_t r[] = { { 0x0041, 0x005A } };
+	uint32_t d[1024];
+	int32_t errors = UTF8_ERR_NONE;
+
+	size_t size = utf8charsetcompile(nullptr, 0, r, 1, nullptr, 0, nullptr, 0, &errors);
+	EXPECT_ERROREQ(UTF8_ERR_NONE, errors);
+
+	EXPECT_EQ(0, utf8charsetcompile(&set, 0, r, 1, nullptr, 0, d, size - 1, &errors));
+	EXPECT_ERROREQ(UTF8_ERR_NOT_ENOUGH_SPACE, errors);
+
+	EXPECT_EQ(0, utf8charsetcompile(&set, 0, r, 1, nullptr, 0, d, 16, &errors));
+	EXPECT_ERROREQ(UTF8_ERR_NOT_ENOUGH_SPACE, errors);
+}
+
+TEST_F(Utf8CharSet, CompileEmpty)
+{
+	compile(0, nullptr, 0, nullptr, 0);
+
+	EXPECT_EQ(0, utf8charsetcontains(&set, 0x0000));
+	EXPECT_EQ(0, utf8charsetcontains(&set, 0x0041));
+	EXPECT_EQ(0, utf8charsetcontains(&set, 0x10FFFF));
+}
+
+TEST_F(Utf8CharSet, CompileSharesBlocks)
+{
+	// Han and Hiragana
+
+	const utf8range_t r[] = { { 0x3040, 0x309F }, { 0x4E00, 0x9FFF }, { 0x20000, 0x2A6DF } };
+
+	size_t size = compile(0, r, 3, nullptr, 0);
+	EXPECT_GT(4096, size);
+
+	EXPECT_EQ(1, utf8charsetcontains(&set, 0x3042));
+	EXPECT_EQ(1, utf8charsetcontains(&set, 0x3042));
+	EXPECT_EQ(1, utf8charsetcontains(&set, 0x9FFF));
+	EXPECT_EQ(1, utf8charsetcontains(&set, 0x20000));
+	EXPECT_EQ(0, utf8charsetcontains(&set, 0x30A2));
+	EXPECT_EQ(0, utf8charsetcontains(&set, 0xA000));
+	EXPECT_EQ(0, utf8charsetcontains(&set, 0x0041));
+}
+
+TEST_F(Utf8CharSet, ContainsCategory)
+{
+	compile(UTF8_CATEGORY_LETTER | UTF8_CATEGORY_NUMBER_DECIMAL, nullptr, 0, nullptr, 0);
+
+	EXPECT_EQ(1, utf8charsetcontains(&set, 0x0041));
+	EXPECT_EQ(1, utf8charsetcontains(&set, 0x0039));
+	EXPECT_EQ(1, utf8charsetcontains(&set, 0x00AA));
+	EXPECT_EQ(1, utf8charsetcontains(&set, 0x039A));
+	EXPECT_EQ(1, utf8charsetcontains(&set, 0x0661));
+	EXPECT_EQ(1, utf8charsetcontains(&set, 0x3042));
+	EXPECT_EQ(0, utf8charsetcontains(&set, 0x0020));
+	EXPECT_EQ(0, utf8charsetcontains(&set, 0x0301));
+	EXPECT_EQ(0, utf8charsetcontains(&set, 0x1F600));
+}
+
+TEST_F(Utf8CharSet, ContainsCategoryExcluded)
+{
+	// FEMININE ORDINAL INDICATOR
+
+	const utf8range_t r[] = { { 0x00AA, 0x00AA } };
+
+	compile(UTF8_CATEGORY_LETTER | UTF8_CATEGORY_NUMBER_DECIMAL, nullptr, 0, r, 1);
+
+	EXPECT_EQ(1, utf8charsetcontains(&set, 0x00B5));
+	EXPECT_EQ(0, utf8charsetcontains(&set, 0x00AA));
+}
+
+TEST_F(Utf8CharSet, ContainsExcludeOverridesInclude)
+{
+	const utf8range_t i[] = { { 0x0061, 0x007A } };
+	const utf8range_t e[] = { { 0x0078, 0x0078 } };
+
+	compile(0, i, 1, e, 1);
+
+	EXPECT_EQ(1, utf8charsetcontains(&set, 0x0061));
+	EXPECT_EQ(1, utf8charsetcontains(&set, 0x007A));
+	EXPECT_EQ(0, utf8charsetcontains(&set, 0x0078));
+	EXPECT_EQ(0, utf8charsetcontains(&set, 0x0041));
+}
+
+TEST_F(Utf8CharSet, ContainsCompatibility)
+{
+	compile(UTF8_CATEGORY_ISXDIGIT, nullptr, 0, nullptr, 0);
+
+	EXPECT_EQ(1, utf8charsetcontains(&set, 0x0030));
+	EXPECT_EQ(1, utf8charsetcontains(&set, 0x0046));
+	EXPECT_EQ(1, utf8charsetcontains(&set, 0x0066));
+	EXPECT_EQ(0, utf8charsetcontains(&set, 0x0047));
+	EXPECT_EQ(0, utf8charsetcontains(&set, 0x0067));
+}
+
+TEST_F(Utf8CharSet, ContainsOutOfBounds)
+{
+	const utf8range_t r[] = { { 0x0000, 0x10FFFF } };
+
+	compile(0, r, 1, nullptr, 0);
+
+	EXPECT_EQ(1, utf8charsetcontains(&set, 0x10FFFF));
+	EXPECT_EQ(0, utf8charsetcontains(&set, 0x110000));
+	EXPECT_EQ(0, utf8charsetcontains(nullptr, 0x0041));
+}
+
+TEST_F(Utf8CharSet, Span)
+{
+	const char* i = "Stra\xC3\x9F" "e42 \xCE\x9A\xCE\xB1";
+	size_t is = strlen(i);
+
+	compile(UTF8_CATEGORY_LETTER | UTF8_CATEGORY_NUMBER_DECIMAL, nullptr, 0, nullptr, 0);
+
+	EXPECT_EQ(9, utf8charsetspan(&set, i, is));
+	EXPECT_EQ(0, utf8charsetspan(&set, i + 9, is - 9));
+	EXPECT_EQ(4, utf8charsetspan(&set, i + 10, is - 10));
+}
+
+TEST_F(Utf8CharSet, SpanInvalidData)
+{
+	// U+FFFD REPLACEMENT CHARACTER
+
+	const utf8range_t r[] = { { 0x0061, 0x007A }, { 0xFFFD, 0xFFFD } };
+	const char* i = "ab\xFF" "c\xE4\xB8" " d";
+	size_t is = strlen(i);
+
+	compile(0, r, 2, nullptr, 0);
+
+	EXPECT_EQ(6, utf8charsetspan(&set, i, is));
+}
+
+TEST_F(Utf8CharSet, SpanEmpty)
+{
+	compile(UTF8_CATEGORY_LETTER, nullptr, 0, nullptr, 0);
+
+	EXPECT_EQ(0, utf8charsetspan(&set, "", 0));
+	EXPECT_EQ(0, utf8charsetspan(&set, nullptr, 1));
+	EXPECT_EQ(0, utf8charsetspan(nullptr, "abc", 3));
+}
+
+TEST_F(Utf8CharSet, ComplementSpan)
+{
+	const char* i = "Page 3: \xCE\x9A\xCE\xB1 \xD9\xA1";
+	size_t is = strlen(i);
+
+	compile(UTF8_CATEGORY_NUMBER_DECIMAL, nullptr, 0, nullptr, 0);
+
+	EXPECT_EQ(5, utf8charsetcspan(&set, i, is));
+	EXPECT_EQ(7, utf8charsetcspan(&set, i + 6, is - 6));
+	EXPECT_EQ(0, utf8charsetcspan(&set, i + 13, is - 13));
+}
+
+TEST_F(Utf8CharSet, ComplementSpanNotFound)
+{
+	const char* i = "abc \xCE\x9A\xCE\xB1";
+	size_t is = strlen(i);
+
+	compile(UTF8_CATEGORY_NUMBER_DECIMAL, nullptr, 0, nullptr, 0);
+
+	EXPECT_EQ(is, utf8charsetcspan(&set, i, is));
+	EXPECT_EQ(0, utf8charsetcspan(nullptr, i, is));
+}
\ No newline at end of file
@@ -0,0 +1,234 @@
+#include "tests-base.hpp"
+
+#include "utf8rewind.h"
+
+#include "../helpers/helpers-strings.hpp"
+
+TEST(Utf8GraphemeLen, BasicLatin)
+{
+	const char* t = "Hello, World!";
+
+	EXPECT_EQ(13, utf8graphemelen(t, strlen(t)));
+}
+
+TEST(Utf8GraphemeLen, CombiningMarks)
+{
+	// LATIN SMALL LETTER E, COMBINING ACUTE ACCENT, COMBINING DOT BELOW
+
+	const char* t = "e\xCC\x81\xCC\xA3z";
+
+	EXPECT_EQ(2, utf8graphemelen(t, strlen(t)));
+}
+
+TEST(Utf8GraphemeLen, CarriageReturnLineFeed)
+{
+	const char* t = "a\r\nb\n\rc";
+
+	EXPECT_EQ(6, utf8graphemelen(t, strlen(t)));
+}
+
+TEST(Utf8GraphemeLen, ControlBeforeMark)
+{
+	// COMBINING ACUTE ACCENT after LINE FEED starts a new cluster
+
+	const char* t = "\n\xCC\x81";
+
+	EXPECT_EQ(2, utf8graphemelen(t, strlen(t)));
+}
+
+TEST(Utf8GraphemeLen, HangulJamo)
+{
+	// HANGUL CHOSEONG KIYEOK, HANGUL JUNGSEONG A, HANGUL JONGSEONG KIYEOK
+
+	const char* t = "\xE1\x84\x80\xE1\x85\xA1\xE1\x86\xA8\xE1\x84\x80";
+
+	EXPECT_EQ(2, utf8graphemelen(t, strlen(t)));
+}
+
+TEST(Utf8GraphemeLen, HangulSyllables)
+{
+	// HANGUL SYLLABLE GA, HANGUL JONGSEONG KIYEOK, HANGUL SYLLABLE GAG
+
+	const char* t = "\xEA\xB0\x80\xE1\x86\xA8\xEA\xB0\x81\xE1\x85\xA1";
+
+	EXPECT_EQ(3, utf8graphemelen(t, strlen(t)));
+}
+
+TEST(Utf8GraphemeLen, RegionalIndicators)
+{
+	// Flags of the Netherlands and Belgium followed by a lone REGIONAL INDICATOR SYMBOL LETTER A
+
+	const char* t = "\xF0\x9F\x87\xB3\xF0\x9F\x87\xB1\xF0\x9F\x87\xA7\xF0\x9F\x87\xAA\xF0\x9F\x87\xA6";
+
+	EXPECT_EQ(3, utf8graphemelen(t, strlen(t)));
+}
+
+TEST(Utf8GraphemeLen, EmojiZeroWidthJoinerSequence)
+{
+	// MAN, ZERO WIDTH JOINER, WOMAN, ZERO WIDTH JOINER, GIRL
+
+	const char* t = "\xF0\x9F\x91\xA8\xE2\x80\x8D\xF0\x9F\x91\xA9\xE2\x80\x8D\xF0\x9F\x91\xA7";
+
+	EXPECT_EQ(1, utf8graphemelen(t, strlen(t)));
+}
+
+TEST(Utf8GraphemeLen, EmojiModifierAndVariationSelector)
+{
+	// WAVING HAND SIGN, EMOJI MODIFIER FITZPATRICK TYPE-1-2, HEAVY BLACK HEART, VARIATION SELECTOR-16
+
+	const char* t = "\xF0\x9F\x91\x8B\xF0\x9F\x8F\xBB\xE2\x9D\xA4\xEF\xB8\x8F";
+
+	EXPECT_EQ(2, utf8graphemelen(t, strlen(t)));
+}
+
+TEST(Utf8GraphemeLen, ZeroWidthJoinerWithoutPictographic)
+{
+	// ZERO WIDTH JOINER only joins pictographs
+
+	const char* t = "a\xE2\x80\x8D" "b";
+
+	EXPECT_EQ(2, utf8graphemelen(t, strlen(t)));
+}
+
+TEST(Utf8GraphemeLen, PrependAndSpacingMark)
+{
+	// ARABIC NUMBER SIGN, ARABIC-INDIC DIGIT ONE, DEVANAGARI LETTER KA, DEVANAGARI VOWEL SIGN I
+
+	const char* t = "\xD8\x80\xD9\xA1\xE0\xA4\x95\xE0\xA4\xBF";
+
+	EXPECT_EQ(2, utf8graphemelen(t, strlen(t)));
+}
+
+TEST(Utf8GraphemeLen, InvalidData)
+{
+	const char* t = "\xE4\xB8" "a\xCC\x81\xFF\xCC\x81";
+
+	EXPECT_EQ(3, utf8graphemelen(t, strlen(t)));
+}
+
+TEST(Utf8GraphemeLen, Empty)
+{
+	EXPECT_EQ(0, utf8graphemelen("", 0));
+}
+
+TEST(Utf8GraphemeLen, TextNull)
+{
+	EXPECT_EQ(0, utf8graphemelen(nullptr, 4));
+}
+
+TEST(Utf8GraphemeSeek, SetForward)
+{
+	const char* t = "e\xCC\x81\xF0\x9F\x87\xB3\xF0\x9F\x87\xB1x";
+
+	EXPECT_EQ(0, utf8graphemeseek(t, strlen(t), t, 0, SEEK_SET) - t);
+	EXPECT_EQ(3, utf8graphemeseek(t, strlen(t), t, 1, SEEK_SET) - t);
+	EXPECT_EQ(11, utf8graphemeseek(t, strlen(t), t, 2, SEEK_SET) - t);
+	EXPECT_EQ(12, utf8graphemeseek(t, strlen(t), t, 3, SEEK_SET) - t);
+}
+
+TEST(Utf8GraphemeSeek, SetPastEnd)
+{
+	const char* t = "e\xCC\x81\xF0\x9F\x87\xB3\xF0\x9F\x87\xB1x";
+
+	EXPECT_EQ(12, utf8graphemeseek(t, strlen(t), t, 8, SEEK_SET) - t);
+}
+
+TEST(Utf8GraphemeSeek, CurrentForward)
+{
+	const char* t = "\xF0\x9F\x91\xA8\xE2\x80\x8D\xF0\x9F\x91\xA9 ok";
+	const char* r = utf8graphemeseek(t, strlen(t), t, 1, SEEK_CUR);
+
+	EXPECT_EQ(11, r - t);
+
+	r = utf8graphemeseek(r, strlen(t), t, 2, SEEK_CUR);
+
+	EXPECT_EQ(13, r - t);
+}
+
+TEST(Utf8GraphemeSeek, CurrentBackward)
+{
+	const char* t = "a\xF0\x9F\x87\xB3\xF0\x9F\x87\xB1\xF0\x9F\x87\xA7\xF0\x9F\x87\xAA";
+	const char* e = t + strlen(t);
+
+	EXPECT_EQ(9, utf8graphemeseek(e, strlen(t), t, -1, SEEK_CUR) - t);
+	EXPECT_EQ(1, utf8graphemeseek(e, strlen(t), t, -2, SEEK_CUR) - t);
+	EXPECT_EQ(0, utf8graphemeseek(e, strlen(t), t, -3, SEEK_CUR) - t);
+	EXPECT_EQ(0, utf8graphemeseek(e, strlen(t), t, -4, SEEK_CUR) - t);
+}
+
+TEST(Utf8GraphemeSeek, CurrentBackwardInsideCluster)
+{
+	// Position of COMBINING DOT BELOW moves to the start of the cluster
+
+	const char* t = "xe\xCC\x81\xCC\xA3";
+
+	EXPECT_EQ(1, utf8graphemeseek(t + 4, strlen(t), t, -1, SEEK_CUR) - t);
+}
+
+TEST(Utf8GraphemeSeek, CurrentBackwardZeroWidthJoinerSequence)
+{
+	const char* t = "\xF0\x9F\x91\xA8\xE2\x80\x8D\xF0\x9F\x91\xA9\xE2\x80\x8D\xF0\x9F\x91\xA7\xF0\x9F\x91\xA7";
+	const char* e = t + strlen(t);
+
+	EXPECT_EQ(18, utf8graphemeseek(e, strlen(t), t, -1, SEEK_CUR) - t);
+	EXPECT_EQ(0, utf8graphemeseek(e, strlen(t), t, -2, SEEK_CUR) - t);
+}
+
+TEST(Utf8GraphemeSeek, CurrentBackwardCarriageReturnLineFeed)
+{
+	const char* t = "ab\r\n";
+	const char* e = t + strlen(t);
+
+	EXPECT_EQ(2, utf8graphemeseek(e, strlen(t), t, -1, SEEK_CUR) - t);
+	EXPECT_EQ(1, utf8graphemeseek(e, strlen(t), t, -2, SEEK_CUR) - t);
+}
+
+TEST(Utf8GraphemeSeek, EndBackward)
+{
+	const char* t = "e\xCC\x81\xF0\x9F\x87\xB3\xF0\x9F\x87\xB1x";
+
+	EXPECT_EQ(12, utf8graphemeseek(t, strlen(t), t, 0, SEEK_END) - t);
+	EXPECT_EQ(11, utf8graphemeseek(t, strlen(t), t, 1, SEEK_END) - t);
+	EXPECT_EQ(3, utf8graphemeseek(t, strlen(t), t, 2, SEEK_END) - t);
+	EXPECT_EQ(0, utf8graphemeseek(t, strlen(t), t, 3, SEEK_END) - t);
+	EXPECT_EQ(0, utf8graphemeseek(t, strlen(t), t, 4, SEEK_END) - t);
+}
+
+TEST(Utf8GraphemeSeek, EndLongRegionalIndicators)
+{
+	std::string t = "x";
+
+	for (size_t k = 0; k < 101; ++k)
+	{
+		t += "\xF0\x9F\x87\xB3";
+	}
+
+	const char* s = t.c_str();
+	const char* e = s + t.length();
+
+	EXPECT_EQ(401, utf8graphemeseek(e, t.length(), s, -1, SEEK_CUR) - s);
+	EXPECT_EQ(393, utf8graphemeseek(e, t.length(), s, -2, SEEK_CUR) - s);
+	EXPECT_EQ(1, utf8graphemeseek(e, t.length(), s, -51, SEEK_CUR) - s);
+	EXPECT_EQ(0, utf8graphemeseek(e, t.length(), s, -52, SEEK_CUR) - s);
+}
+
+TEST(Utf8GraphemeSeek, Truncate)
+{
+	const char* t = "Cafe\xCC\x81 \xF0\x9F\x91\xA9\xE2\x80\x8D\xF0\x9F\x92\xBB!";
+
+	EXPECT_EQ(6, utf8graphemeseek(t, strlen(t), t, 4, SEEK_SET) - t);
+	EXPECT_EQ(7, utf8graphemeseek(t, strlen(t), t, 5, SEEK_SET) - t);
+	EXPECT_EQ(18, utf8graphemeseek(t, strlen(t), t, 6, SEEK_SET) - t);
+}
+
+TEST(Utf8GraphemeSeek, InvalidDirection)
+{
+	const char* t = "abc";
+
+	EXPECT_EQ(t, utf8graphemeseek(t, strlen(t), t, 1, 33));
+}
+
+TEST(Utf8GraphemeSeek, TextNull)
+{
+	EXPECT_EQ(nullptr, utf8graphemeseek(nullptr, 4, nullptr, 1, SEEK_SET));
+}
\ No newline at end of file
@@ -0,0 +1,220 @@
+#include "tests-base.hpp"
+
+#include "utf8rewind.h"
+
+#include "../helpers/helpers-strings.hpp"
+
+TEST(Utf8CaseHash, Equal)
+{
+	const char* l = "Hello World";
+	const char* r = "hELLO wORLD";
+	int32_t errors = UTF8_ERR_NONE;
+
+	EXPECT_EQ(utf8casehash(l, strlen(l), UTF8_LOCALE_DEFAULT, &errors), utf8casehash(r, strlen(r), UTF8_LOCALE_DEFAULT, &errors));
+	EXPECT_ERROREQ(UTF8_ERR_NONE, errors);
+}
+
+TEST(Utf8CaseHash, Different)
+{
+	const char* l = "Hello World";
+	const char* r = "Hello Word";
+	int32_t errors = UTF8_ERR_NONE;
+
+	EXPECT_NE(utf8casehash(l, strlen(l), UTF8_LOCALE_DEFAULT, &errors), utf8casehash(r, strlen(r), UTF8_LOCALE_DEFAULT, &errors));
+	EXPECT_ERROREQ(UTF8_ERR_NONE, errors);
+}
+
+TEST(Utf8CaseHash, Order)
+{
+	const char* l = "ab";
+	const char* r = "ba";
+	int32_t errors = UTF8_ERR_NONE;
+
+	EXPECT_NE(utf8casehash(l, strlen(l), UTF8_LOCALE_DEFAULT, &errors), utf8casehash(r, strlen(r), UTF8_LOCALE_DEFAULT, &errors));
+	EXPECT_ERROREQ(UTF8_ERR_NONE, errors);
+}
+
+TEST(Utf8CaseHash, LengthChanges)
+{
+	// LATIN SMALL LETTER SHARP S and LATIN CAPITAL LETTER SHARP S
+
+	const char* l = "Stra\xC3\x9F" "e";
+	const char* r = "STRASSE";
+	const char* x = "stra\xE1\xBA\x9E" "e";
+	int32_t errors = UTF8_ERR_NONE;
+
+	EXPECT_EQ(utf8casehash(l, strlen(l), UTF8_LOCALE_DEFAULT, &errors), utf8casehash(r, strlen(r), UTF8_LOCALE_DEFAULT, &errors));
+	EXPECT_EQ(utf8casehash(r, strlen(r), UTF8_LOCALE_DEFAULT, &errors), utf8casehash(x, strlen(x), UTF8_LOCALE_DEFAULT, &errors));
+	EXPECT_ERROREQ(UTF8_ERR_NONE, errors);
+}
+
+TEST(Utf8CaseHash, Greek)
+{
+	const char* l = "\xCE\x9F\xCE\x94\xCE\x9F\xCE\xA3";
+	const char* r = "\xCE\xBF\xCE\xB4\xCE\xBF\xCF\x82";
+	int32_t errors = UTF8_ERR_NONE;
+
+	EXPECT_EQ(utf8casehash(l, strlen(l), UTF8_LOCALE_DEFAULT, &errors), utf8casehash(r, strlen(r), UTF8_LOCALE_DEFAULT, &errors));
+	EXPECT_ERROREQ(UTF8_ERR_NONE, errors);
+}
+
+TEST(Utf8CaseHash, Turkish)
+{
+	const char* l = "DIYARBAKIR";
+	const char* r = "d\xC4\xB1yarbak\xC4\xB1r";
+	int32_t errors = UTF8_ERR_NONE;
+
+	EXPECT_NE(utf8casehash(l, strlen(l), UTF8_LOCALE_DEFAULT, &errors), utf8casehash(r, strlen(r), UTF8_LOCALE_DEFAULT, &errors));
+	EXPECT_EQ(utf8casehash(l, strlen(l), UTF8_LOCALE_TURKISH_AND_AZERI_LATIN, &errors), utf8casehash(r, strlen(r), UTF8_LOCALE_TURKISH_AND_AZERI_LATIN, &errors));
+	EXPECT_ERROREQ(UTF8_ERR_NONE, errors);
+}
+
+TEST(Utf8CaseHash, InvalidData)
+{
+	const char* l = "ab\xFF";
+	const char* r = "AB\xEF\xBF\xBD";
+	int32_t errors = UTF8_ERR_NONE;
+
+	EXPECT_EQ(utf8casehash(l, strlen(l), UTF8_LOCALE_DEFAULT, &errors), utf8casehash(r, strlen(r), UTF8_LOCALE_DEFAULT, &errors));
+	EXPECT_ERROREQ(UTF8_ERR_NONE, errors);
+}
+
+TEST(Utf8CaseHash, Empty)
+{
+	const char* i = "";
+	int32_t errors = UTF8_ERR_NONE;
+
+	EXPECT_NE(utf8casehash(i, 0, UTF8_LOCALE_DEFAULT, &errors), utf8casehash("a", 1, UTF8_LOCALE_DEFAULT, &errors));
+	EXPECT_ERROREQ(UTF8_ERR_NONE, errors);
+}
+
+TEST(Utf8CaseHash, InputNull)
+{
+	int32_t errors = UTF8_ERR_NONE;
+
+	EXPECT_EQ(0, utf8casehash(nullptr, 1, UTF8_LOCALE_DEFAULT, &errors));
+	EXPECT_ERROREQ(UTF8_ERR_INVALID_DATA, errors);
+}
+
+TEST(Utf8CaseHash, InvalidLocale)
+{
+	int32_t errors = UTF8_ERR_NONE;
+
+	EXPECT_EQ(0, utf8casehash("a", 1, UTF8_LOCALE_MAXIMUM, &errors));
+	EXPECT_ERROREQ(UTF8_ERR_INVALID_LOCALE, errors);
+}
+
+TEST(Utf8NormHash, ComposedAndDecomposed)
+{
+	const char* l = "Caf\xC3\xA9";
+	const char* r = "Cafe\xCC\x81";
+	int32_t errors = UTF8_ERR_NONE;
+
+	EXPECT_EQ(utf8normhash(l, strlen(l), 0, &errors), utf8normhash(r, strlen(r), 0, &errors));
+	EXPECT_ERROREQ(UTF8_ERR_NONE, errors);
+}
+
+TEST(Utf8NormHash, CanonicalOrder)
+{
+	const char* l = "a\xCC\x81\xCC\x96";
+	const char* r = "a\xCC\x96\xCC\x81";
+	int32_t errors = UTF8_ERR_NONE;
+
+	EXPECT_EQ(utf8normhash(l, strlen(l), 0, &errors), utf8normhash(r, strlen(r), 0, &errors));
+	EXPECT_ERROREQ(UTF8_ERR_NONE, errors);
+}
+
+TEST(Utf8NormHash, Hangul)
+{
+	// HANGUL SYLLABLE GAG
+
+	const char* l = "\xEA\xB0\x81";
+	const char* r = "\xE1\x84\x80\xE1\x85\xA1\xE1\x86\xA8";
+	int32_t errors = UTF8_ERR_NONE;
+
+	EXPECT_EQ(utf8normhash(l, strlen(l), 0, &errors), utf8normhash(r, strlen(r), 0, &errors));
+	EXPECT_ERROREQ(UTF8_ERR_NONE, errors);
+}
+
+TEST(Utf8NormHash, Different)
+{
+	const char* l = "Caf\xC3\xA9";
+	const char* r = "Caf\xC3\xA8";
+	int32_t errors = UTF8_ERR_NONE;
+
+	EXPECT_NE(utf8normhash(l, strlen(l), 0, &errors), utf8normhash(r, strlen(r), 0, &errors));
+	EXPECT_ERROREQ(UTF8_ERR_NONE, errors);
+}
+
+TEST(Utf8NormHash, StreamSafe)
+{
+	// COMBINING GRAPHEME JOINER is inserted after 30 code points
+
+	std::string l = "e\xCC\x81\xCC\x96";
+	std::string r = "e\xCC\x96\xCC\x81";
+
+	for (size_t k = 0; k < 32; ++k)
+	{
+		l += "\xCC\x81";
+		r += "\xCC\x81";
+	}
+
+	int32_t errors = UTF8_ERR_NONE;
+
+	EXPECT_EQ(0, utf8normcmp(l.c_str(), l.length(), r.c_str(), r.length(), 0, &errors));
+	EXPECT_EQ(utf8normhash(l.c_str(), l.length(), 0, &errors), utf8normhash(r.c_str(), r.length(), 0, &errors));
+	EXPECT_ERROREQ(UTF8_ERR_NONE, errors);
+}
+
+TEST(Utf8NormHash, Compatibility)
+{
+	// LATIN SMALL LIGATURE FI
+
+	const char* l = "\xEF\xAC\x81" "ne";
+	const char* r = "fine";
+	int32_t errors = UTF8_ERR_NONE;
+
+	EXPECT_NE(utf8normhash(l, strlen(l), 0, &errors), utf8normhash(r, strlen(r), 0, &errors));
+	EXPECT_EQ(utf8normhash(l, strlen(l), UTF8_NORMALIZE_COMPATIBILITY, &errors), utf8normhash(r, strlen(r), UTF8_NORMALIZE_COMPATIBILITY, &errors));
+	EXPECT_ERROREQ(UTF8_ERR_NONE, errors);
+}
+
+TEST(Utf8NormHash, CaseFold)
+{
+	const char* l = "\xEF\xAC\x81" "NE Stra\xC3\x9F" "e";
+	const char* r = "fine STRASSE";
+	int32_t errors = UTF8_ERR_NONE;
+
+	EXPECT_NE(utf8normhash(l, strlen(l), UTF8_NORMALIZE_COMPATIBILITY, &errors), utf8normhash(r, strlen(r), UTF8_NORMALIZE_COMPATIBILITY, &errors));
+	EXPECT_EQ(utf8normhash(l, strlen(l), UTF8_NORMALIZE_COMPATIBILITY | UTF8_NORMALIZE_CASEFOLD, &errors), utf8normhash(r, strlen(r), UTF8_NORMALIZE_COMPATIBILITY | UTF8_NORMALIZE_CASEFOLD, &errors));
+	EXPECT_ERROREQ(UTF8_ERR_NONE, errors);
+}
+
+TEST(Utf8NormHash, InvalidData)
+{
+	const char* l = "ab\xFF";
+	const char* r = "ab\xEF\xBF\xBD";
+	int32_t errors = UTF8_ERR_NONE;
+
+	EXPECT_EQ(utf8normhash(l, strlen(l), 0, &errors), utf8normhash(r, strlen(r), 0, &errors));
+	EXPECT_ERROREQ(UTF8_ERR_NONE, errors);
+}
+
+TEST(Utf8NormHash, InputNull)
+{
+	int32_t errors = UTF8_ERR_NONE;
+
+	EXPECT_EQ(0, utf8normhash(nullptr, 1, 0, &errors));
+	EXPECT_ERROREQ(UTF8_ERR_INVALID_DATA, errors);
+}
+
+TEST(Utf8NormHash, InvalidFlag)
+{
+	int32_t errors = UTF8_ERR_NONE;
+
+	EXPECT_EQ(0, utf8normhash("a", 1, UTF8_NORMALIZE_COMPOSE, &errors));
+	EXPECT_ERROREQ(UTF8_ERR_INVALID_FLAG, errors);
+
+	EXPECT_EQ(0, utf8normhash("a", 1, UTF8_NORMALIZE_CASEFOLD, &errors));
+	EXPECT_ERROREQ(UTF8_ERR_INVALID_FLAG, errors);
+}
\ No newline at end of file
@@ -0,0 +1,155 @@
+#include "tests-base.hpp"
+
+#include "utf8rewind.h"
+
+#include "../helpers/helpers-strings.hpp"
+
+TEST(Utf8InPlace, ToUpperBasicLatin)
+{
+	char t[] = "Hello, World!";
+	int32_t errors = UTF8_ERR_NONE;
+
+	EXPECT_EQ(13, utf8toupperinplace(t, strlen(t), &errors));
+	EXPECT_UTF8EQ("HELLO, WORLD!", t);
+	EXPECT_ERROREQ(UTF8_ERR_NONE, errors);
+}
+
+TEST(Utf8InPlace, ToUpperCyrillic)
+{
+	char t[] = "\xD0\xBF\xD1\x80\xD0\xB8\xD0\xB2\xD0\xB5\xD1\x82";
+	int32_t errors = UTF8_ERR_NONE;
+
+	EXPECT_EQ(12, utf8toupperinplace(t, strlen(t), &errors));
+	EXPECT_UTF8EQ("\xD0\x9F\xD0\xA0\xD0\x98\xD0\x92\xD0\x95\xD0\xA2", t);
+	EXPECT_ERROREQ(UTF8_ERR_NONE, errors);
+}
+
+TEST(Utf8InPlace, ToUpperLengthChanges)
+{
+	// LATIN SMALL LIGATURE FF
+
+	char t[] = "o\xEF\xAC\x80" "ice";
+	int32_t errors = UTF8_ERR_NONE;
+
+	EXPECT_EQ(6, utf8toupperinplace(t, strlen(t), &errors));
+	EXPECT_UTF8EQ("O\xEF\xAC\x80" "ice", t);
+	EXPECT_ERROREQ(UTF8_ERR_NOT_ENOUGH_SPACE, errors);
+}
+
+TEST(Utf8InPlace, ToUpperInvalidData)
+{
+	char t[] = "ab\xE4\xB8" "c";
+	int32_t errors = UTF8_ERR_NONE;
+
+	EXPECT_EQ(6, utf8toupperinplace(t, strlen(t), &errors));
+	EXPECT_UTF8EQ("AB\xE4\xB8" "c", t);
+	EXPECT_ERROREQ(UTF8_ERR_NOT_ENOUGH_SPACE, errors);
+}
+
+TEST(Utf8InPlace, ToUpperEmpty)
+{
+	char t[] = "";
+	int32_t errors = UTF8_ERR_NONE;
+
+	EXPECT_EQ(0, utf8toupperinplace(t, 0, &errors));
+	EXPECT_UTF8EQ("", t);
+	EXPECT_ERROREQ(UTF8_ERR_NONE, errors);
+}
+
+TEST(Utf8InPlace, ToUpperTextNull)
+{
+	int32_t errors = UTF8_ERR_NONE;
+
+	EXPECT_EQ(0, utf8toupperinplace(nullptr, 1, &errors));
+	EXPECT_ERROREQ(UTF8_ERR_INVALID_DATA, errors);
+}
+
+TEST(Utf8InPlace, ToLowerGreek)
+{
+	char t[] = "\xCE\x9F\xCE\x94\xCE\x9F\xCE\xA3 ABC";
+	int32_t errors = UTF8_ERR_NONE;
+
+	EXPECT_EQ(12, utf8tolowerinplace(t, strlen(t), &errors));
+	EXPECT_UTF8EQ("\xCE\xBF\xCE\xB4\xCE\xBF\xCF\x82 abc", t);
+	EXPECT_ERROREQ(UTF8_ERR_NONE, errors);
+}
+
+TEST(Utf8InPlace, ToLowerLengthChanges)
+{
+	// KELVIN SIGN
+
+	char t[] = "ABC\xE2\x84\xAA" "DEF";
+	int32_t errors = UTF8_ERR_NONE;
+
+	EXPECT_EQ(7, utf8tolowerinplace(t, strlen(t), &errors));
+	EXPECT_UTF8EQ("abc\xE2\x84\xAA" "DEF", t);
+	EXPECT_ERROREQ(UTF8_ERR_NOT_ENOUGH_SPACE, errors);
+}
+
+TEST(Utf8InPlace, ToLowerLengthChangesSameTotal)
+{
+	// KELVIN SIGN and LATIN CAPITAL LETTER I WITH DOT ABOVE
+
+	char t[] = "\xE2\x84\xAA\xC4\xB0";
+	int32_t errors = UTF8_ERR_NONE;
+
+	EXPECT_EQ(4, utf8tolowerinplace(t, strlen(t), &errors));
+	EXPECT_UTF8EQ("\xE2\x84\xAA\xC4\xB0", t);
+	EXPECT_ERROREQ(UTF8_ERR_NOT_ENOUGH_SPACE, errors);
+}
+
+TEST(Utf8InPlace, ToLowerLongText)
+{
+	std::string i;
+	std::string e;
+
+	for (size_t k = 0; k < 100; ++k)
+	{
+		i += "\xD0\x90" "BC";
+		e += "\xD0\xB0" "bc";
+	}
+
+	int32_t errors = UTF8_ERR_NONE;
+
+	EXPECT_EQ(400, utf8tolowerinplace(&i[0], i.length(), &errors));
+	EXPECT_UTF8EQ(e.c_str(), i.c_str());
+	EXPECT_ERROREQ(UTF8_ERR_NONE, errors);
+}
+
+TEST(Utf8InPlace, ToLowerTextNull)
+{
+	int32_t errors = UTF8_ERR_NONE;
+
+	EXPECT_EQ(0, utf8tolowerinplace(nullptr, 1, &errors));
+	EXPECT_ERROREQ(UTF8_ERR_INVALID_DATA, errors);
+}
+
+TEST(Utf8InPlace, CaseFold)
+{
+	char t[] = "Stra\xCF\x82 \xD0\x96\xC3\x89";
+	int32_t errors = UTF8_ERR_NONE;
+
+	EXPECT_EQ(11, utf8casefoldinplace(t, strlen(t), &errors));
+	EXPECT_UTF8EQ("stra\xCF\x83 \xD0\xB6\xC3\xA9", t);
+	EXPECT_ERROREQ(UTF8_ERR_NONE, errors);
+}
+
+TEST(Utf8InPlace, CaseFoldLengthChanges)
+{
+	// LATIN CAPITAL LETTER SHARP S
+
+	char t[] = "GRO\xE1\xBA\x9E";
+	int32_t errors = UTF8_ERR_NONE;
+
+	EXPECT_EQ(5, utf8casefoldinplace(t, strlen(t), &errors));
+	EXPECT_UTF8EQ("gro\xE1\xBA\x9E", t);
+	EXPECT_ERROREQ(UTF8_ERR_NOT_ENOUGH_SPACE, errors);
+}
+
+TEST(Utf8InPlace, CaseFoldTextNull)
+{
+	int32_t errors = UTF8_ERR_NONE;
+
+	EXPECT_EQ(0, utf8casefoldinplace(nullptr, 1, &errors));
+	EXPECT_ERROREQ(UTF8_ERR_INVALID_DATA, errors);
+}
\ No newline at end of file
@@ -0,0 +1,210 @@
+#include "tests-base.hpp"
+
+#include "utf8rewind.h"
+
+TEST(Utf8IsCased, InvalidFlag)
+{
+	const char* i = "lowercase";
+	size_t is = strlen(i);
+	size_t o = 7;
+
+	EXPECT_EQ(0, utf8iscased(i, is, 0x00000010, &o));
+	EXPECT_EQ(0, o);
+}
+
+TEST(Utf8IsCased, NoFlags)
+{
+	const char* i = "lowercase";
+	size_t is = strlen(i);
+	size_t o = 7;
+
+	EXPECT_EQ(0, utf8iscased(i, is, 0, &o));
+	EXPECT_EQ(0, o);
+}
+
+TEST(Utf8IsCased, InputNull)
+{
+	size_t o = 7;
+
+	EXPECT_EQ(1, utf8iscased(nullptr, 1, UTF8_CASE_LOWERCASE, &o));
+	EXPECT_EQ(0, o);
+}
+
+TEST(Utf8IsCased, InputEmpty)
+{
+	size_t o = 7;
+
+	EXPECT_EQ(1, utf8iscased("", 0, UTF8_CASE_LOWERCASE, &o));
+	EXPECT_EQ(0, o);
+}
+
+TEST(Utf8IsCased, OffsetNull)
+{
+	const char* i = "Mixed";
+	size_t is = strlen(i);
+
+	EXPECT_EQ(0, utf8iscased(i, is, UTF8_CASE_LOWERCASE, nullptr));
+	EXPECT_EQ(1, utf8iscased(i + 1, is - 1, UTF8_CASE_LOWERCASE, nullptr));
+}
+
+TEST(Utf8IsCased, UppercaseYes)
+{
+	const char* i = "HELLO, \xD0\x9C\xD0\x98\xD0\xA0 123";
+	size_t is = strlen(i);
+	size_t o = 0;
+
+	EXPECT_EQ(1, utf8iscased(i, is, UTF8_CASE_UPPERCASE, &o));
+	EXPECT_EQ(17, o);
+}
+
+TEST(Utf8IsCased, UppercaseNo)
+{
+	const char* i = "HELLO, \xD0\x9C\xD0\xB8\xD0\xA0";
+	size_t is = strlen(i);
+	size_t o = 0;
+
+	EXPECT_EQ(0, utf8iscased(i, is, UTF8_CASE_UPPERCASE, &o));
+	EXPECT_EQ(9, o);
+}
+
+TEST(Utf8IsCased, UppercaseSpecialCasing)
+{
+	// LATIN SMALL LETTER SHARP S
+
+	const char* i = "STRA\xC3\x9F" "E";
+	size_t is = strlen(i);
+	size_t o = 0;
+
+	EXPECT_EQ(0, utf8iscased(i, is, UTF8_CASE_UPPERCASE, &o));
+	EXPECT_EQ(4, o);
+}
+
+TEST(Utf8IsCased, LowercaseYes)
+{
+	const char* i = "stra\xC3\x9F" "e \xE4\xB8\xAD\xE6\x96\x87 \xCF\x83\xCF\x82";
+	size_t is = strlen(i);
+	size_t o = 0;
+
+	EXPECT_EQ(1, utf8iscased(i, is, UTF8_CASE_LOWERCASE, &o));
+	EXPECT_EQ(19, o);
+}
+
+TEST(Utf8IsCased, LowercaseNo)
+{
+	const char* i = "\xE4\xB8\xAD\xE6\x96\x87 \xF0\x90\x90\x80";
+	size_t is = strlen(i);
+	size_t o = 0;
+
+	EXPECT_EQ(0, utf8iscased(i, is, UTF8_CASE_LOWERCASE, &o));
+	EXPECT_EQ(7, o);
+}
+
+TEST(Utf8IsCased, LowercaseCapitalSigma)
+{
+	const char* i = "\xCE\xBF\xCE\xB4\xCE\xBF\xCE\xA3";
+	size_t is = strlen(i);
+	size_t o = 0;
+
+	EXPECT_EQ(0, utf8iscased(i, is, UTF8_CASE_LOWERCASE, &o));
+	EXPECT_EQ(6, o);
+}
+
+TEST(Utf8IsCased, TitlecaseYes)
+{
+	const char* i = "Hello World! 123 \xC7\x85ungla";
+	size_t is = strlen(i);
+	size_t o = 0;
+
+	EXPECT_EQ(1, utf8iscased(i, is, UTF8_CASE_TITLECASE, &o));
+	EXPECT_EQ(24, o);
+}
+
+TEST(Utf8IsCased, TitlecaseFirstLetter)
+{
+	const char* i = "Hello world";
+	size_t is = strlen(i);
+	size_t o = 0;
+
+	EXPECT_EQ(0, utf8iscased(i, is, UTF8_CASE_TITLECASE, &o));
+	EXPECT_EQ(6, o);
+}
+
+TEST(Utf8IsCased, TitlecaseOtherLetters)
+{
+	const char* i = "Hello WOrld";
+	size_t is = strlen(i);
+	size_t o = 0;
+
+	EXPECT_EQ(0, utf8iscased(i, is, UTF8_CASE_TITLECASE, &o));
+	EXPECT_EQ(7, o);
+}
+
+TEST(Utf8IsCased, TitlecaseDigraph)
+{
+	// LATIN CAPITAL LETTER DZ WITH CARON
+
+	const char* i = "\xC7\x84ungla";
+	size_t is = strlen(i);
+	size_t o = 0;
+
+	EXPECT_EQ(0, utf8iscased(i, is, UTF8_CASE_TITLECASE, &o));
+	EXPECT_EQ(0, o);
+}
+
+TEST(Utf8IsCased, CaseFoldedYes)
+{
+	const char* i = "stra\xCF\x83\xCF\x83" "e";
+	size_t is = strlen(i);
+	size_t o = 0;
+
+	EXPECT_EQ(1, utf8iscased(i, is, UTF8_CASE_CASEFOLDED, &o));
+	EXPECT_EQ(9, o);
+}
+
+TEST(Utf8IsCased, CaseFoldedNo)
+{
+	// LATIN SMALL LETTER SHARP S and GREEK SMALL LETTER FINAL SIGMA are folded
+
+	const char* i = "stra\xC3\x9F" "e";
+	size_t is = strlen(i);
+	size_t o = 0;
+
+	EXPECT_EQ(0, utf8iscased(i, is, UTF8_CASE_CASEFOLDED, &o));
+	EXPECT_EQ(4, o);
+
+	EXPECT_EQ(0, utf8iscased("\xCF\x82", 2, UTF8_CASE_CASEFOLDED, &o));
+	EXPECT_EQ(0, o);
+}
+
+TEST(Utf8IsCased, Combined)
+{
+	const char* i = "123 \xE4\xB8\xAD\xE6\x96\x87!";
+	size_t is = strlen(i);
+	size_t o = 0;
+
+	EXPECT_EQ(1, utf8iscased(i, is, UTF8_CASE_UPPERCASE | UTF8_CASE_LOWERCASE | UTF8_CASE_TITLECASE | UTF8_CASE_CASEFOLDED, &o));
+	EXPECT_EQ(11, o);
+
+	EXPECT_EQ(0, utf8iscased("a", 1, UTF8_CASE_LOWERCASE | UTF8_CASE_UPPERCASE, &o));
+	EXPECT_EQ(0, o);
+}
+
+TEST(Utf8IsCased, InvalidData)
+{
+	const char* i = "abc\xE4\xB8";
+	size_t is = strlen(i);
+	size_t o = 0;
+
+	EXPECT_EQ(0, utf8iscased(i, is, UTF8_CASE_LOWERCASE, &o));
+	EXPECT_EQ(3, o);
+}
+
+TEST(Utf8IsCased, ReplacementCharacter)
+{
+	const char* i = "abc\xEF\xBF\xBD";
+	size_t is = strlen(i);
+	size_t o = 0;
+
+	EXPECT_EQ(1, utf8iscased(i, is, UTF8_CASE_LOWERCASE, &o));
+	EXPECT_EQ(6, o);
+}
\ No newline at end of file
@@ -42,6 +42,40 @@ TEST(Utf8IsCategory, BasicLatinMultipleMismatchBeforeEnd)
 	EXPECT_GCEQ(4, i, is, UTF8_CATEGORY_SEPARATOR_SPACE);
 }
 
+TEST(Utf8IsCategory, BasicLatinCombinedFlags)
+{
+	const char* i = "a1_B-";
+	size_t is = strlen(i);
+
+	EXPECT_GCEQ(4, i, is, UTF8_CATEGORY_LETTER | UTF8_CATEGORY_NUMBER | UTF8_CATEGORY_PUNCTUATION_CONNECTOR);
+}
+
+TEST(Utf8IsCategory, BasicLatinCompatibility)
+{
+	const char* i = "Token42 = 1";
+	size_t is = strlen(i);
+
+	EXPECT_GCEQ(7, i, is, UTF8_CATEGORY_ISALNUM);
+}
+
+TEST(Utf8IsCategory, BasicLatinAndMultiByte)
+{
+	const char* i = "abc\xC3\xA9" "def\xD0\x96!";
+	size_t is = strlen(i);
+
+	EXPECT_GCEQ(10, i, is, UTF8_CATEGORY_LETTER);
+}
+
+TEST(Utf8IsCategory, BasicLatinAfterNonStarter)
+{
+	// COMBINING ACUTE ACCENT does not extend to the next code point
+
+	const char* i = "e\xCC\x81" "1";
+	size_t is = strlen(i);
+
+	EXPECT_GCEQ(3, i, is, UTF8_CATEGORY_LETTER);
+}
+
 TEST(Utf8IsCategory, MultiByteSingle)
 {
 	const char* i = "\xC7\x85";
@@ -0,0 +1,453 @@
+#include "tests-base.hpp"
+
+#include "utf8rewind.h"
+
+#include "../helpers/helpers-strings.hpp"
+
+#define EXPECT_POSITIONEQ(_offset, _codepoint, _utf16, _line, _column, _position) \
+	EXPECT_EQ(_offset, _position.offset); \
+	EXPECT_EQ(_codepoint, _position.codepoint); \
+	EXPECT_EQ(_utf16, _position.utf16); \
+	EXPECT_EQ(_line, _position.line); \
+	EXPECT_EQ(_column, _position.column);
+
+TEST(Utf8LineIndex, InitInvalidInterval)
+{
+	utf8position_t m[8];
+	utf8lineindex_t index;
+	int32_t errors = UTF8_ERR_NONE;
+
+	EXPECT_EQ(0, utf8lineindexinit(&index, 0, m, 8, &errors));
+	EXPECT_ERROREQ(UTF8_ERR_INVALID_DATA, errors);
+}
+
+TEST(Utf8LineIndex, InitMarksNull)
+{
+	utf8lineindex_t index;
+	int32_t errors = UTF8_ERR_NONE;
+
+	EXPECT_EQ(0, utf8lineindexinit(&index, 16, nullptr, 8, &errors));
+	EXPECT_ERROREQ(UTF8_ERR_INVALID_DATA, errors);
+}
+
+TEST(Utf8LineIndex, Build)
+{
+	const char* t = "one\ntwo\r\nthree\rfour";
+	utf8position_t m[8];
+	utf8lineindex_t index;
+	int32_t errors = UTF8_ERR_NONE;
+
+	EXPECT_EQ(1, utf8lineindexinit(&index, 16, m, 8, &errors));
+	EXPECT_EQ(4, utf8lineindexbuild(&index, t, strlen(t), &errors));
+	EXPECT_ERROREQ(UTF8_ERR_NONE, errors);
+	EXPECT_POSITIONEQ(19, 19, 19, 3, 4, index.end);
+}
+
+TEST(Utf8LineIndex, BuildEndsWithLineBreak)
+{
+	const char* t = "one\n";
+	utf8position_t m[8];
+	utf8lineindex_t index;
+	int32_t errors = UTF8_ERR_NONE;
+
+	EXPECT_EQ(1, utf8lineindexinit(&index, 16, m, 8, &errors));
+	EXPECT_EQ(2, utf8lineindexbuild(&index, t, strlen(t), &errors));
+	EXPECT_ERROREQ(UTF8_ERR_NONE, errors);
+	EXPECT_POSITIONEQ(4, 4, 4, 1, 0, index.end);
+}
+
+TEST(Utf8LineIndex, BuildEmpty)
+{
+	utf8position_t m[8];
+	utf8lineindex_t index;
+	int32_t errors = UTF8_ERR_NONE;
+
+	EXPECT_EQ(1, utf8lineindexinit(&index, 16, m, 8, &errors));
+	EXPECT_EQ(1, utf8lineindexbuild(&index, "", 0, &errors));
+	EXPECT_ERROREQ(UTF8_ERR_NONE, errors);
+	EXPECT_POSITIONEQ(0, 0, 0, 0, 0, index.end);
+}
+
+TEST(Utf8LineIndex, BuildNotEnoughSpace)
+{
+	const char* t = "a\nb\nc\nd";
+	utf8position_t m[2];
+	utf8lineindex_t index;
+	int32_t errors = UTF8_ERR_NONE;
+
+	EXPECT_EQ(1, utf8lineindexinit(&index, 8, m, 2, &errors));
+	EXPECT_EQ(4, utf8lineindexbuild(&index, t, strlen(t), &errors));
+	EXPECT_ERROREQ(UTF8_ERR_NOT_ENOUGH_SPACE, errors);
+	EXPECT_EQ(2, index.count);
+
+	utf8position_t p = { 0 };
+	p.line = 3;
+
+	EXPECT_EQ(1, utf8lineindexfind(&index, t, strlen(t), UTF8_POSITION_LINE, &p, &errors));
+	EXPECT_ERROREQ(UTF8_ERR_NONE, errors);
+	EXPECT_POSITIONEQ(6, 6, 6, 3, 0, p);
+}
+
+TEST(Utf8LineIndex, FindOffset)
+{
+	const char* t = "Hello\n\xF0\x9F\x98\x80 world\r\nfoo";
+	utf8position_t m[8];
+	utf8lineindex_t index;
+	int32_t errors = UTF8_ERR_NONE;
+
+	EXPECT_EQ(1, utf8lineindexinit(&index, 4, m, 8, &errors));
+	EXPECT_EQ(3, utf8lineindexbuild(&index, t, strlen(t), &errors));
+
+	utf8position_t p = { 0 };
+	p.offset = 11;
+
+	EXPECT_EQ(1, utf8lineindexfind(&index, t, strlen(t), UTF8_POSITION_OFFSET, &p, &errors));
+	EXPECT_ERROREQ(UTF8_ERR_NONE, errors);
+	EXPECT_POSITIONEQ(11, 8, 9, 1, 3, p);
+}
+
+TEST(Utf8LineIndex, FindOffsetInsideSequence)
+{
+	const char* t = "Hello\n\xF0\x9F\x98\x80 world\r\nfoo";
+	utf8position_t m[8];
+	utf8lineindex_t index;
+	int32_t errors = UTF8_ERR_NONE;
+
+	EXPECT_EQ(1, utf8lineindexinit(&index, 4, m, 8, &errors));
+	EXPECT_EQ(3, utf8lineindexbuild(&index, t, strlen(t), &errors));
+
+	utf8position_t p = { 0 };
+	p.offset = 8;
+
+	EXPECT_EQ(0, utf8lineindexfind(&index, t, strlen(t), UTF8_POSITION_OFFSET, &p, &errors));
+	EXPECT_ERROREQ(UTF8_ERR_NONE, errors);
+	EXPECT_POSITIONEQ(6, 6, 6, 1, 0, p);
+}
+
+TEST(Utf8LineIndex, FindCodepoint)
+{
+	const char* t = "Hello\n\xF0\x9F\x98\x80 world\r\nfoo";
+	utf8position_t m[8];
+	utf8lineindex_t index;
+	int32_t errors = UTF8_ERR_NONE;
+
+	EXPECT_EQ(1, utf8lineindexinit(&index, 4, m, 8, &errors));
+	EXPECT_EQ(3, utf8lineindexbuild(&index, t, strlen(t), &errors));
+
+	utf8position_t p = { 0 };
+	p.codepoint = 15;
+
+	EXPECT_EQ(1, utf8lineindexfind(&index, t, strlen(t), UTF8_POSITION_CODEPOINT, &p, &errors));
+	EXPECT_ERROREQ(UTF8_ERR_NONE, errors);
+	EXPECT_POSITIONEQ(18, 15, 16, 2, 0, p);
+}
+
+TEST(Utf8LineIndex, FindCodepointPastEnd)
+{
+	const char* t = "Hello\n\xF0\x9F\x98\x80 world\r\nfoo";
+	utf8position_t m[8];
+	utf8lineindex_t index;
+	int32_t errors = UTF8_ERR_NONE;
+
+	EXPECT_EQ(1, utf8lineindexinit(&index, 4, m, 8, &errors));
+	EXPECT_EQ(3, utf8lineindexbuild(&index, t, strlen(t), &errors));
+
+	utf8position_t p = { 0 };
+	p.codepoint = 100;
+
+	EXPECT_EQ(0, utf8lineindexfind(&index, t, strlen(t), UTF8_POSITION_CODEPOINT, &p, &errors));
+	EXPECT_ERROREQ(UTF8_ERR_NONE, errors);
+	EXPECT_POSITIONEQ(21, 18, 19, 2, 3, p);
+}
+
+TEST(Utf8LineIndex, FindUtf16)
+{
+	const char* t = "Hello\n\xF0\x9F\x98\x80 world\r\nfoo";
+	utf8position_t m[8];
+	utf8lineindex_t index;
+	int32_t errors = UTF8_ERR_NONE;
+
+	EXPECT_EQ(1, utf8lineindexinit(&index, 4, m, 8, &errors));
+	EXPECT_EQ(3, utf8lineindexbuild(&index, t, strlen(t), &errors));
+
+	utf8position_t p = { 0 };
+	p.utf16 = 8;
+
+	EXPECT_EQ(1, utf8lineindexfind(&index, t, strlen(t), UTF8_POSITION_UTF16, &p, &errors));
+	EXPECT_ERROREQ(UTF8_ERR_NONE, errors);
+	EXPECT_POSITIONEQ(10, 7, 8, 1, 2, p);
+}
+
+TEST(Utf8LineIndex, FindUtf16InsideSurrogatePair)
+{
+	const char* t = "Hello\n\xF0\x9F\x98\x80 world\r\nfoo";
+	utf8position_t m[8];
+	utf8lineindex_t index;
+	int32_t errors = UTF8_ERR_NONE;
+
+	EXPECT_EQ(1, utf8lineindexinit(&index, 4, m, 8, &errors));
+	EXPECT_EQ(3, utf8lineindexbuild(&index, t, strlen(t), &errors));
+
+	utf8position_t p = { 0 };
+	p.utf16 = 7;
+
+	EXPECT_EQ(0, utf8lineindexfind(&index, t, strlen(t), UTF8_POSITION_UTF16, &p, &errors));
+	EXPECT_ERROREQ(UTF8_ERR_NONE, errors);
+	EXPECT_POSITIONEQ(6, 6, 6, 1, 0, p);
+}
+
+TEST(Utf8LineIndex, FindLine)
+{
+	const char* t = "Hello\n\xF0\x9F\x98\x80 world\r\nfoo";
+	utf8position_t m[8];
+	utf8lineindex_t index;
+	int32_t errors = UTF8_ERR_NONE;
+
+	EXPECT_EQ(1, utf8lineindexinit(&index, 4, m, 8, &errors));
+	EXPECT_EQ(3, utf8lineindexbuild(&index, t, strlen(t), &errors));
+
+	utf8position_t p = { 0 };
+	p.line = 1;
+	p.column = 3;
+
+	EXPECT_EQ(1, utf8lineindexfind(&index, t, strlen(t), UTF8_POSITION_LINE, &p, &errors));
+	EXPECT_ERROREQ(UTF8_ERR_NONE, errors);
+	EXPECT_POSITIONEQ(11, 8, 9, 1, 3, p);
+}
+
+TEST(Utf8LineIndex, FindLineColumnPastEnd)
+{
+	const char* t = "Hello\n\xF0\x9F\x98\x80 world\r\nfoo";
+	utf8position_t m[8];
+	utf8lineindex_t index;
+	int32_t errors = UTF8_ERR_NONE;
+
+	EXPECT_EQ(1, utf8lineindexinit(&index, 4, m, 8, &errors));
+	EXPECT_EQ(3, utf8lineindexbuild(&index, t, strlen(t), &errors));
+
+	utf8position_t p = { 0 };
+	p.line = 1;
+	p.column = 20;
+
+	EXPECT_EQ(0, utf8lineindexfind(&index, t, strlen(t), UTF8_POSITION_LINE, &p, &errors));
+	EXPECT_ERROREQ(UTF8_ERR_NONE, errors);
+	EXPECT_POSITIONEQ(16, 13, 14, 1, 8, p);
+}
+
+TEST(Utf8LineIndex, FindLinePastEnd)
+{
+	const char* t = "Hello\n\xF0\x9F\x98\x80 world\r\nfoo";
+	utf8position_t m[8];
+	utf8lineindex_t index;
+	int32_t errors = UTF8_ERR_NONE;
+
+	EXPECT_EQ(1, utf8lineindexinit(&index, 4, m, 8, &errors));
+	EXPECT_EQ(3, utf8lineindexbuild(&index, t, strlen(t), &errors));
+
+	utf8position_t p = { 0 };
+	p.line = 5;
+
+	EXPECT_EQ(0, utf8lineindexfind(&index, t, strlen(t), UTF8_POSITION_LINE, &p, &errors));
+	EXPECT_ERROREQ(UTF8_ERR_NONE, errors);
+	EXPECT_POSITIONEQ(21, 18, 19, 2, 3, p);
+}
+
+TEST(Utf8LineIndex, FindInvalidData)
+{
+	const char* t = "\xE4\xB8" "a\xFF\n";
+	utf8position_t m[8];
+	utf8lineindex_t index;
+	int32_t errors = UTF8_ERR_NONE;
+
+	EXPECT_EQ(1, utf8lineindexinit(&index, 4, m, 8, &errors));
+	EXPECT_EQ(2, utf8lineindexbuild(&index, t, strlen(t), &errors));
+
+	utf8position_t p = { 0 };
+	p.codepoint = 2;
+
+	EXPECT_EQ(1, utf8lineindexfind(&index, t, strlen(t), UTF8_POSITION_CODEPOINT, &p, &errors));
+	EXPECT_ERROREQ(UTF8_ERR_NONE, errors);
+	EXPECT_POSITIONEQ(3, 2, 2, 0, 2, p);
+}
+
+TEST(Utf8LineIndex, FindLongText)
+{
+	std::string t;
+
+	for (size_t k = 0; k < 100; ++k)
+	{
+		t += "\xE4\xB8\xAD\xE4\xB8\xAD\xE4\xB8\xAD\xE4\xB8\xAD\xE4\xB8\xAD\xF0\x9F\x98\x80\xF0\x9F\x98\x80\n";
+	}
+
+	utf8position_t m[512];
+	utf8lineindex_t index;
+	int32_t errors = UTF8_ERR_NONE;
+
+	EXPECT_EQ(1, utf8lineindexinit(&index, 4, m, 512, &errors));
+	EXPECT_EQ(101, utf8lineindexbuild(&index, t.c_str(), t.length(), &errors));
+	EXPECT_ERROREQ(UTF8_ERR_NONE, errors);
+
+	for (size_t k = 0; k < 100; k += 7)
+	{
+		utf8position_t p = { 0 };
+		p.line = k;
+		p.column = 7;
+
+		EXPECT_EQ(1, utf8lineindexfind(&index, t.c_str(), t.length(), UTF8_POSITION_LINE, &p, &errors));
+		EXPECT_POSITIONEQ(k * 24 + 19, k * 8 + 6, k * 10 + 7, k, 7, p);
+
+		p.utf16 = k * 10 + 6;
+
+		EXPECT_EQ(0, utf8lineindexfind(&index, t.c_str(), t.length(), UTF8_POSITION_UTF16, &p, &errors));
+		EXPECT_POSITIONEQ(k * 24 + 15, k * 8 + 5, k * 10 + 5, k, 5, p);
+	}
+}
+
+TEST(Utf8LineIndex, FindInvalidUnit)
+{
+	const char* t = "abc";
+	utf8position_t m[8];
+	utf8lineindex_t index;
+	int32_t errors = UTF8_ERR_NONE;
+
+	EXPECT_EQ(1, utf8lineindexinit(&index, 4, m, 8, &errors));
+	EXPECT_EQ(1, utf8lineindexbuild(&index, t, strlen(t), &errors));
+
+	utf8position_t p = { 0 };
+
+	EXPECT_EQ(0, utf8lineindexfind(&index, t, strlen(t), 0x00000010, &p, &errors));
+	EXPECT_ERROREQ(UTF8_ERR_INVALID_FLAG, errors);
+}
+
+TEST(Utf8LineIndex, FindTextSizeMismatch)
+{
+	const char* t = "abc";
+	utf8position_t m[8];
+	utf8lineindex_t index;
+	int32_t errors = UTF8_ERR_NONE;
+
+	EXPECT_EQ(1, utf8lineindexinit(&index, 4, m, 8, &errors));
+	EXPECT_EQ(1, utf8lineindexbuild(&index, t, strlen(t), &errors));
+
+	utf8position_t p = { 0 };
+
+	EXPECT_EQ(0, utf8lineindexfind(&index, t, 2, UTF8_POSITION_OFFSET, &p, &errors));
+	EXPECT_ERROREQ(UTF8_ERR_INVALID_DATA, errors);
+}
+
+TEST(Utf8LineIndex, UpdateInsert)
+{
+	char t[16] = "ab\ncd";
+	utf8position_t m[8];
+	utf8lineindex_t index;
+	int32_t errors = UTF8_ERR_NONE;
+
+	EXPECT_EQ(1, utf8lineindexinit(&index, 4, m, 8, &errors));
+	EXPECT_EQ(2, utf8lineindexbuild(&index, t, strlen(t), &errors));
+
+	strcpy(t, "ax\nyb\ncd");
+
+	EXPECT_EQ(3, utf8lineindexupdate(&index, t, strlen(t), 1, 0, 3, &errors));
+	EXPECT_ERROREQ(UTF8_ERR_NONE, errors);
+	EXPECT_POSITIONEQ(8, 8, 8, 2, 2, index.end);
+
+	utf8position_t p = { 0 };
+	p.line = 2;
+	p.column = 1;
+
+	EXPECT_EQ(1, utf8lineindexfind(&index, t, strlen(t), UTF8_POSITION_LINE, &p, &errors));
+	EXPECT_POSITIONEQ(7, 7, 7, 2, 1, p);
+}
+
+TEST(Utf8LineIndex, UpdateRemove)
+{
+	char t[16] = "ax\nyb\ncd";
+	utf8position_t m[8];
+	utf8lineindex_t index;
+	int32_t errors = UTF8_ERR_NONE;
+
+	EXPECT_EQ(1, utf8lineindexinit(&index, 4, m, 8, &errors));
+	EXPECT_EQ(3, utf8lineindexbuild(&index, t, strlen(t), &errors));
+
+	strcpy(t, "ab\ncd");
+
+	EXPECT_EQ(2, utf8lineindexupdate(&index, t, strlen(t), 1, 3, 0, &errors));
+	EXPECT_ERROREQ(UTF8_ERR_NONE, errors);
+	EXPECT_POSITIONEQ(5, 5, 5, 1, 2, index.end);
+
+	utf8position_t p = { 0 };
+	p.line = 1;
+
+	EXPECT_EQ(1, utf8lineindexfind(&index, t, strlen(t), UTF8_POSITION_LINE, &p, &errors));
+	EXPECT_POSITIONEQ(3, 3, 3, 1, 0, p);
+}
+
+TEST(Utf8LineIndex, UpdateJoinCarriageReturn)
+{
+	char t[16] = "a\rb";
+	utf8position_t m[8];
+	utf8lineindex_t index;
+	int32_t errors = UTF8_ERR_NONE;
+
+	EXPECT_EQ(1, utf8lineindexinit(&index, 4, m, 8, &errors));
+	EXPECT_EQ(2, utf8lineindexbuild(&index, t, strlen(t), &errors));
+
+	strcpy(t, "a\r\nb");
+
+	EXPECT_EQ(2, utf8lineindexupdate(&index, t, strlen(t), 2, 0, 1, &errors));
+	EXPECT_ERROREQ(UTF8_ERR_NONE, errors);
+
+	utf8position_t p = { 0 };
+	p.line = 0;
+	p.column = 5;
+
+	EXPECT_EQ(0, utf8lineindexfind(&index, t, strlen(t), UTF8_POSITION_LINE, &p, &errors));
+	EXPECT_POSITIONEQ(1, 1, 1, 0, 1, p);
+
+	p.line = 1;
+	p.column = 0;
+
+	EXPECT_EQ(1, utf8lineindexfind(&index, t, strlen(t), UTF8_POSITION_LINE, &p, &errors));
+	EXPECT_POSITIONEQ(3, 3, 3, 1, 0, p);
+}
+
+TEST(Utf8LineIndex, UpdateSurrogatePair)
+{
+	char t[32] = "ab\ncd\nef";
+	utf8position_t m[8];
+	utf8lineindex_t index;
+	int32_t errors = UTF8_ERR_NONE;
+
+	EXPECT_EQ(1, utf8lineindexinit(&index, 4, m, 8, &errors));
+	EXPECT_EQ(3, utf8lineindexbuild(&index, t, strlen(t), &errors));
+
+	strcpy(t, "ab\nc\xF0\x9F\x98\x80\nef");
+
+	EXPECT_EQ(3, utf8lineindexupdate(&index, t, strlen(t), 4, 1, 4, &errors));
+	EXPECT_ERROREQ(UTF8_ERR_NONE, errors);
+	EXPECT_POSITIONEQ(11, 8, 9, 2, 2, index.end);
+
+	utf8position_t p = { 0 };
+	p.line = 2;
+	p.column = 1;
+
+	EXPECT_EQ(1, utf8lineindexfind(&index, t, strlen(t), UTF8_POSITION_LINE, &p, &errors));
+	EXPECT_POSITIONEQ(10, 7, 8, 2, 1, p);
+}
+
+TEST(Utf8LineIndex, UpdateInvalidEdit)
+{
+	const char* t = "abc";
+	utf8position_t m[8];
+	utf8lineindex_t index;
+	int32_t errors = UTF8_ERR_NONE;
+
+	EXPECT_EQ(1, utf8lineindexinit(&index, 4, m, 8, &errors));
+	EXPECT_EQ(1, utf8lineindexbuild(&index, t, strlen(t), &errors));
+
+	EXPECT_EQ(1, utf8lineindexupdate(&index, t, 3, 2, 2, 2, &errors));
+	EXPECT_ERROREQ(UTF8_ERR_INVALID_DATA, errors);
+
+	EXPECT_EQ(1, utf8lineindexupdate(&index, t, 3, 1, 1, 2, &errors));
+	EXPECT_ERROREQ(UTF8_ERR_INVALID_DATA, errors);
+}
\ No newline at end of file
@@ -0,0 +1,161 @@
+#include "tests-base.hpp"
+
+#include "utf8rewind.h"
+
+#include "../helpers/helpers-locale.hpp"
+#include "../helpers/helpers-strings.hpp"
+
+TEST(Utf8Locale, GetLocaleDefault)
+{
+	RESET_LOCALE();
+
+	EXPECT_EQ(UTF8_LOCALE_DEFAULT, utf8getlocale());
+}
+
+TEST(Utf8Locale, GetLocaleTurkish)
+{
+	SET_LOCALE_TURKISH();
+
+	EXPECT_EQ(UTF8_LOCALE_TURKISH_AND_AZERI_LATIN, utf8getlocale());
+
+	RESET_LOCALE();
+}
+
+TEST(Utf8Locale, ToUpperDefault)
+{
+	const char* c = "istanbul";
+	const size_t s = 255;
+	char b[256] = { 0 };
+	int32_t errors = UTF8_ERR_NONE;
+
+	EXPECT_EQ(8, utf8toupper_l(c, strlen(c), b, s, UTF8_LOCALE_DEFAULT, &errors));
+	EXPECT_UTF8EQ("ISTANBUL", b);
+	EXPECT_ERROREQ(UTF8_ERR_NONE, errors);
+}
+
+TEST(Utf8Locale, ToUpperTurkish)
+{
+	const char* c = "istanbul";
+	const size_t s = 255;
+	char b[256] = { 0 };
+	int32_t errors = UTF8_ERR_NONE;
+
+	EXPECT_EQ(9, utf8toupper_l(c, strlen(c), b, s, UTF8_LOCALE_TURKISH_AND_AZERI_LATIN, &errors));
+	EXPECT_UTF8EQ("\xC4\xB0STANBUL", b);
+	EXPECT_ERROREQ(UTF8_ERR_NONE, errors);
+}
+
+TEST(Utf8Locale, ToUpperIgnoresSystemLocale)
+{
+	const char* c = "istanbul";
+	const size_t s = 255;
+	char b[256] = { 0 };
+	int32_t errors = UTF8_ERR_NONE;
+
+	SET_LOCALE_TURKISH();
+
+	EXPECT_EQ(8, utf8toupper_l(c, strlen(c), b, s, UTF8_LOCALE_DEFAULT, &errors));
+	EXPECT_UTF8EQ("ISTANBUL", b);
+	EXPECT_ERROREQ(UTF8_ERR_NONE, errors);
+
+	RESET_LOCALE();
+}
+
+TEST(Utf8Locale, ToUpperInvalidLocale)
+{
+	const char* c = "istanbul";
+	const size_t s = 255;
+	char b[256] = { 0 };
+	int32_t errors = UTF8_ERR_NONE;
+
+	EXPECT_EQ(0, utf8toupper_l(c, strlen(c), b, s, UTF8_LOCALE_MAXIMUM, &errors));
+	EXPECT_UTF8EQ("", b);
+	EXPECT_ERROREQ(UTF8_ERR_INVALID_LOCALE, errors);
+}
+
+TEST(Utf8Locale, ToLowerTurkish)
+{
+	const char* c = "ISPARTA";
+	const size_t s = 255;
+	char b[256] = { 0 };
+	int32_t errors = UTF8_ERR_NONE;
+
+	EXPECT_EQ(8, utf8tolower_l(c, strlen(c), b, s, UTF8_LOCALE_TURKISH_AND_AZERI_LATIN, &errors));
+	EXPECT_UTF8EQ("\xC4\xB1sparta", b);
+	EXPECT_ERROREQ(UTF8_ERR_NONE, errors);
+}
+
+TEST(Utf8Locale, ToLowerLithuanian)
+{
+	const char* c = "\xC3\x8C";
+	const size_t s = 255;
+	char b[256] = { 0 };
+	int32_t errors = UTF8_ERR_NONE;
+
+	EXPECT_EQ(5, utf8tolower_l(c, strlen(c), b, s, UTF8_LOCALE_LITHUANIAN, &errors));
+	EXPECT_UTF8EQ("i\xCC\x87\xCC\x80", b);
+	EXPECT_ERROREQ(UTF8_ERR_NONE, errors);
+}
+
+TEST(Utf8Locale, ToLowerInvalidLocale)
+{
+	const char* c = "ISPARTA";
+	int32_t errors = UTF8_ERR_NONE;
+
+	EXPECT_EQ(0, utf8tolower_l(c, strlen(c), nullptr, 0, 7, &errors));
+	EXPECT_ERROREQ(UTF8_ERR_INVALID_LOCALE, errors);
+}
+
+TEST(Utf8Locale, ToTitleTurkish)
+{
+	const char* c = "izmir ISPARTA";
+	const size_t s = 255;
+	char b[256] = { 0 };
+	int32_t errors = UTF8_ERR_NONE;
+
+	EXPECT_EQ(14, utf8totitle_l(c, strlen(c), b, s, UTF8_LOCALE_TURKISH_AND_AZERI_LATIN, &errors));
+	EXPECT_UTF8EQ("\xC4\xB0zmir Isparta", b);
+	EXPECT_ERROREQ(UTF8_ERR_NONE, errors);
+}
+
+TEST(Utf8Locale, ToTitleInvalidLocale)
+{
+	const char* c = "izmir";
+	int32_t errors = UTF8_ERR_NONE;
+
+	EXPECT_EQ(0, utf8totitle_l(c, strlen(c), nullptr, 0, UTF8_LOCALE_MAXIMUM, &errors));
+	EXPECT_ERROREQ(UTF8_ERR_INVALID_LOCALE, errors);
+}
+
+TEST(Utf8Locale, CaseFoldDefault)
+{
+	const char* c = "DIYARBAKIR";
+	const size_t s = 255;
+	char b[256] = { 0 };
+	int32_t errors = UTF8_ERR_NONE;
+
+	EXPECT_EQ(10, utf8casefold_l(c, strlen(c), b, s, UTF8_LOCALE_DEFAULT, &errors));
+	EXPECT_UTF8EQ("diyarbakir", b);
+	EXPECT_ERROREQ(UTF8_ERR_NONE, errors);
+}
+
+TEST(Utf8Locale, CaseFoldTurkish)
+{
+	const char* c = "DIYARBAKIR";
+	const size_t s = 255;
+	char b[256] = { 0 };
+	int32_t errors = UTF8_ERR_NONE;
+
+	EXPECT_EQ(12, utf8casefold_l(c, strlen(c), b, s, UTF8_LOCALE_TURKISH_AND_AZERI_LATIN, &errors));
+	EXPECT_UTF8EQ("d\xC4\xB1yarbak\xC4\xB1r", b);
+	EXPECT_ERROREQ(UTF8_ERR_NONE, errors);
+}
+
+TEST(Utf8Locale, CaseFoldInvalidLocale)
+{
+	const char* c = "DIYARBAKIR";
+	int32_t errors = UTF8_ERR_NONE;
+
+	EXPECT_EQ(0, utf8casefold_l(c, strlen(c), nullptr, 0, UTF8_LOCALE_MAXIMUM, &errors));
+	EXPECT_ERROREQ(UTF8_ERR_INVALID_LOCALE, errors);
+}
\ No newline at end of file
@@ -0,0 +1,372 @@
+#include "tests-base.hpp"
+
+#include "../helpers/helpers-strings.hpp"
+
+TEST(Utf8NormalizeCasefold, InvalidFlag)
+{
+	const char* i = "Flag";
+	size_t is = strlen(i);
+	char o[256] = { 0 };
+	size_t os = 255;
+	int32_t errors = UTF8_ERR_NONE;
+
+	EXPECT_EQ(0, utf8normalize(i, is, o, os, UTF8_NORMALIZE_COMPOSE | UTF8_NORMALIZE_CASEFOLD, &errors));
+	EXPECT_UTF8EQ("", o);
+	EXPECT_ERROREQ(UTF8_ERR_INVALID_FLAG, errors);
+}
+
+TEST(Utf8NormalizeCasefold, BasicLatin)
+{
+	/*
+		U+0048 U+0065 U+004C U+004C U+006F
+		     N      Y      N      N      Y
+		     0      0      0      0      0
+	*/
+
+	const char* i = "HeLLo";
+	size_t is = strlen(i);
+	char o[256] = { 0 };
+	size_t os = 255;
+	int32_t errors = UTF8_ERR_NONE;
+
+	EXPECT_EQ(5, utf8normalize(i, is, o, os, UTF8_NORMALIZE_COMPOSE | UTF8_NORMALIZE_COMPATIBILITY | UTF8_NORMALIZE_CASEFOLD, &errors));
+	EXPECT_UTF8EQ("hello", o);
+	EXPECT_ERROREQ(UTF8_ERR_NONE, errors);
+}
+
+TEST(Utf8NormalizeCasefold, Ligature)
+{
+	/*
+		U+FB01 U+FF21
+		     N      N
+		     0      0
+	*/
+
+	const char* i = "\xEF\xAC\x81\xEF\xBC\xA1";
+	size_t is = strlen(i);
+	char o[256] = { 0 };
+	size_t os = 255;
+	int32_t errors = UTF8_ERR_NONE;
+
+	EXPECT_EQ(3, utf8normalize(i, is, o, os, UTF8_NORMALIZE_COMPOSE | UTF8_NORMALIZE_COMPATIBILITY | UTF8_NORMALIZE_CASEFOLD, &errors));
+	EXPECT_UTF8EQ("fia", o);
+	EXPECT_ERROREQ(UTF8_ERR_NONE, errors);
+}
+
+TEST(Utf8NormalizeCasefold, SharpS)
+{
+	/*
+		U+0053 U+0074 U+0072 U+0061 U+00DF U+0065
+		     N      Y      Y      Y      N      Y
+		     0      0      0      0      0      0
+	*/
+
+	const char* i = "Stra\xC3\x9F" "e";
+	size_t is = strlen(i);
+	char o[256] = { 0 };
+	size_t os = 255;
+	int32_t errors = UTF8_ERR_NONE;
+
+	EXPECT_EQ(7, utf8normalize(i, is, o, os, UTF8_NORMALIZE_COMPOSE | UTF8_NORMALIZE_COMPATIBILITY | UTF8_NORMALIZE_CASEFOLD, &errors));
+	EXPECT_UTF8EQ("strasse", o);
+	EXPECT_ERROREQ(UTF8_ERR_NONE, errors);
+}
+
+TEST(Utf8NormalizeCasefold, Angstrom)
+{
+	/*
+		U+212B
+		     N
+		     0
+	*/
+
+	const char* i = "\xE2\x84\xAB";
+	size_t is = strlen(i);
+	char o[256] = { 0 };
+	size_t os = 255;
+	int32_t errors = UTF8_ERR_NONE;
+
+	EXPECT_EQ(2, utf8normalize(i, is, o, os, UTF8_NORMALIZE_COMPOSE | UTF8_NORMALIZE_COMPATIBILITY | UTF8_NORMALIZE_CASEFOLD, &errors));
+	EXPECT_UTF8EQ("\xC3\xA5", o);
+	EXPECT_ERROREQ(UTF8_ERR_NONE, errors);
+}
+
+TEST(Utf8NormalizeCasefold, AngstromDecompose)
+{
+	/*
+		U+00C5
+		     N
+		     0
+	*/
+
+	const char* i = "\xC3\x85";
+	size_t is = strlen(i);
+	char o[256] = { 0 };
+	size_t os = 255;
+	int32_t errors = UTF8_ERR_NONE;
+
+	EXPECT_EQ(3, utf8normalize(i, is, o, os, UTF8_NORMALIZE_DECOMPOSE | UTF8_NORMALIZE_COMPATIBILITY | UTF8_NORMALIZE_CASEFOLD, &errors));
+	EXPECT_UTF8EQ("a\xCC\x8A", o);
+	EXPECT_ERROREQ(UTF8_ERR_NONE, errors);
+}
+
+TEST(Utf8NormalizeCasefold, CapitalIWithDotAbove)
+{
+	/*
+		U+0130
+		     N
+		     0
+	*/
+
+	const char* i = "\xC4\xB0";
+	size_t is = strlen(i);
+	char o[256] = { 0 };
+	size_t os = 255;
+	int32_t errors = UTF8_ERR_NONE;
+
+	EXPECT_EQ(3, utf8normalize(i, is, o, os, UTF8_NORMALIZE_COMPOSE | UTF8_NORMALIZE_COMPATIBILITY | UTF8_NORMALIZE_CASEFOLD, &errors));
+	EXPECT_UTF8EQ("i\xCC\x87", o);
+	EXPECT_ERROREQ(UTF8_ERR_NONE, errors);
+}
+
+TEST(Utf8NormalizeCasefold, GreekYpogegrammeni)
+{
+	/*
+		U+1F88
+		     N
+		     0
+	*/
+
+	const char* i = "\xE1\xBE\x88";
+	size_t is = strlen(i);
+	char o[256] = { 0 };
+	size_t os = 255;
+	int32_t errors = UTF8_ERR_NONE;
+
+	EXPECT_EQ(5, utf8normalize(i, is, o, os, UTF8_NORMALIZE_COMPOSE | UTF8_NORMALIZE_COMPATIBILITY | UTF8_NORMALIZE_CASEFOLD, &errors));
+	EXPECT_UTF8EQ("\xE1\xBC\x80\xCE\xB9", o);
+	EXPECT_ERROREQ(UTF8_ERR_NONE, errors);
+}
+
+TEST(Utf8NormalizeCasefold, GreekYpogegrammeniDecompose)
+{
+	/*
+		U+1F88
+		     N
+		     0
+	*/
+
+	const char* i = "\xE1\xBE\x88";
+	size_t is = strlen(i);
+	char o[256] = { 0 };
+	size_t os = 255;
+	int32_t errors = UTF8_ERR_NONE;
+
+	EXPECT_EQ(6, utf8normalize(i, is, o, os, UTF8_NORMALIZE_DECOMPOSE | UTF8_NORMALIZE_COMPATIBILITY | UTF8_NORMALIZE_CASEFOLD, &errors));
+	EXPECT_UTF8EQ("\xCE\xB1\xCC\x93\xCE\xB9", o);
+	EXPECT_ERROREQ(UTF8_ERR_NONE, errors);
+}
+
+TEST(Utf8NormalizeCasefold, GreekYpogegrammeniBeforeMark)
+{
+	/*
+		U+0061 U+0345 U+0301
+		     Y      N      M
+		     0    240    230
+	*/
+
+	const char* i = "a\xCD\x85\xCC\x81";
+	size_t is = strlen(i);
+	char o[256] = { 0 };
+	size_t os = 255;
+	int32_t errors = UTF8_ERR_NONE;
+
+	EXPECT_EQ(4, utf8normalize(i, is, o, os, UTF8_NORMALIZE_COMPOSE | UTF8_NORMALIZE_COMPATIBILITY | UTF8_NORMALIZE_CASEFOLD, &errors));
+	EXPECT_UTF8EQ("\xC3\xA1\xCE\xB9", o);
+	EXPECT_ERROREQ(UTF8_ERR_NONE, errors);
+}
+
+TEST(Utf8NormalizeCasefold, GreekYpogegrammeniComposedBeforeMark)
+{
+	/*
+		U+1FB3 U+0301
+		     N      M
+		     0    230
+	*/
+
+	const char* i = "\xE1\xBE\xB3\xCC\x81";
+	size_t is = strlen(i);
+	char o[256] = { 0 };
+	size_t os = 255;
+	int32_t errors = UTF8_ERR_NONE;
+
+	EXPECT_EQ(4, utf8normalize(i, is, o, os, UTF8_NORMALIZE_COMPOSE | UTF8_NORMALIZE_COMPATIBILITY | UTF8_NORMALIZE_CASEFOLD, &errors));
+	EXPECT_UTF8EQ("\xCE\xAC\xCE\xB9", o);
+	EXPECT_ERROREQ(UTF8_ERR_NONE, errors);
+}
+
+TEST(Utf8NormalizeCasefold, GreekYpogegrammeniUnordered)
+{
+	/*
+		U+1FA6 U+0331 U+0303 U+0345 U+0312
+		     N      M      M      N      Y
+		     0    220    230    240    230
+	*/
+
+	const char* i = "\xE1\xBE\xA6\xCC\xB1\xCC\x83\xCD\x85\xCC\x92";
+	size_t is = strlen(i);
+	char o[256] = { 0 };
+	size_t os = 255;
+	int32_t errors = UTF8_ERR_NONE;
+
+	EXPECT_EQ(13, utf8normalize(i, is, o, os, UTF8_NORMALIZE_COMPOSE | UTF8_NORMALIZE_COMPATIBILITY | UTF8_NORMALIZE_CASEFOLD, &errors));
+	EXPECT_UTF8EQ("\xE1\xBD\xA6\xCC\xB1\xCC\x83\xCC\x92\xCE\xB9\xCE\xB9", o);
+	EXPECT_ERROREQ(UTF8_ERR_NONE, errors);
+}
+
+TEST(Utf8NormalizeCasefold, HangulCompatibility)
+{
+	/*
+		U+326E
+		     N
+		     0
+	*/
+
+	const char* i = "\xE3\x89\xAE";
+	size_t is = strlen(i);
+	char o[256] = { 0 };
+	size_t os = 255;
+	int32_t errors = UTF8_ERR_NONE;
+
+	EXPECT_EQ(3, utf8normalize(i, is, o, os, UTF8_NORMALIZE_COMPOSE | UTF8_NORMALIZE_COMPATIBILITY | UTF8_NORMALIZE_CASEFOLD, &errors));
+	EXPECT_UTF8EQ("\xEA\xB0\x80", o);
+	EXPECT_ERROREQ(UTF8_ERR_NONE, errors);
+}
+
+TEST(Utf8NormalizeCasefold, HangulCompatibilityDecompose)
+{
+	/*
+		U+326E
+		     N
+		     0
+	*/
+
+	const char* i = "\xE3\x89\xAE";
+	size_t is = strlen(i);
+	char o[256] = { 0 };
+	size_t os = 255;
+	int32_t errors = UTF8_ERR_NONE;
+
+	EXPECT_EQ(6, utf8normalize(i, is, o, os, UTF8_NORMALIZE_DECOMPOSE | UTF8_NORMALIZE_COMPATIBILITY | UTF8_NORMALIZE_CASEFOLD, &errors));
+	EXPECT_UTF8EQ("\xE1\x84\x80\xE1\x85\xA1", o);
+	EXPECT_ERROREQ(UTF8_ERR_NONE, errors);
+}
+
+TEST(Utf8NormalizeCasefold, IgnorableRemoved)
+{
+	/*
+		U+0073 U+006F U+00AD U+0066 U+0074
+		     Y      Y      N      Y      Y
+		     0      0      0      0      0
+	*/
+
+	const char* i = "so\xC2\xAD" "ft";
+	size_t is = strlen(i);
+	char o[256] = { 0 };
+	size_t os = 255;
+	int32_t errors = UTF8_ERR_NONE;
+
+	EXPECT_EQ(4, utf8normalize(i, is, o, os, UTF8_NORMALIZE_COMPOSE | UTF8_NORMALIZE_COMPATIBILITY | UTF8_NORMALIZE_CASEFOLD, &errors));
+	EXPECT_UTF8EQ("soft", o);
+	EXPECT_ERROREQ(UTF8_ERR_NONE, errors);
+}
+
+TEST(Utf8NormalizeCasefold, IgnorableOnly)
+{
+	/*
+		U+00AD
+		     N
+		     0
+	*/
+
+	const char* i = "\xC2\xAD";
+	size_t is = strlen(i);
+	char o[256] = { 0 };
+	size_t os = 255;
+	int32_t errors = UTF8_ERR_NONE;
+
+	EXPECT_EQ(0, utf8normalize(i, is, o, os, UTF8_NORMALIZE_COMPOSE | UTF8_NORMALIZE_COMPATIBILITY | UTF8_NORMALIZE_CASEFOLD, &errors));
+	EXPECT_UTF8EQ("", o);
+	EXPECT_ERROREQ(UTF8_ERR_NONE, errors);
+}
+
+TEST(Utf8NormalizeCasefold, IgnorableBetweenNonStarters)
+{
+	/*
+		U+0116 U+00AD U+0323
+		     N      N      M
+		     0      0    220
+	*/
+
+	const char* i = "\xC4\x96\xC2\xAD\xCC\xA3";
+	size_t is = strlen(i);
+	char o[256] = { 0 };
+	size_t os = 255;
+	int32_t errors = UTF8_ERR_NONE;
+
+	EXPECT_EQ(5, utf8normalize(i, is, o, os, UTF8_NORMALIZE_COMPOSE | UTF8_NORMALIZE_COMPATIBILITY | UTF8_NORMALIZE_CASEFOLD, &errors));
+	EXPECT_UTF8EQ("\xE1\xBA\xB9\xCC\x87", o);
+	EXPECT_ERROREQ(UTF8_ERR_NONE, errors);
+}
+
+TEST(Utf8NormalizeCasefold, AmountOfBytes)
+{
+	/*
+		U+0053 U+0074 U+0072 U+0061 U+00DF U+0065
+		     N      Y      Y      Y      N      Y
+		     0      0      0      0      0      0
+	*/
+
+	const char* i = "Stra\xC3\x9F" "e";
+	size_t is = strlen(i);
+	int32_t errors = UTF8_ERR_NONE;
+
+	EXPECT_EQ(7, utf8normalize(i, is, nullptr, 0, UTF8_NORMALIZE_COMPOSE | UTF8_NORMALIZE_COMPATIBILITY | UTF8_NORMALIZE_CASEFOLD, &errors));
+	EXPECT_ERROREQ(UTF8_ERR_NONE, errors);
+}
+
+TEST(Utf8NormalizeCasefold, NotEnoughSpace)
+{
+	/*
+		U+0053 U+0074 U+0072 U+0061 U+00DF U+0065
+		     N      Y      Y      Y      N      Y
+		     0      0      0      0      0      0
+	*/
+
+	const char* i = "Stra\xC3\x9F" "e";
+	size_t is = strlen(i);
+	char o[256] = { 0 };
+	size_t os = 5;
+	int32_t errors = UTF8_ERR_NONE;
+
+	EXPECT_EQ(5, utf8normalize(i, is, o, os, UTF8_NORMALIZE_COMPOSE | UTF8_NORMALIZE_COMPATIBILITY | UTF8_NORMALIZE_CASEFOLD, &errors));
+	EXPECT_UTF8EQ("stras", o);
+	EXPECT_ERROREQ(UTF8_ERR_NOT_ENOUGH_SPACE, errors);
+}
+
+TEST(Utf8NormalizeCasefold, IsNormalized)
+{
+	size_t o = 0;
+
+	EXPECT_EQ(UTF8_NORMALIZATION_RESULT_YES, utf8isnormalized("strasse", 7, UTF8_NORMALIZE_COMPOSE | UTF8_NORMALIZE_COMPATIBILITY | UTF8_NORMALIZE_CASEFOLD, &o));
+	EXPECT_EQ(7, o);
+
+	EXPECT_EQ(UTF8_NORMALIZATION_RESULT_NO, utf8isnormalized("Stra\xC3\x9F" "e", 7, UTF8_NORMALIZE_COMPOSE | UTF8_NORMALIZE_COMPATIBILITY | UTF8_NORMALIZE_CASEFOLD, &o));
+	EXPECT_EQ(0, o);
+
+	EXPECT_EQ(UTF8_NORMALIZATION_RESULT_YES, utf8isnormalized("\xC3\xA5", 2, UTF8_NORMALIZE_COMPOSE | UTF8_NORMALIZE_COMPATIBILITY | UTF8_NORMALIZE_CASEFOLD, &o));
+	EXPECT_EQ(2, o);
+
+	EXPECT_EQ(UTF8_NORMALIZATION_RESULT_NO, utf8isnormalized("\xC3\xA5", 2, UTF8_NORMALIZE_DECOMPOSE | UTF8_NORMALIZE_COMPATIBILITY | UTF8_NORMALIZE_CASEFOLD, &o));
+	EXPECT_EQ(0, o);
+}
\ No newline at end of file
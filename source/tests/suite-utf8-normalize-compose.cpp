@@ -632,4 +632,81 @@ TEST(Utf8NormalizeCompose, SequenceMultipleComposeNotEnoughSpace)
 	EXPECT_EQ(2, utf8normalize(i, is, o, os, UTF8_NORMALIZE_COMPOSE, &errors));
 	EXPECT_UTF8EQ("\xC8\xAB", o);
 	EXPECT_ERROREQ(UTF8_ERR_NOT_ENOUGH_SPACE, errors);
+}
+
+TEST(Utf8NormalizeCompose, LongSequenceOfStarters)
+{
+	std::string i;
+	std::string e;
+
+	for (size_t k = 0; k < 25; ++k)
+	{
+		i += "e\xCC\x81";
+		e += "\xC3\xA9";
+	}
+
+	char o[256] = { 0 };
+	size_t os = 255;
+	int32_t errors = UTF8_ERR_NONE;
+
+	EXPECT_EQ(50, utf8normalize(i.c_str(), i.length(), o, os, UTF8_NORMALIZE_COMPOSE, &errors));
+	EXPECT_UTF8EQ(e.c_str(), o);
+	EXPECT_ERROREQ(UTF8_ERR_NONE, errors);
+}
+
+TEST(Utf8NormalizeCompose, LongSequenceOfNonStarters)
+{
+	/*
+		U+0061 U+0301 (40 times)
+		     Y      M
+		     0    230
+	*/
+
+	std::string i = "a";
+
+	for (size_t k = 0; k < 40; ++k)
+	{
+		i += "\xCC\x81";
+	}
+
+	std::string e = "\xC3\xA1";
+
+	for (size_t k = 0; k < 28; ++k)
+	{
+		e += "\xCC\x81";
+	}
+
+	e += "\xCD\x8F";
+
+	for (size_t k = 0; k < 11; ++k)
+	{
+		e += "\xCC\x81";
+	}
+
+	char o[256] = { 0 };
+	size_t os = 255;
+	int32_t errors = UTF8_ERR_NONE;
+
+	EXPECT_EQ(82, utf8normalize(i.c_str(), i.length(), o, os, UTF8_NORMALIZE_COMPOSE, &errors));
+	EXPECT_UTF8EQ(e.c_str(), o);
+	EXPECT_ERROREQ(UTF8_ERR_NONE, errors);
+}
+
+TEST(Utf8NormalizeCompose, LongSequenceHangul)
+{
+	// Hangul jamo split between two writes must still be composed
+
+	std::string i(28, 'a');
+	i += "\xE1\x84\x80\xE1\x85\xA1";
+
+	std::string e(28, 'a');
+	e += "\xEA\xB0\x80";
+
+	char o[256] = { 0 };
+	size_t os = 255;
+	int32_t errors = UTF8_ERR_NONE;
+
+	EXPECT_EQ(31, utf8normalize(i.c_str(), i.length(), o, os, UTF8_NORMALIZE_COMPOSE, &errors));
+	EXPECT_UTF8EQ(e.c_str(), o);
+	EXPECT_ERROREQ(UTF8_ERR_NONE, errors);
 }
\ No newline at end of file
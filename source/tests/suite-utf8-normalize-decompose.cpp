@@ -393,6 +393,25 @@ TEST(Utf8NormalizeDecompose, MultiByteDecomposeSequenceNotEnoughSpace)
 	EXPECT_ERROREQ(UTF8_ERR_NOT_ENOUGH_SPACE, errors);
 }
 
+TEST(Utf8NormalizeDecompose, MultiByteDecomposeStarterToNonStarter)
+{
+	/*
+		U+0061 U+0323 U+0F73
+		     Y      Y      N
+		     0    220      0
+	*/
+
+	const char* i = "a\xCC\xA3\xE0\xBD\xB3";
+	size_t is = strlen(i);
+	char o[256] = { 0 };
+	size_t os = 255;
+	int32_t errors = UTF8_ERR_NONE;
+
+	EXPECT_EQ(9, utf8normalize(i, is, o, os, UTF8_NORMALIZE_DECOMPOSE, &errors));
+	EXPECT_UTF8EQ("a\xE0\xBD\xB1\xE0\xBD\xB2\xCC\xA3", o);
+	EXPECT_ERROREQ(UTF8_ERR_NONE, errors);
+}
+
 TEST(Utf8NormalizeDecompose, HangulUnaffectedSingle)
 {
 	/*
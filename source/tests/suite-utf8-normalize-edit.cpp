@@ -0,0 +1,439 @@
+#include "tests-base.hpp"
+
+#include "../helpers/helpers-strings.hpp"
+
+TEST(Utf8NormalizeEdit, InvalidFlag)
+{
+	const char* i = "Hands";
+	size_t is = strlen(i);
+	char o[256] = { 0 };
+	size_t os = 255;
+	size_t ro = 1;
+	size_t rs = 1;
+	int32_t errors = UTF8_ERR_NONE;
+
+	EXPECT_EQ(0, utf8normalizeedit(i, is, 1, 2, o, os, UTF8_NORMALIZE_COMPATIBILITY, &ro, &rs, &errors));
+	EXPECT_UTF8EQ("", o);
+	EXPECT_EQ(0, ro);
+	EXPECT_EQ(0, rs);
+	EXPECT_ERROREQ(UTF8_ERR_INVALID_FLAG, errors);
+}
+
+TEST(Utf8NormalizeEdit, InvalidData)
+{
+	char o[256] = { 0 };
+	size_t os = 255;
+	size_t ro = 1;
+	size_t rs = 1;
+	int32_t errors = UTF8_ERR_NONE;
+
+	EXPECT_EQ(0, utf8normalizeedit(nullptr, 12, 0, 3, o, os, UTF8_NORMALIZE_COMPOSE, &ro, &rs, &errors));
+	EXPECT_UTF8EQ("", o);
+	EXPECT_EQ(0, ro);
+	EXPECT_EQ(0, rs);
+	EXPECT_ERROREQ(UTF8_ERR_INVALID_DATA, errors);
+}
+
+TEST(Utf8NormalizeEdit, OffsetOutOfBounds)
+{
+	const char* i = "Bounds";
+	size_t is = strlen(i);
+	char o[256] = { 0 };
+	size_t os = 255;
+	size_t ro = 1;
+	size_t rs = 1;
+	int32_t errors = UTF8_ERR_NONE;
+
+	EXPECT_EQ(0, utf8normalizeedit(i, is, 7, 0, o, os, UTF8_NORMALIZE_DECOMPOSE, &ro, &rs, &errors));
+	EXPECT_UTF8EQ("", o);
+	EXPECT_EQ(0, ro);
+	EXPECT_EQ(0, rs);
+	EXPECT_ERROREQ(UTF8_ERR_INVALID_DATA, errors);
+}
+
+TEST(Utf8NormalizeEdit, SizeOutOfBounds)
+{
+	/*
+		U+0061 U+0301
+		     Y      M
+		     0    230
+	*/
+
+	const char* i = "a\xCC\x81";
+	size_t is = strlen(i);
+	char o[256] = { 0 };
+	size_t os = 255;
+	size_t ro = 0;
+	size_t rs = 0;
+	int32_t errors = UTF8_ERR_NONE;
+
+	EXPECT_EQ(2, utf8normalizeedit(i, is, 1, 1000, o, os, UTF8_NORMALIZE_COMPOSE, &ro, &rs, &errors));
+	EXPECT_UTF8EQ("\xC3\xA1", o);
+	EXPECT_EQ(0, ro);
+	EXPECT_EQ(3, rs);
+	EXPECT_ERROREQ(UTF8_ERR_NONE, errors);
+}
+
+TEST(Utf8NormalizeEdit, EmptyEditStable)
+{
+	const char* i = "Stable";
+	size_t is = strlen(i);
+	char o[256] = { 0 };
+	size_t os = 255;
+	size_t ro = 0;
+	size_t rs = 0;
+	int32_t errors = UTF8_ERR_NONE;
+
+	EXPECT_EQ(0, utf8normalizeedit(i, is, 3, 0, o, os, UTF8_NORMALIZE_COMPOSE, &ro, &rs, &errors));
+	EXPECT_UTF8EQ("", o);
+	EXPECT_EQ(3, ro);
+	EXPECT_EQ(0, rs);
+	EXPECT_ERROREQ(UTF8_ERR_NONE, errors);
+}
+
+TEST(Utf8NormalizeEdit, EmptyInput)
+{
+	const char* i = "";
+	char o[256] = { 0 };
+	size_t os = 255;
+	size_t ro = 1;
+	size_t rs = 1;
+	int32_t errors = UTF8_ERR_NONE;
+
+	EXPECT_EQ(0, utf8normalizeedit(i, 0, 0, 0, o, os, UTF8_NORMALIZE_DECOMPOSE, &ro, &rs, &errors));
+	EXPECT_UTF8EQ("", o);
+	EXPECT_EQ(0, ro);
+	EXPECT_EQ(0, rs);
+	EXPECT_ERROREQ(UTF8_ERR_NONE, errors);
+}
+
+TEST(Utf8NormalizeEdit, ComposeInsertNonStarter)
+{
+	/*
+		U+0043 U+0061 U+0066 U+0065 U+0301 U+0021
+		     Y      Y      Y      Y      M      Y
+		     0      0      0      0    230      0
+		                          ^^^^^^^^^^^^^
+	*/
+
+	const char* i = "Cafe\xCC\x81!";
+	size_t is = strlen(i);
+	char o[256] = { 0 };
+	size_t os = 255;
+	size_t ro = 0;
+	size_t rs = 0;
+	int32_t errors = UTF8_ERR_NONE;
+
+	EXPECT_EQ(2, utf8normalizeedit(i, is, 4, 2, o, os, UTF8_NORMALIZE_COMPOSE, &ro, &rs, &errors));
+	EXPECT_UTF8EQ("\xC3\xA9", o);
+	EXPECT_EQ(3, ro);
+	EXPECT_EQ(3, rs);
+	EXPECT_ERROREQ(UTF8_ERR_NONE, errors);
+}
+
+TEST(Utf8NormalizeEdit, ComposeInsertStarter)
+{
+	/*
+		U+0043 U+0061 U+00F1 U+0061
+		     Y      Y      Y      Y
+		     0      0      0      0
+		              ^^^^^^
+	*/
+
+	const char* i = "Ca\xC3\xB1" "a";
+	size_t is = strlen(i);
+	char o[256] = { 0 };
+	size_t os = 255;
+	size_t ro = 0;
+	size_t rs = 0;
+	int32_t errors = UTF8_ERR_NONE;
+
+	EXPECT_EQ(2, utf8normalizeedit(i, is, 2, 2, o, os, UTF8_NORMALIZE_COMPOSE, &ro, &rs, &errors));
+	EXPECT_UTF8EQ("\xC3\xB1", o);
+	EXPECT_EQ(2, ro);
+	EXPECT_EQ(2, rs);
+	EXPECT_ERROREQ(UTF8_ERR_NONE, errors);
+}
+
+TEST(Utf8NormalizeEdit, ComposeConcatenate)
+{
+	/*
+		U+0041 | U+030A U+0042
+		     Y |      M      Y
+		     0 |    230      0
+	*/
+
+	const char* i = "A\xCC\x8A" "B";
+	size_t is = strlen(i);
+	char o[256] = { 0 };
+	size_t os = 255;
+	size_t ro = 0;
+	size_t rs = 0;
+	int32_t errors = UTF8_ERR_NONE;
+
+	EXPECT_EQ(2, utf8normalizeedit(i, is, 1, 0, o, os, UTF8_NORMALIZE_COMPOSE, &ro, &rs, &errors));
+	EXPECT_UTF8EQ("\xC3\x85", o);
+	EXPECT_EQ(0, ro);
+	EXPECT_EQ(3, rs);
+	EXPECT_ERROREQ(UTF8_ERR_NONE, errors);
+}
+
+TEST(Utf8NormalizeEdit, DecomposeConcatenateStable)
+{
+	/*
+		U+0065 U+0301 | U+0062
+		     Y      Y |      Y
+		     0    230 |      0
+	*/
+
+	const char* i = "e\xCC\x81" "b";
+	size_t is = strlen(i);
+	char o[256] = { 0 };
+	size_t os = 255;
+	size_t ro = 0;
+	size_t rs = 0;
+	int32_t errors = UTF8_ERR_NONE;
+
+	EXPECT_EQ(0, utf8normalizeedit(i, is, 3, 0, o, os, UTF8_NORMALIZE_DECOMPOSE, &ro, &rs, &errors));
+	EXPECT_UTF8EQ("", o);
+	EXPECT_EQ(3, ro);
+	EXPECT_EQ(0, rs);
+	EXPECT_ERROREQ(UTF8_ERR_NONE, errors);
+}
+
+TEST(Utf8NormalizeEdit, ComposeConcatenateEnd)
+{
+	/*
+		U+0041 U+030A |
+		     Y      M |
+		     0    230 |
+	*/
+
+	const char* i = "A\xCC\x8A";
+	size_t is = strlen(i);
+	char o[256] = { 0 };
+	size_t os = 255;
+	size_t ro = 0;
+	size_t rs = 0;
+	int32_t errors = UTF8_ERR_NONE;
+
+	EXPECT_EQ(2, utf8normalizeedit(i, is, is, 0, o, os, UTF8_NORMALIZE_COMPOSE, &ro, &rs, &errors));
+	EXPECT_UTF8EQ("\xC3\x85", o);
+	EXPECT_EQ(0, ro);
+	EXPECT_EQ(3, rs);
+	EXPECT_ERROREQ(UTF8_ERR_NONE, errors);
+}
+
+TEST(Utf8NormalizeEdit, ComposeCompatibility)
+{
+	/*
+		U+0078 U+FB01 U+0079
+		     Y      N      Y
+		     0      0      0
+		       ^^^^^^
+	*/
+
+	const char* i = "x\xEF\xAC\x81y";
+	size_t is = strlen(i);
+	char o[256] = { 0 };
+	size_t os = 255;
+	size_t ro = 0;
+	size_t rs = 0;
+	int32_t errors = UTF8_ERR_NONE;
+
+	EXPECT_EQ(2, utf8normalizeedit(i, is, 1, 3, o, os, UTF8_NORMALIZE_COMPOSE | UTF8_NORMALIZE_COMPATIBILITY, &ro, &rs, &errors));
+	EXPECT_UTF8EQ("fi", o);
+	EXPECT_EQ(1, ro);
+	EXPECT_EQ(3, rs);
+	EXPECT_ERROREQ(UTF8_ERR_NONE, errors);
+}
+
+TEST(Utf8NormalizeEdit, DecomposeReorder)
+{
+	/*
+		U+0078 U+0061 U+0301 U+0323 U+0062
+		     Y      Y      Y      Y      Y
+		     0      0    230    220      0
+		                     ^^^^^^
+	*/
+
+	const char* i = "xa\xCC\x81\xCC\xA3" "b";
+	size_t is = strlen(i);
+	char o[256] = { 0 };
+	size_t os = 255;
+	size_t ro = 0;
+	size_t rs = 0;
+	int32_t errors = UTF8_ERR_NONE;
+
+	EXPECT_EQ(5, utf8normalizeedit(i, is, 4, 2, o, os, UTF8_NORMALIZE_DECOMPOSE, &ro, &rs, &errors));
+	EXPECT_UTF8EQ("a\xCC\xA3\xCC\x81", o);
+	EXPECT_EQ(1, ro);
+	EXPECT_EQ(5, rs);
+	EXPECT_ERROREQ(UTF8_ERR_NONE, errors);
+}
+
+TEST(Utf8NormalizeEdit, DecomposeStartNonStarters)
+{
+	/*
+		U+0301 U+0323 U+0065
+		     Y      Y      Y
+		   230    220      0
+		       ^^^^^^
+	*/
+
+	const char* i = "\xCC\x81\xCC\xA3" "e";
+	size_t is = strlen(i);
+	char o[256] = { 0 };
+	size_t os = 255;
+	size_t ro = 0;
+	size_t rs = 0;
+	int32_t errors = UTF8_ERR_NONE;
+
+	EXPECT_EQ(4, utf8normalizeedit(i, is, 2, 2, o, os, UTF8_NORMALIZE_DECOMPOSE, &ro, &rs, &errors));
+	EXPECT_UTF8EQ("\xCC\xA3\xCC\x81", o);
+	EXPECT_EQ(0, ro);
+	EXPECT_EQ(4, rs);
+	EXPECT_ERROREQ(UTF8_ERR_NONE, errors);
+}
+
+TEST(Utf8NormalizeEdit, DecomposeCompatibility)
+{
+	/*
+		U+0078 U+FB01 U+0079
+		     Y      N      Y
+		     0      0      0
+		       ^^^^^^
+	*/
+
+	const char* i = "x\xEF\xAC\x81y";
+	size_t is = strlen(i);
+	char o[256] = { 0 };
+	size_t os = 255;
+	size_t ro = 0;
+	size_t rs = 0;
+	int32_t errors = UTF8_ERR_NONE;
+
+	EXPECT_EQ(2, utf8normalizeedit(i, is, 1, 3, o, os, UTF8_NORMALIZE_DECOMPOSE | UTF8_NORMALIZE_COMPATIBILITY, &ro, &rs, &errors));
+	EXPECT_UTF8EQ("fi", o);
+	EXPECT_EQ(1, ro);
+	EXPECT_EQ(3, rs);
+	EXPECT_ERROREQ(UTF8_ERR_NONE, errors);
+}
+
+TEST(Utf8NormalizeEdit, DecomposeInsertComposed)
+{
+	/*
+		U+0061 U+00C5 U+0062
+		     Y      N      Y
+		     0      0      0
+		       ^^^^^^
+	*/
+
+	const char* i = "a\xC3\x85" "b";
+	size_t is = strlen(i);
+	char o[256] = { 0 };
+	size_t os = 255;
+	size_t ro = 0;
+	size_t rs = 0;
+	int32_t errors = UTF8_ERR_NONE;
+
+	EXPECT_EQ(3, utf8normalizeedit(i, is, 1, 2, o, os, UTF8_NORMALIZE_DECOMPOSE, &ro, &rs, &errors));
+	EXPECT_UTF8EQ("A\xCC\x8A", o);
+	EXPECT_EQ(1, ro);
+	EXPECT_EQ(2, rs);
+	EXPECT_ERROREQ(UTF8_ERR_NONE, errors);
+}
+
+TEST(Utf8NormalizeEdit, EditInsideSequence)
+{
+	/*
+		U+0041 U+0301 U+0300 U+0042
+		     Y      M      M      Y
+		     0    230    230      0
+		             ^^^^^^
+	*/
+
+	const char* i = "A\xCC\x81\xCC\x80" "B";
+	size_t is = strlen(i);
+	char o[256] = { 0 };
+	size_t os = 255;
+	size_t ro = 0;
+	size_t rs = 0;
+	int32_t errors = UTF8_ERR_NONE;
+
+	EXPECT_EQ(4, utf8normalizeedit(i, is, 2, 2, o, os, UTF8_NORMALIZE_COMPOSE, &ro, &rs, &errors));
+	EXPECT_UTF8EQ("\xC3\x81\xCC\x80", o);
+	EXPECT_EQ(0, ro);
+	EXPECT_EQ(5, rs);
+	EXPECT_ERROREQ(UTF8_ERR_NONE, errors);
+}
+
+TEST(Utf8NormalizeEdit, MissingReplaceParameters)
+{
+	const char* i = "e\xCC\x81";
+	size_t is = strlen(i);
+	char o[256] = { 0 };
+	size_t os = 255;
+	int32_t errors = UTF8_ERR_NONE;
+
+	EXPECT_EQ(2, utf8normalizeedit(i, is, 1, 2, o, os, UTF8_NORMALIZE_COMPOSE, nullptr, nullptr, &errors));
+	EXPECT_UTF8EQ("\xC3\xA9", o);
+	EXPECT_ERROREQ(UTF8_ERR_NONE, errors);
+}
+
+TEST(Utf8NormalizeEdit, AmountOfBytes)
+{
+	const char* i = "Doc\xE1\xBA\xA0\xCC\x86";
+	size_t is = strlen(i);
+	size_t ro = 0;
+	size_t rs = 0;
+	int32_t errors = UTF8_ERR_NONE;
+
+	EXPECT_EQ(3, utf8normalizeedit(i, is, 6, 2, nullptr, 0, UTF8_NORMALIZE_COMPOSE, &ro, &rs, &errors));
+	EXPECT_EQ(3, ro);
+	EXPECT_EQ(5, rs);
+	EXPECT_ERROREQ(UTF8_ERR_NONE, errors);
+}
+
+TEST(Utf8NormalizeEdit, NotEnoughSpace)
+{
+	const char* i = "Doc\xE1\xBA\xA0\xCC\x86";
+	size_t is = strlen(i);
+	char o[256] = { 0 };
+	size_t os = 2;
+	size_t ro = 0;
+	size_t rs = 0;
+	int32_t errors = UTF8_ERR_NONE;
+
+	EXPECT_EQ(0, utf8normalizeedit(i, is, 6, 2, o, os, UTF8_NORMALIZE_COMPOSE, &ro, &rs, &errors));
+	EXPECT_UTF8EQ("", o);
+	EXPECT_EQ(3, ro);
+	EXPECT_EQ(5, rs);
+	EXPECT_ERROREQ(UTF8_ERR_NOT_ENOUGH_SPACE, errors);
+}
+
+TEST(Utf8NormalizeEdit, DecomposeUnstableStarter)
+{
+	/*
+		U+0061 U+0F73 U+0062
+		     Y      N      Y
+		     0      0      0
+		       ^^^^^^
+
+		U+0F73 decomposes to U+0F71 U+0F72, which are non-starters.
+	*/
+
+	const char* i = "a\xE0\xBD\xB3" "b";
+	size_t is = strlen(i);
+	char o[256] = { 0 };
+	size_t os = 255;
+	size_t ro = 0;
+	size_t rs = 0;
+	int32_t errors = UTF8_ERR_NONE;
+
+	EXPECT_EQ(7, utf8normalizeedit(i, is, 1, 3, o, os, UTF8_NORMALIZE_DECOMPOSE, &ro, &rs, &errors));
+	EXPECT_UTF8EQ("a\xE0\xBD\xB1\xE0\xBD\xB2", o);
+	EXPECT_EQ(0, ro);
+	EXPECT_EQ(4, rs);
+	EXPECT_ERROREQ(UTF8_ERR_NONE, errors);
+}
\ No newline at end of file
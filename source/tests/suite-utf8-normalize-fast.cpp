@@ -0,0 +1,280 @@
+#include "tests-base.hpp"
+
+#include "../helpers/helpers-strings.hpp"
+
+TEST(Utf8NormalizeFast, InvalidFlag)
+{
+	const char* i = "Flag";
+	size_t is = strlen(i);
+	char o[256] = { 0 };
+	size_t os = 255;
+	int32_t errors = UTF8_ERR_NONE;
+
+	EXPECT_EQ(0, utf8normalize(i, is, o, os, UTF8_NORMALIZE_COMPOSE | UTF8_NORMALIZE_COMPATIBILITY | UTF8_NORMALIZE_FAST, &errors));
+	EXPECT_UTF8EQ("", o);
+	EXPECT_ERROREQ(UTF8_ERR_INVALID_FLAG, errors);
+}
+
+TEST(Utf8NormalizeFast, ComposeAdjacent)
+{
+	/*
+		U+0061 U+0301
+		     Y      M
+		     0    230
+	*/
+
+	const char* i = "a\xCC\x81";
+	size_t is = strlen(i);
+	char o[256] = { 0 };
+	size_t os = 255;
+	int32_t errors = UTF8_ERR_NONE;
+
+	EXPECT_EQ(2, utf8normalize(i, is, o, os, UTF8_NORMALIZE_COMPOSE | UTF8_NORMALIZE_FAST, &errors));
+	EXPECT_UTF8EQ("\xC3\xA1", o);
+	EXPECT_ERROREQ(UTF8_ERR_NONE, errors);
+}
+
+TEST(Utf8NormalizeFast, ComposeAfterComposition)
+{
+	/*
+		U+0061 U+0323 U+0302
+		     Y      M      M
+		     0    220    230
+	*/
+
+	const char* i = "a\xCC\xA3\xCC\x82";
+	size_t is = strlen(i);
+	char o[256] = { 0 };
+	size_t os = 255;
+	int32_t errors = UTF8_ERR_NONE;
+
+	EXPECT_EQ(3, utf8normalize(i, is, o, os, UTF8_NORMALIZE_COMPOSE | UTF8_NORMALIZE_FAST, &errors));
+	EXPECT_UTF8EQ("\xE1\xBA\xAD", o);
+	EXPECT_ERROREQ(UTF8_ERR_NONE, errors);
+}
+
+TEST(Utf8NormalizeFast, ComposeNotAdjacent)
+{
+	/*
+		U+0061 U+0316 U+0301
+		     Y      Y      M
+		     0    220    230
+	*/
+
+	const char* i = "a\xCC\x96\xCC\x81";
+	size_t is = strlen(i);
+	char o[256] = { 0 };
+	size_t os = 255;
+	int32_t errors = UTF8_ERR_NONE;
+
+	EXPECT_EQ(5, utf8normalize(i, is, o, os, UTF8_NORMALIZE_COMPOSE | UTF8_NORMALIZE_FAST, &errors));
+	EXPECT_UTF8EQ("a\xCC\x96\xCC\x81", o);
+	EXPECT_ERROREQ(UTF8_ERR_NONE, errors);
+}
+
+TEST(Utf8NormalizeFast, ComposeNotAdjacentPrecomposed)
+{
+	/*
+		U+00E1 U+0316
+		     Y      Y
+		     0    220
+	*/
+
+	const char* i = "\xC3\xA1\xCC\x96";
+	size_t is = strlen(i);
+	char o[256] = { 0 };
+	size_t os = 255;
+	int32_t errors = UTF8_ERR_NONE;
+
+	EXPECT_EQ(5, utf8normalize(i, is, o, os, UTF8_NORMALIZE_COMPOSE | UTF8_NORMALIZE_FAST, &errors));
+	EXPECT_UTF8EQ("a\xCC\x96\xCC\x81", o);
+	EXPECT_ERROREQ(UTF8_ERR_NONE, errors);
+}
+
+TEST(Utf8NormalizeFast, ComposeSingleton)
+{
+	/*
+		U+212B
+		     N
+		     0
+	*/
+
+	const char* i = "\xE2\x84\xAB";
+	size_t is = strlen(i);
+	char o[256] = { 0 };
+	size_t os = 255;
+	int32_t errors = UTF8_ERR_NONE;
+
+	EXPECT_EQ(2, utf8normalize(i, is, o, os, UTF8_NORMALIZE_COMPOSE | UTF8_NORMALIZE_FAST, &errors));
+	EXPECT_UTF8EQ("\xC3\x85", o);
+	EXPECT_ERROREQ(UTF8_ERR_NONE, errors);
+}
+
+TEST(Utf8NormalizeFast, ComposeHangul)
+{
+	/*
+		U+1100 U+1161 U+11A8
+		     Y      M      M
+		     0      0      0
+	*/
+
+	const char* i = "\xE1\x84\x80\xE1\x85\xA1\xE1\x86\xA8";
+	size_t is = strlen(i);
+	char o[256] = { 0 };
+	size_t os = 255;
+	int32_t errors = UTF8_ERR_NONE;
+
+	EXPECT_EQ(3, utf8normalize(i, is, o, os, UTF8_NORMALIZE_COMPOSE | UTF8_NORMALIZE_FAST, &errors));
+	EXPECT_UTF8EQ("\xEA\xB0\x81", o);
+	EXPECT_ERROREQ(UTF8_ERR_NONE, errors);
+}
+
+TEST(Utf8NormalizeFast, ComposeMultipleSequences)
+{
+	/*
+		U+0041 U+0316 U+030A U+0062 U+0065 U+0301
+		     Y      Y      M      Y      Y      M
+		     0    220    230      0      0    230
+	*/
+
+	const char* i = "A\xCC\x96\xCC\x8A" "be\xCC\x81";
+	size_t is = strlen(i);
+	char o[256] = { 0 };
+	size_t os = 255;
+	int32_t errors = UTF8_ERR_NONE;
+
+	EXPECT_EQ(8, utf8normalize(i, is, o, os, UTF8_NORMALIZE_COMPOSE | UTF8_NORMALIZE_FAST, &errors));
+	EXPECT_UTF8EQ("A\xCC\x96\xCC\x8A" "b\xC3\xA9", o);
+	EXPECT_ERROREQ(UTF8_ERR_NONE, errors);
+}
+
+TEST(Utf8NormalizeFast, Decompose)
+{
+	/*
+		U+00E1 U+0316
+		     N      Y
+		     0    220
+	*/
+
+	const char* i = "\xC3\xA1\xCC\x96";
+	size_t is = strlen(i);
+	char o[256] = { 0 };
+	size_t os = 255;
+	int32_t errors = UTF8_ERR_NONE;
+
+	EXPECT_EQ(5, utf8normalize(i, is, o, os, UTF8_NORMALIZE_DECOMPOSE | UTF8_NORMALIZE_FAST, &errors));
+	EXPECT_UTF8EQ("a\xCC\x96\xCC\x81", o);
+	EXPECT_ERROREQ(UTF8_ERR_NONE, errors);
+}
+
+TEST(Utf8NormalizeFast, IsNormalizedInvalidFlag)
+{
+	const char* i = "Flag";
+	size_t is = strlen(i);
+	size_t o = 0;
+
+	EXPECT_EQ(UTF8_NORMALIZATION_RESULT_YES, utf8isnormalized(i, is, UTF8_NORMALIZE_DECOMPOSE | UTF8_NORMALIZE_COMPATIBILITY | UTF8_NORMALIZE_FAST, &o));
+	EXPECT_EQ(0, o);
+}
+
+TEST(Utf8NormalizeFast, IsNormalizedDecomposeUnordered)
+{
+	/*
+		codepoint  U+0061 U+0301 U+0316
+		  leading       0    230    220
+		 trailing       0    230    220
+	*/
+
+	const char* i = "a\xCC\x81\xCC\x96";
+	size_t is = strlen(i);
+	size_t o = 0;
+
+	EXPECT_EQ(UTF8_NORMALIZATION_RESULT_NO, utf8isnormalized(i, is, UTF8_NORMALIZE_DECOMPOSE | UTF8_NORMALIZE_FAST, &o));
+	EXPECT_EQ(3, o);
+}
+
+TEST(Utf8NormalizeFast, IsNormalizedDecomposePrecomposed)
+{
+	/*
+		codepoint  U+00E1 U+212B U+AC01 U+0344
+		  leading       0      0      0    230
+		 trailing     230      0      0    230
+	*/
+
+	const char* i = "\xC3\xA1\xE2\x84\xAB\xEA\xB0\x81\xCD\x84";
+	size_t is = strlen(i);
+	size_t o = 0;
+
+	EXPECT_EQ(UTF8_NORMALIZATION_RESULT_YES, utf8isnormalized(i, is, UTF8_NORMALIZE_DECOMPOSE | UTF8_NORMALIZE_FAST, &o));
+	EXPECT_EQ(10, o);
+
+	EXPECT_EQ(UTF8_NORMALIZATION_RESULT_NO, utf8isnormalized(i, is, UTF8_NORMALIZE_DECOMPOSE, &o));
+	EXPECT_EQ(0, o);
+}
+
+TEST(Utf8NormalizeFast, IsNormalizedDecomposeTrailingClass)
+{
+	/*
+		codepoint  U+00E1 U+0316
+		  leading       0    220
+		 trailing     230    220
+	*/
+
+	const char* i = "\xC3\xA1\xCC\x96";
+	size_t is = strlen(i);
+	size_t o = 0;
+
+	EXPECT_EQ(UTF8_NORMALIZATION_RESULT_NO, utf8isnormalized(i, is, UTF8_NORMALIZE_DECOMPOSE | UTF8_NORMALIZE_FAST, &o));
+	EXPECT_EQ(2, o);
+
+	EXPECT_EQ(UTF8_NORMALIZATION_RESULT_YES, utf8isnormalized(i, is, UTF8_NORMALIZE_COMPOSE, &o));
+	EXPECT_EQ(4, o);
+}
+
+TEST(Utf8NormalizeFast, IsNormalizedDecomposeLeadingClass)
+{
+	/*
+		codepoint  U+0F73 U+0F71
+		  leading     129    129
+		 trailing     130    129
+	*/
+
+	const char* i = "\xE0\xBD\xB3\xE0\xBD\xB1";
+	size_t is = strlen(i);
+	size_t o = 0;
+
+	EXPECT_EQ(UTF8_NORMALIZATION_RESULT_NO, utf8isnormalized(i, is, UTF8_NORMALIZE_DECOMPOSE | UTF8_NORMALIZE_FAST, &o));
+	EXPECT_EQ(3, o);
+}
+
+TEST(Utf8NormalizeFast, IsNormalizedCompose)
+{
+	/*
+		U+0061 U+0316 U+0301
+		     Y      Y      M
+		     0    220    230
+	*/
+
+	const char* i = "a\xCC\x96\xCC\x81";
+	size_t is = strlen(i);
+	size_t o = 0;
+
+	EXPECT_EQ(UTF8_NORMALIZATION_RESULT_MAYBE, utf8isnormalized(i, is, UTF8_NORMALIZE_COMPOSE | UTF8_NORMALIZE_FAST, &o));
+	EXPECT_EQ(3, o);
+}
+
+TEST(Utf8NormalizeFast, IsNormalizedComposeUnstable)
+{
+	/*
+		U+00E1 U+0316
+		     Y      Y
+		     0    220
+	*/
+
+	const char* i = "\xC3\xA1\xCC\x96";
+	size_t is = strlen(i);
+	size_t o = 0;
+
+	EXPECT_EQ(UTF8_NORMALIZATION_RESULT_NO, utf8isnormalized(i, is, UTF8_NORMALIZE_COMPOSE | UTF8_NORMALIZE_FAST, &o));
+	EXPECT_EQ(2, o);
+}
\ No newline at end of file
@@ -0,0 +1,300 @@
+#include "tests-base.hpp"
+
+#include "../helpers/helpers-strings.hpp"
+
+TEST(Utf8NormalizeSplit, InvalidFlag)
+{
+	const char* i = "Flags";
+	size_t is = strlen(i);
+	size_t o[8] = { 0 };
+	size_t os = 8;
+	int32_t errors = UTF8_ERR_NONE;
+
+	EXPECT_EQ(0, utf8normalizesplit(i, is, 2, o, os, 0, &errors));
+	EXPECT_ERROREQ(UTF8_ERR_INVALID_FLAG, errors);
+}
+
+TEST(Utf8NormalizeSplit, InvalidData)
+{
+	size_t o[8] = { 0 };
+	size_t os = 8;
+	int32_t errors = UTF8_ERR_NONE;
+
+	EXPECT_EQ(0, utf8normalizesplit(nullptr, 4, 2, o, os, UTF8_NORMALIZE_COMPOSE, &errors));
+	EXPECT_ERROREQ(UTF8_ERR_INVALID_DATA, errors);
+}
+
+TEST(Utf8NormalizeSplit, InvalidSegmentSize)
+{
+	const char* i = "Zero";
+	size_t is = strlen(i);
+	size_t o[8] = { 0 };
+	size_t os = 8;
+	int32_t errors = UTF8_ERR_NONE;
+
+	EXPECT_EQ(0, utf8normalizesplit(i, is, 0, o, os, UTF8_NORMALIZE_COMPOSE, &errors));
+	EXPECT_ERROREQ(UTF8_ERR_INVALID_DATA, errors);
+}
+
+TEST(Utf8NormalizeSplit, Empty)
+{
+	const char* i = "";
+	size_t o[8] = { 0 };
+	size_t os = 8;
+	int32_t errors = UTF8_ERR_NONE;
+
+	EXPECT_EQ(0, utf8normalizesplit(i, 0, 2, o, os, UTF8_NORMALIZE_COMPOSE, &errors));
+	EXPECT_ERROREQ(UTF8_ERR_NONE, errors);
+}
+
+TEST(Utf8NormalizeSplit, Basic)
+{
+	/*
+		U+0048 U+0065 U+006C U+006C U+006F U+0021 U+0021
+		     Y      Y      Y      Y      Y      Y      Y
+		     0      0      0      0      0      0      0
+	*/
+
+	const char* i = "Hello!!";
+	size_t is = strlen(i);
+	size_t o[8] = { 0 };
+	size_t os = 8;
+	int32_t errors = UTF8_ERR_NONE;
+
+	EXPECT_EQ(4, utf8normalizesplit(i, is, 2, o, os, UTF8_NORMALIZE_COMPOSE, &errors));
+	EXPECT_EQ(0, o[0]);
+	EXPECT_EQ(2, o[1]);
+	EXPECT_EQ(4, o[2]);
+	EXPECT_EQ(6, o[3]);
+	EXPECT_ERROREQ(UTF8_ERR_NONE, errors);
+}
+
+TEST(Utf8NormalizeSplit, SegmentLargerThanInput)
+{
+	const char* i = "Small";
+	size_t is = strlen(i);
+	size_t o[8] = { 0 };
+	size_t os = 8;
+	int32_t errors = UTF8_ERR_NONE;
+
+	EXPECT_EQ(1, utf8normalizesplit(i, is, 1024, o, os, UTF8_NORMALIZE_DECOMPOSE, &errors));
+	EXPECT_EQ(0, o[0]);
+	EXPECT_ERROREQ(UTF8_ERR_NONE, errors);
+}
+
+TEST(Utf8NormalizeSplit, SkipNonStarters)
+{
+	/*
+		U+0061 U+0301 U+0323 U+0062 U+0063
+		     Y      M      M      Y      Y
+		     0    230    220      0      0
+	*/
+
+	const char* i = "a\xCC\x81\xCC\xA3" "bc";
+	size_t is = strlen(i);
+	size_t o[8] = { 0 };
+	size_t os = 8;
+	int32_t errors = UTF8_ERR_NONE;
+
+	EXPECT_EQ(3, utf8normalizesplit(i, is, 1, o, os, UTF8_NORMALIZE_COMPOSE, &errors));
+	EXPECT_EQ(0, o[0]);
+	EXPECT_EQ(5, o[1]);
+	EXPECT_EQ(6, o[2]);
+	EXPECT_ERROREQ(UTF8_ERR_NONE, errors);
+}
+
+TEST(Utf8NormalizeSplit, SkipPartialSequence)
+{
+	/*
+		U+00E9 U+00E9 U+00E9
+		     Y      Y      Y
+		     0      0      0
+	*/
+
+	const char* i = "\xC3\xA9\xC3\xA9\xC3\xA9";
+	size_t is = strlen(i);
+	size_t o[8] = { 0 };
+	size_t os = 8;
+	int32_t errors = UTF8_ERR_NONE;
+
+	EXPECT_EQ(2, utf8normalizesplit(i, is, 3, o, os, UTF8_NORMALIZE_COMPOSE, &errors));
+	EXPECT_EQ(0, o[0]);
+	EXPECT_EQ(4, o[1]);
+	EXPECT_ERROREQ(UTF8_ERR_NONE, errors);
+}
+
+TEST(Utf8NormalizeSplit, HangulJamo)
+{
+	/*
+		U+1100 U+1161 U+11A8 U+1100 U+1161
+		     Y      M      M      Y      M
+		     0      0      0      0      0
+	*/
+
+	const char* i = "\xE1\x84\x80\xE1\x85\xA1\xE1\x86\xA8\xE1\x84\x80\xE1\x85\xA1";
+	size_t is = strlen(i);
+	size_t o[8] = { 0 };
+	size_t os = 8;
+	int32_t errors = UTF8_ERR_NONE;
+
+	EXPECT_EQ(2, utf8normalizesplit(i, is, 3, o, os, UTF8_NORMALIZE_COMPOSE, &errors));
+	EXPECT_EQ(0, o[0]);
+	EXPECT_EQ(9, o[1]);
+	EXPECT_ERROREQ(UTF8_ERR_NONE, errors);
+
+	EXPECT_EQ(5, utf8normalizesplit(i, is, 3, o, os, UTF8_NORMALIZE_DECOMPOSE, &errors));
+	EXPECT_EQ(0, o[0]);
+	EXPECT_EQ(3, o[1]);
+	EXPECT_EQ(6, o[2]);
+	EXPECT_EQ(9, o[3]);
+	EXPECT_EQ(12, o[4]);
+	EXPECT_ERROREQ(UTF8_ERR_NONE, errors);
+}
+
+TEST(Utf8NormalizeSplit, AmountOfSegments)
+{
+	const char* i = "Segments";
+	size_t is = strlen(i);
+	int32_t errors = UTF8_ERR_NONE;
+
+	EXPECT_EQ(3, utf8normalizesplit(i, is, 3, nullptr, 0, UTF8_NORMALIZE_COMPOSE, &errors));
+	EXPECT_ERROREQ(UTF8_ERR_NONE, errors);
+}
+
+TEST(Utf8NormalizeSplit, NotEnoughSpace)
+{
+	const char* i = "Segments";
+	size_t is = strlen(i);
+	size_t o[8] = { 0 };
+	size_t os = 2;
+	int32_t errors = UTF8_ERR_NONE;
+
+	EXPECT_EQ(2, utf8normalizesplit(i, is, 3, o, os, UTF8_NORMALIZE_COMPOSE, &errors));
+	EXPECT_EQ(0, o[0]);
+	EXPECT_EQ(3, o[1]);
+	EXPECT_EQ(0, o[2]);
+	EXPECT_ERROREQ(UTF8_ERR_NOT_ENOUGH_SPACE, errors);
+}
+
+TEST(Utf8NormalizeSplit, SegmentsMatchNormalize)
+{
+	std::string i;
+	for (size_t j = 0; j < 100; ++j)
+	{
+		i += "\xEF\xBC\xA1" "e\xCC\x81\xEA\xB0\x80\xE1\x84\x80\xE1\x85\xA1" "o\xCC\x88\xCC\xA3\xEF\xAC\x81\xE2\x84\xAB ";
+	}
+
+	size_t flags[] = {
+		UTF8_NORMALIZE_COMPOSE,
+		UTF8_NORMALIZE_DECOMPOSE,
+		UTF8_NORMALIZE_COMPOSE | UTF8_NORMALIZE_COMPATIBILITY,
+		UTF8_NORMALIZE_DECOMPOSE | UTF8_NORMALIZE_COMPATIBILITY
+	};
+
+	for (size_t f = 0; f < sizeof(flags) / sizeof(size_t); ++f)
+	{
+		int32_t errors = UTF8_ERR_NONE;
+
+		std::string e;
+		e.resize(utf8normalize(i.c_str(), i.length(), nullptr, 0, flags[f], nullptr));
+		utf8normalize(i.c_str(), i.length(), &e[0], e.length(), flags[f], nullptr);
+
+		for (size_t segment_size = 1; segment_size <= 64; segment_size += 7)
+		{
+			std::vector<size_t> offsets(utf8normalizesplit(i.c_str(), i.length(), segment_size, nullptr, 0, flags[f], &errors));
+			EXPECT_ERROREQ(UTF8_ERR_NONE, errors);
+
+			utf8normalizesplit(i.c_str(), i.length(), segment_size, &offsets[0], offsets.size(), flags[f], &errors);
+			EXPECT_ERROREQ(UTF8_ERR_NONE, errors);
+
+			offsets.push_back(i.length());
+
+			std::string o;
+			for (size_t s = 0; s < offsets.size() - 1; ++s)
+			{
+				std::string segment;
+				segment.resize(utf8normalize(i.c_str() + offsets[s], offsets[s + 1] - offsets[s], nullptr, 0, flags[f], nullptr));
+				utf8normalize(i.c_str() + offsets[s], offsets[s + 1] - offsets[s], &segment[0], segment.length(), flags[f], &errors);
+				EXPECT_ERROREQ(UTF8_ERR_NONE, errors);
+
+				o += segment;
+			}
+
+			EXPECT_UTF8EQ(e.c_str(), o.c_str());
+		}
+	}
+}
+
+TEST(Utf8NormalizeSplit, LongSequenceMatchesReference)
+{
+	/*
+		U+0078 U+0061 U+0301 (40 times) U+0079
+		     Y      Y      M                 Y
+		     0      0    230                 0
+	*/
+
+	std::string i = "xa";
+
+	for (size_t k = 0; k < 40; ++k)
+	{
+		i += "\xCC\x81";
+	}
+
+	i += "y";
+
+	/* COMBINING GRAPHEME JOINER is inserted after 30 codepoints in a sequence */
+
+	std::string c = "x\xC3\xA1";
+	std::string d = "xa";
+
+	for (size_t k = 0; k < 28; ++k)
+	{
+		c += "\xCC\x81";
+		d += "\xCC\x81";
+	}
+
+	c += "\xCD\x8F";
+	d += "\xCC\x81\xCD\x8F";
+
+	for (size_t k = 0; k < 11; ++k)
+	{
+		c += "\xCC\x81";
+		d += "\xCC\x81";
+	}
+
+	c += "y";
+	d += "y";
+
+	size_t flags[] = { UTF8_NORMALIZE_COMPOSE, UTF8_NORMALIZE_DECOMPOSE };
+	std::string expected[] = { c, d };
+
+	for (size_t f = 0; f < sizeof(flags) / sizeof(size_t); ++f)
+	{
+		int32_t errors = UTF8_ERR_NONE;
+		char o[256] = { 0 };
+
+		EXPECT_EQ(expected[f].length(), utf8normalize(i.c_str(), i.length(), o, 255, flags[f], &errors));
+		EXPECT_UTF8EQ(expected[f].c_str(), o);
+		EXPECT_ERROREQ(UTF8_ERR_NONE, errors);
+
+		for (size_t segment_size = 1; segment_size <= 64; segment_size += 7)
+		{
+			size_t offsets[16] = { 0 };
+			size_t offsets_size = utf8normalizesplit(i.c_str(), i.length(), segment_size, offsets, 15, flags[f], &errors);
+			EXPECT_ERROREQ(UTF8_ERR_NONE, errors);
+
+			offsets[offsets_size] = i.length();
+
+			std::string s;
+			for (size_t k = 0; k < offsets_size; ++k)
+			{
+				char segment[256] = { 0 };
+
+				s.append(segment, utf8normalize(i.c_str() + offsets[k], offsets[k + 1] - offsets[k], segment, 255, flags[f], &errors));
+				EXPECT_ERROREQ(UTF8_ERR_NONE, errors);
+			}
+
+			EXPECT_UTF8EQ(expected[f].c_str(), s.c_str());
+		}
+	}
+}
\ No newline at end of file
@@ -0,0 +1,206 @@
+#include "tests-base.hpp"
+
+#include "../helpers/helpers-strings.hpp"
+
+TEST(Utf8NormalizeStripMarks, BasicLatin)
+{
+	const char* i = "Hello World";
+	size_t is = strlen(i);
+	char o[256] = { 0 };
+	size_t os = 255;
+	int32_t errors = UTF8_ERR_NONE;
+
+	EXPECT_EQ(11, utf8normalize(i, is, o, os, UTF8_NORMALIZE_COMPOSE | UTF8_NORMALIZE_STRIP_MARKS, &errors));
+	EXPECT_UTF8EQ("Hello World", o);
+	EXPECT_ERROREQ(UTF8_ERR_NONE, errors);
+}
+
+TEST(Utf8NormalizeStripMarks, Composed)
+{
+	/*
+		U+0043 U+0072 U+00E8 U+006D U+0065
+		     0      0      0      0      0
+	*/
+
+	const char* i = "Cr\xC3\xA8me";
+	size_t is = strlen(i);
+	char o[256] = { 0 };
+	size_t os = 255;
+	int32_t errors = UTF8_ERR_NONE;
+
+	EXPECT_EQ(5, utf8normalize(i, is, o, os, UTF8_NORMALIZE_COMPOSE | UTF8_NORMALIZE_STRIP_MARKS, &errors));
+	EXPECT_UTF8EQ("Creme", o);
+	EXPECT_ERROREQ(UTF8_ERR_NONE, errors);
+}
+
+TEST(Utf8NormalizeStripMarks, Decomposed)
+{
+	/*
+		U+0062 U+0072 U+0075 U+0302 U+006C U+0065 U+0301 U+0065
+		     0      0      0    230      0      0    230      0
+	*/
+
+	const char* i = "bru\xCC\x82le\xCC\x81" "e";
+	size_t is = strlen(i);
+	char o[256] = { 0 };
+	size_t os = 255;
+	int32_t errors = UTF8_ERR_NONE;
+
+	EXPECT_EQ(6, utf8normalize(i, is, o, os, UTF8_NORMALIZE_DECOMPOSE | UTF8_NORMALIZE_STRIP_MARKS, &errors));
+	EXPECT_UTF8EQ("brulee", o);
+	EXPECT_ERROREQ(UTF8_ERR_NONE, errors);
+}
+
+TEST(Utf8NormalizeStripMarks, MultipleMarks)
+{
+	/*
+		U+1EC7 U+0323 U+0301
+		     0    220    230
+	*/
+
+	const char* i = "\xE1\xBB\x87\xCC\xA3\xCC\x81";
+	size_t is = strlen(i);
+	char o[256] = { 0 };
+	size_t os = 255;
+	int32_t errors = UTF8_ERR_NONE;
+
+	EXPECT_EQ(1, utf8normalize(i, is, o, os, UTF8_NORMALIZE_COMPOSE | UTF8_NORMALIZE_STRIP_MARKS, &errors));
+	EXPECT_UTF8EQ("e", o);
+	EXPECT_ERROREQ(UTF8_ERR_NONE, errors);
+}
+
+TEST(Utf8NormalizeStripMarks, Greek)
+{
+	/*
+		U+1F00 U+03AC U+1FB7
+		     0      0      0
+	*/
+
+	const char* i = "\xE1\xBC\x80\xCE\xAC\xE1\xBE\xB7";
+	size_t is = strlen(i);
+	char o[256] = { 0 };
+	size_t os = 255;
+	int32_t errors = UTF8_ERR_NONE;
+
+	EXPECT_EQ(6, utf8normalize(i, is, o, os, UTF8_NORMALIZE_COMPOSE | UTF8_NORMALIZE_STRIP_MARKS, &errors));
+	EXPECT_UTF8EQ("\xCE\xB1\xCE\xB1\xCE\xB1", o);
+	EXPECT_ERROREQ(UTF8_ERR_NONE, errors);
+}
+
+TEST(Utf8NormalizeStripMarks, SpacingMarksAreKept)
+{
+	/*
+		U+0915 U+093C U+093F
+		     0      7      0
+	*/
+
+	const char* i = "\xE0\xA4\x95\xE0\xA4\xBC\xE0\xA4\xBF";
+	size_t is = strlen(i);
+	char o[256] = { 0 };
+	size_t os = 255;
+	int32_t errors = UTF8_ERR_NONE;
+
+	EXPECT_EQ(6, utf8normalize(i, is, o, os, UTF8_NORMALIZE_COMPOSE | UTF8_NORMALIZE_STRIP_MARKS, &errors));
+	EXPECT_UTF8EQ("\xE0\xA4\x95\xE0\xA4\xBF", o);
+	EXPECT_ERROREQ(UTF8_ERR_NONE, errors);
+}
+
+TEST(Utf8NormalizeStripMarks, NonSpacingStarter)
+{
+	/*
+		U+0E01 U+0E31 U+0E19
+		     0      0      0
+	*/
+
+	const char* i = "\xE0\xB8\x81\xE0\xB8\xB1\xE0\xB8\x99";
+	size_t is = strlen(i);
+	char o[256] = { 0 };
+	size_t os = 255;
+	int32_t errors = UTF8_ERR_NONE;
+
+	EXPECT_EQ(6, utf8normalize(i, is, o, os, UTF8_NORMALIZE_DECOMPOSE | UTF8_NORMALIZE_STRIP_MARKS, &errors));
+	EXPECT_UTF8EQ("\xE0\xB8\x81\xE0\xB8\x99", o);
+	EXPECT_ERROREQ(UTF8_ERR_NONE, errors);
+}
+
+TEST(Utf8NormalizeStripMarks, OnlyMarks)
+{
+	const char* i = "\xCC\x81\xCC\x80\xCC\xA3";
+	size_t is = strlen(i);
+	char o[256] = { 0 };
+	size_t os = 255;
+	int32_t errors = UTF8_ERR_NONE;
+
+	EXPECT_EQ(0, utf8normalize(i, is, o, os, UTF8_NORMALIZE_COMPOSE | UTF8_NORMALIZE_STRIP_MARKS, &errors));
+	EXPECT_UTF8EQ("", o);
+	EXPECT_ERROREQ(UTF8_ERR_NONE, errors);
+}
+
+TEST(Utf8NormalizeStripMarks, LongSequenceOfMarks)
+{
+	std::string i = "a";
+
+	for (size_t k = 0; k < 100; ++k)
+	{
+		i += "\xCC\x81";
+	}
+
+	i += "b";
+
+	char o[256] = { 0 };
+	size_t os = 255;
+	int32_t errors = UTF8_ERR_NONE;
+
+	EXPECT_EQ(2, utf8normalize(i.c_str(), i.length(), o, os, UTF8_NORMALIZE_COMPOSE | UTF8_NORMALIZE_STRIP_MARKS, &errors));
+	EXPECT_UTF8EQ("ab", o);
+	EXPECT_ERROREQ(UTF8_ERR_NONE, errors);
+}
+
+TEST(Utf8NormalizeStripMarks, CaseFold)
+{
+	const char* i = "Cr\xC3\x88ME BR\xC3\x9BL\xC3\x89" "E \xEF\xAC\x81" "ne";
+	size_t is = strlen(i);
+	char o[256] = { 0 };
+	size_t os = 255;
+	int32_t errors = UTF8_ERR_NONE;
+
+	EXPECT_EQ(17, utf8normalize(i, is, o, os, UTF8_NORMALIZE_COMPOSE | UTF8_NORMALIZE_COMPATIBILITY | UTF8_NORMALIZE_CASEFOLD | UTF8_NORMALIZE_STRIP_MARKS, &errors));
+	EXPECT_UTF8EQ("creme brulee fine", o);
+	EXPECT_ERROREQ(UTF8_ERR_NONE, errors);
+}
+
+TEST(Utf8NormalizeStripMarks, Hangul)
+{
+	const char* i = "\xED\x95\x9C\xEA\xB8\x80";
+	size_t is = strlen(i);
+	char o[256] = { 0 };
+	size_t os = 255;
+	int32_t errors = UTF8_ERR_NONE;
+
+	EXPECT_EQ(6, utf8normalize(i, is, o, os, UTF8_NORMALIZE_COMPOSE | UTF8_NORMALIZE_STRIP_MARKS, &errors));
+	EXPECT_UTF8EQ("\xED\x95\x9C\xEA\xB8\x80", o);
+	EXPECT_ERROREQ(UTF8_ERR_NONE, errors);
+}
+
+TEST(Utf8NormalizeStripMarks, AmountOfBytes)
+{
+	const char* i = "Cr\xC3\xA8me";
+	size_t is = strlen(i);
+	int32_t errors = UTF8_ERR_NONE;
+
+	EXPECT_EQ(5, utf8normalize(i, is, nullptr, 0, UTF8_NORMALIZE_COMPOSE | UTF8_NORMALIZE_STRIP_MARKS, &errors));
+	EXPECT_ERROREQ(UTF8_ERR_NONE, errors);
+}
+
+TEST(Utf8NormalizeStripMarks, NotEnoughSpace)
+{
+	const char* i = "Cr\xC3\xA8me";
+	size_t is = strlen(i);
+	char o[256] = { 0 };
+	size_t os = 3;
+	int32_t errors = UTF8_ERR_NONE;
+
+	EXPECT_EQ(3, utf8normalize(i, is, o, os, UTF8_NORMALIZE_COMPOSE | UTF8_NORMALIZE_STRIP_MARKS, &errors));
+	EXPECT_UTF8EQ("Cre", o);
+	EXPECT_ERROREQ(UTF8_ERR_NOT_ENOUGH_SPACE, errors);
+}
\ No newline at end of file
@@ -0,0 +1,458 @@
+#include "tests-base.hpp"
+
+#include "../helpers/helpers-strings.hpp"
+
+TEST(Utf8Normalizer, InitializeSuccess)
+{
+	utf8normalizer_t n;
+	int32_t errors = UTF8_ERR_NONE;
+
+	EXPECT_EQ(1, utf8normalizerinit(&n, UTF8_NORMALIZE_COMPOSE, &errors));
+	EXPECT_ERROREQ(UTF8_ERR_NONE, errors);
+}
+
+TEST(Utf8Normalizer, InitializeInvalidFlag)
+{
+	utf8normalizer_t n;
+	int32_t errors = UTF8_ERR_NONE;
+
+	EXPECT_EQ(0, utf8normalizerinit(&n, UTF8_NORMALIZE_COMPATIBILITY, &errors));
+	EXPECT_ERROREQ(UTF8_ERR_INVALID_FLAG, errors);
+}
+
+TEST(Utf8Normalizer, InitializeInvalidData)
+{
+	int32_t errors = UTF8_ERR_NONE;
+
+	EXPECT_EQ(0, utf8normalizerinit(nullptr, UTF8_NORMALIZE_DECOMPOSE, &errors));
+	EXPECT_ERROREQ(UTF8_ERR_INVALID_DATA, errors);
+}
+
+TEST(Utf8Normalizer, WriteNotInitialized)
+{
+	utf8normalizer_t n;
+	memset(&n, 0, sizeof(n));
+	const char* i = "Zero";
+	size_t is = strlen(i);
+	char o[256] = { 0 };
+	size_t os = 255;
+	size_t c = 99;
+	int32_t errors = UTF8_ERR_NONE;
+
+	EXPECT_EQ(0, utf8normalizerwrite(&n, i, is, o, os, &c, &errors));
+	EXPECT_UTF8EQ("", o);
+	EXPECT_EQ(0, c);
+	EXPECT_ERROREQ(UTF8_ERR_INVALID_FLAG, errors);
+}
+
+TEST(Utf8Normalizer, WriteInvalidData)
+{
+	utf8normalizer_t n;
+	const char* i = "Null";
+	size_t is = strlen(i);
+	size_t c = 99;
+	int32_t errors = UTF8_ERR_NONE;
+
+	utf8normalizerinit(&n, UTF8_NORMALIZE_COMPOSE, nullptr);
+
+	EXPECT_EQ(0, utf8normalizerwrite(&n, i, is, nullptr, 16, &c, &errors));
+	EXPECT_EQ(0, c);
+	EXPECT_ERROREQ(UTF8_ERR_INVALID_DATA, errors);
+}
+
+TEST(Utf8Normalizer, WriteOverlapping)
+{
+	utf8normalizer_t n;
+	char data[32] = "Overlap";
+	size_t c = 99;
+	int32_t errors = UTF8_ERR_NONE;
+
+	utf8normalizerinit(&n, UTF8_NORMALIZE_COMPOSE, nullptr);
+
+	EXPECT_EQ(0, utf8normalizerwrite(&n, data, 7, data + 4, 16, &c, &errors));
+	EXPECT_EQ(0, c);
+	EXPECT_ERROREQ(UTF8_ERR_OVERLAPPING_PARAMETERS, errors);
+}
+
+TEST(Utf8Normalizer, WriteHoldsLastCodepoint)
+{
+	/*
+		U+0048 U+0065 U+006C U+006C U+006F
+		     Y      Y      Y      Y      Y
+		     0      0      0      0      0
+	*/
+
+	utf8normalizer_t n;
+	const char* i = "Hello";
+	size_t is = strlen(i);
+	char o[256] = { 0 };
+	size_t os = 255;
+	size_t c = 0;
+	int32_t errors = UTF8_ERR_NONE;
+
+	utf8normalizerinit(&n, UTF8_NORMALIZE_COMPOSE, nullptr);
+
+	EXPECT_EQ(4, utf8normalizerwrite(&n, i, is, o, os, &c, &errors));
+	EXPECT_UTF8EQ("Hell", o);
+	EXPECT_EQ(5, c);
+	EXPECT_ERROREQ(UTF8_ERR_NONE, errors);
+
+	EXPECT_EQ(1, utf8normalizerflush(&n, o + 4, os - 4, &errors));
+	EXPECT_UTF8EQ("Hello", o);
+	EXPECT_ERROREQ(UTF8_ERR_NONE, errors);
+}
+
+TEST(Utf8Normalizer, WriteComposeAcrossChunks)
+{
+	/*
+		U+0041 U+006D U+0065 | U+0301 U+006C U+0069 U+0065
+		     Y      Y      Y |      M      Y      Y      Y
+		     0      0      0 |    230      0      0      0
+	*/
+
+	utf8normalizer_t n;
+	char o[256] = { 0 };
+	size_t os = 255;
+	size_t ow = 0;
+	size_t c = 0;
+	int32_t errors = UTF8_ERR_NONE;
+
+	utf8normalizerinit(&n, UTF8_NORMALIZE_COMPOSE, nullptr);
+
+	ow += utf8normalizerwrite(&n, "Ame", 3, o + ow, os - ow, &c, &errors);
+	EXPECT_EQ(3, c);
+	EXPECT_UTF8EQ("Am", o);
+	EXPECT_ERROREQ(UTF8_ERR_NONE, errors);
+
+	ow += utf8normalizerwrite(&n, "\xCC\x81lie", 5, o + ow, os - ow, &c, &errors);
+	EXPECT_EQ(5, c);
+	EXPECT_UTF8EQ("Am\xC3\xA9li", o);
+	EXPECT_ERROREQ(UTF8_ERR_NONE, errors);
+
+	ow += utf8normalizerflush(&n, o + ow, os - ow, &errors);
+	EXPECT_EQ(7, ow);
+	EXPECT_UTF8EQ("Am\xC3\xA9lie", o);
+	EXPECT_ERROREQ(UTF8_ERR_NONE, errors);
+}
+
+TEST(Utf8Normalizer, WriteSplitSequence)
+{
+	/*
+		U+0065 U+0301
+		     Y      M
+		     0    230
+	*/
+
+	utf8normalizer_t n;
+	char o[256] = { 0 };
+	size_t os = 255;
+	size_t ow = 0;
+	size_t c = 0;
+	int32_t errors = UTF8_ERR_NONE;
+
+	utf8normalizerinit(&n, UTF8_NORMALIZE_COMPOSE, nullptr);
+
+	ow += utf8normalizerwrite(&n, "e", 1, o + ow, os - ow, &c, &errors);
+	EXPECT_EQ(1, c);
+	ow += utf8normalizerwrite(&n, "\xCC", 1, o + ow, os - ow, &c, &errors);
+	EXPECT_EQ(1, c);
+	ow += utf8normalizerwrite(&n, "\x81", 1, o + ow, os - ow, &c, &errors);
+	EXPECT_EQ(1, c);
+	EXPECT_EQ(0, ow);
+	EXPECT_ERROREQ(UTF8_ERR_NONE, errors);
+
+	ow += utf8normalizerflush(&n, o + ow, os - ow, &errors);
+	EXPECT_EQ(2, ow);
+	EXPECT_UTF8EQ("\xC3\xA9", o);
+	EXPECT_ERROREQ(UTF8_ERR_NONE, errors);
+}
+
+TEST(Utf8Normalizer, WriteDecomposeReorderAcrossChunks)
+{
+	/*
+		U+0061 | U+0301 | U+0323 U+0062
+		     Y |      Y |      Y      Y
+		     0 |    230 |    220      0
+	*/
+
+	utf8normalizer_t n;
+	char o[256] = { 0 };
+	size_t os = 255;
+	size_t ow = 0;
+	size_t c = 0;
+	int32_t errors = UTF8_ERR_NONE;
+
+	utf8normalizerinit(&n, UTF8_NORMALIZE_DECOMPOSE, nullptr);
+
+	ow += utf8normalizerwrite(&n, "a", 1, o + ow, os - ow, &c, &errors);
+	ow += utf8normalizerwrite(&n, "\xCC\x81", 2, o + ow, os - ow, &c, &errors);
+	ow += utf8normalizerwrite(&n, "\xCC\xA3" "b", 3, o + ow, os - ow, &c, &errors);
+	EXPECT_EQ(5, ow);
+	EXPECT_UTF8EQ("a\xCC\xA3\xCC\x81", o);
+	EXPECT_ERROREQ(UTF8_ERR_NONE, errors);
+
+	ow += utf8normalizerflush(&n, o + ow, os - ow, &errors);
+	EXPECT_EQ(6, ow);
+	EXPECT_UTF8EQ("a\xCC\xA3\xCC\x81" "b", o);
+	EXPECT_ERROREQ(UTF8_ERR_NONE, errors);
+}
+
+TEST(Utf8Normalizer, WriteNotEnoughSpace)
+{
+	/*
+		U+00C5 U+0042 U+0043
+		     N      Y      Y
+		     0      0      0
+	*/
+
+	utf8normalizer_t n;
+	const char* i = "\xE2\x84\xAB" "BC";
+	size_t is = strlen(i);
+	char o[256] = { 0 };
+	size_t c = 0;
+	int32_t errors = UTF8_ERR_NONE;
+
+	utf8normalizerinit(&n, UTF8_NORMALIZE_DECOMPOSE, nullptr);
+
+	EXPECT_EQ(1, utf8normalizerwrite(&n, i, is, o, 1, &c, &errors));
+	EXPECT_EQ(5, c);
+	EXPECT_UTF8EQ("A", o);
+	EXPECT_ERROREQ(UTF8_ERR_NOT_ENOUGH_SPACE, errors);
+
+	EXPECT_EQ(1, utf8normalizerwrite(&n, nullptr, 0, o + 1, 1, &c, &errors));
+	EXPECT_EQ(0, c);
+	EXPECT_ERROREQ(UTF8_ERR_NOT_ENOUGH_SPACE, errors);
+
+	EXPECT_EQ(1, utf8normalizerwrite(&n, nullptr, 0, o + 2, 1, &c, &errors));
+	EXPECT_EQ(0, c);
+	EXPECT_ERROREQ(UTF8_ERR_NOT_ENOUGH_SPACE, errors);
+
+	EXPECT_EQ(1, utf8normalizerwrite(&n, nullptr, 0, o + 3, 1, &c, &errors));
+	EXPECT_UTF8EQ("A\xCC\x8A" "B", o);
+	EXPECT_ERROREQ(UTF8_ERR_NONE, errors);
+
+	EXPECT_EQ(1, utf8normalizerflush(&n, o + 4, 1, &errors));
+	EXPECT_UTF8EQ("A\xCC\x8A" "BC", o);
+	EXPECT_ERROREQ(UTF8_ERR_NONE, errors);
+}
+
+TEST(Utf8Normalizer, FlushNotEnoughSpace)
+{
+	/*
+		U+FB01
+		     N
+		     0
+	*/
+
+	utf8normalizer_t n;
+	const char* i = "\xEF\xAC\x81";
+	size_t is = strlen(i);
+	char o[256] = { 0 };
+	size_t c = 0;
+	int32_t errors = UTF8_ERR_NONE;
+
+	utf8normalizerinit(&n, UTF8_NORMALIZE_COMPOSE | UTF8_NORMALIZE_COMPATIBILITY, nullptr);
+
+	EXPECT_EQ(0, utf8normalizerwrite(&n, i, is, o, 255, &c, &errors));
+	EXPECT_EQ(3, c);
+	EXPECT_ERROREQ(UTF8_ERR_NONE, errors);
+
+	EXPECT_EQ(1, utf8normalizerflush(&n, o, 1, &errors));
+	EXPECT_UTF8EQ("f", o);
+	EXPECT_ERROREQ(UTF8_ERR_NOT_ENOUGH_SPACE, errors);
+
+	EXPECT_EQ(1, utf8normalizerflush(&n, o + 1, 1, &errors));
+	EXPECT_UTF8EQ("fi", o);
+	EXPECT_ERROREQ(UTF8_ERR_NONE, errors);
+}
+
+TEST(Utf8Normalizer, FlushIncompleteSequence)
+{
+	utf8normalizer_t n;
+	char o[256] = { 0 };
+	size_t os = 255;
+	size_t ow = 0;
+	size_t c = 0;
+	int32_t errors = UTF8_ERR_NONE;
+
+	utf8normalizerinit(&n, UTF8_NORMALIZE_DECOMPOSE, nullptr);
+
+	ow += utf8normalizerwrite(&n, "Bro\xE2\x82", 5, o + ow, os - ow, &c, &errors);
+	EXPECT_EQ(5, c);
+	EXPECT_ERROREQ(UTF8_ERR_NONE, errors);
+
+	ow += utf8normalizerflush(&n, o + ow, os - ow, &errors);
+	EXPECT_EQ(6, ow);
+	EXPECT_UTF8EQ("Bro\xEF\xBF\xBD", o);
+	EXPECT_ERROREQ(UTF8_ERR_NONE, errors);
+}
+
+TEST(Utf8Normalizer, FlushReuse)
+{
+	utf8normalizer_t n;
+	char o[256] = { 0 };
+	size_t os = 255;
+	size_t ow = 0;
+	size_t c = 0;
+	int32_t errors = UTF8_ERR_NONE;
+
+	utf8normalizerinit(&n, UTF8_NORMALIZE_COMPOSE, nullptr);
+
+	ow += utf8normalizerwrite(&n, "A\xCC\x8A", 3, o + ow, os - ow, &c, &errors);
+	ow += utf8normalizerflush(&n, o + ow, os - ow, &errors);
+	EXPECT_EQ(2, ow);
+	EXPECT_UTF8EQ("\xC3\x85", o);
+	EXPECT_ERROREQ(UTF8_ERR_NONE, errors);
+
+	ow += utf8normalizerwrite(&n, "o\xCC\x88", 3, o + ow, os - ow, &c, &errors);
+	ow += utf8normalizerflush(&n, o + ow, os - ow, &errors);
+	EXPECT_EQ(4, ow);
+	EXPECT_UTF8EQ("\xC3\x85\xC3\xB6", o);
+	EXPECT_ERROREQ(UTF8_ERR_NONE, errors);
+}
+
+TEST(Utf8Normalizer, LongStreamMatchesNormalize)
+{
+	std::string i;
+	for (size_t j = 0; j < 200; ++j)
+	{
+		i += "\xEF\xBC\xA1" "e\xCC\x81\xEA\xB0\x80\xE1\x84\x80\xE1\x85\xA1" "o\xCC\x88\xCC\xA3 ";
+	}
+
+	size_t flags[] = {
+		UTF8_NORMALIZE_COMPOSE,
+		UTF8_NORMALIZE_DECOMPOSE,
+		UTF8_NORMALIZE_COMPOSE | UTF8_NORMALIZE_COMPATIBILITY,
+		UTF8_NORMALIZE_DECOMPOSE | UTF8_NORMALIZE_COMPATIBILITY
+	};
+
+	for (size_t f = 0; f < sizeof(flags) / sizeof(size_t); ++f)
+	{
+		int32_t errors = UTF8_ERR_NONE;
+
+		std::string e;
+		e.resize(utf8normalize(i.c_str(), i.length(), nullptr, 0, flags[f], nullptr));
+		utf8normalize(i.c_str(), i.length(), &e[0], e.length(), flags[f], nullptr);
+
+		for (size_t chunk = 1; chunk <= 37; chunk += 6)
+		{
+			utf8normalizer_t n;
+			std::string o;
+			char buffer[7];
+
+			utf8normalizerinit(&n, flags[f], nullptr);
+
+			for (size_t offset = 0; offset < i.length(); )
+			{
+				size_t c = 0;
+				size_t is = (i.length() - offset < chunk) ? (i.length() - offset) : chunk;
+
+				o.append(buffer, utf8normalizerwrite(&n, i.c_str() + offset, is, buffer, sizeof(buffer), &c, &errors));
+				offset += c;
+			}
+
+			do
+			{
+				o.append(buffer, utf8normalizerflush(&n, buffer, sizeof(buffer), &errors));
+			}
+			while (errors == UTF8_ERR_NOT_ENOUGH_SPACE);
+
+			EXPECT_UTF8EQ(e.c_str(), o.c_str());
+			EXPECT_ERROREQ(UTF8_ERR_NONE, errors);
+		}
+	}
+}
+
+TEST(Utf8Normalizer, LongRunOfNonStarters)
+{
+	std::string i = "a";
+	for (size_t j = 0; j < 300; ++j)
+	{
+		i += "\xCC\x81";
+	}
+	i += "b";
+
+	utf8normalizer_t n;
+	std::string o;
+	char buffer[64];
+	size_t c = 0;
+	int32_t errors = UTF8_ERR_NONE;
+
+	utf8normalizerinit(&n, UTF8_NORMALIZE_COMPOSE, nullptr);
+
+	for (size_t offset = 0; offset < i.length(); offset += c)
+	{
+		o.append(buffer, utf8normalizerwrite(&n, i.c_str() + offset, i.length() - offset, buffer, sizeof(buffer), &c, &errors));
+	}
+
+	do
+	{
+		o.append(buffer, utf8normalizerflush(&n, buffer, sizeof(buffer), &errors));
+	}
+	while (errors == UTF8_ERR_NOT_ENOUGH_SPACE);
+
+	EXPECT_EQ(0, o.find("\xC3\xA1\xCC\x81"));
+	EXPECT_EQ(o.length() - 1, o.rfind("b"));
+	EXPECT_ERROREQ(UTF8_ERR_NONE, errors);
+}
+
+TEST(Utf8Normalizer, LongCombiningRunMatchesNormalize)
+{
+	/*
+		U+0061 U+1FA9 U+0301 (27 times)
+		     Y      N      M
+		     0      0    230
+	*/
+
+	std::string i = "a\xE1\xBE\xA9";
+	for (size_t j = 0; j < 27; ++j)
+	{
+		i += "\xCC\x81";
+	}
+
+	size_t flags[] = {
+		UTF8_NORMALIZE_COMPOSE,
+		UTF8_NORMALIZE_DECOMPOSE,
+		UTF8_NORMALIZE_COMPOSE | UTF8_NORMALIZE_COMPATIBILITY,
+		UTF8_NORMALIZE_DECOMPOSE | UTF8_NORMALIZE_COMPATIBILITY,
+		UTF8_NORMALIZE_COMPOSE | UTF8_NORMALIZE_COMPATIBILITY | UTF8_NORMALIZE_CASEFOLD
+	};
+
+	for (size_t f = 0; f < sizeof(flags) / sizeof(size_t); ++f)
+	{
+		int32_t errors = UTF8_ERR_NONE;
+
+		std::string e;
+		e.resize(utf8normalize(i.c_str(), i.length(), nullptr, 0, flags[f], nullptr));
+		utf8normalize(i.c_str(), i.length(), &e[0], e.length(), flags[f], &errors);
+		EXPECT_ERROREQ(UTF8_ERR_NONE, errors);
+		EXPECT_LT(50, e.length());
+
+		for (size_t chunk = 1; chunk <= 64; chunk += 9)
+		{
+			utf8normalizer_t n;
+			std::string o;
+			char buffer[16];
+
+			utf8normalizerinit(&n, flags[f], nullptr);
+
+			for (size_t offset = 0; offset < i.length(); )
+			{
+				size_t c = 0;
+				size_t is = (i.length() - offset < chunk) ? (i.length() - offset) : chunk;
+
+				o.append(buffer, utf8normalizerwrite(&n, i.c_str() + offset, is, buffer, sizeof(buffer), &c, &errors));
+				offset += c;
+			}
+
+			do
+			{
+				o.append(buffer, utf8normalizerflush(&n, buffer, sizeof(buffer), &errors));
+			}
+			while (errors == UTF8_ERR_NOT_ENOUGH_SPACE);
+
+			EXPECT_UTF8EQ(e.c_str(), o.c_str());
+			EXPECT_ERROREQ(UTF8_ERR_NONE, errors);
+		}
+	}
+}
\ No newline at end of file
@@ -0,0 +1,188 @@
+#include "tests-base.hpp"
+
+#include "utf8rewind.h"
+
+#include "../helpers/helpers-strings.hpp"
+
+TEST(Utf8NormCmp, Identical)
+{
+	const char* l = "Caf\xC3\xA9";
+	int32_t errors = UTF8_ERR_NONE;
+
+	EXPECT_EQ(0, utf8normcmp(l, strlen(l), l, strlen(l), 0, &errors));
+	EXPECT_ERROREQ(UTF8_ERR_NONE, errors);
+}
+
+TEST(Utf8NormCmp, ComposedAndDecomposed)
+{
+	const char* l = "Caf\xC3\xA9";
+	const char* r = "Cafe\xCC\x81";
+	int32_t errors = UTF8_ERR_NONE;
+
+	EXPECT_EQ(0, utf8normcmp(l, strlen(l), r, strlen(r), 0, &errors));
+	EXPECT_EQ(0, utf8normcmp(r, strlen(r), l, strlen(l), 0, &errors));
+	EXPECT_ERROREQ(UTF8_ERR_NONE, errors);
+}
+
+TEST(Utf8NormCmp, Singleton)
+{
+	// ANGSTROM SIGN and LATIN CAPITAL LETTER A WITH RING ABOVE
+
+	const char* l = "\xE2\x84\xAB";
+	const char* r = "\xC3\x85";
+	int32_t errors = UTF8_ERR_NONE;
+
+	EXPECT_EQ(0, utf8normcmp(l, strlen(l), r, strlen(r), 0, &errors));
+	EXPECT_ERROREQ(UTF8_ERR_NONE, errors);
+}
+
+TEST(Utf8NormCmp, CanonicalOrder)
+{
+	/*
+		U+0061 U+0301 U+0316
+		     0    230    220
+
+		U+0061 U+0316 U+0301
+		     0    220    230
+	*/
+
+	const char* l = "a\xCC\x81\xCC\x96";
+	const char* r = "a\xCC\x96\xCC\x81";
+	int32_t errors = UTF8_ERR_NONE;
+
+	EXPECT_EQ(0, utf8normcmp(l, strlen(l), r, strlen(r), 0, &errors));
+	EXPECT_ERROREQ(UTF8_ERR_NONE, errors);
+}
+
+TEST(Utf8NormCmp, DifferenceInSequence)
+{
+	// The common prefix ends inside LATIN SMALL LETTER A WITH ACUTE
+
+	const char* l = "na\xC3\xA1" "b";
+	const char* r = "na\xC3\xA0" "b";
+	int32_t errors = UTF8_ERR_NONE;
+
+	EXPECT_LT(0, utf8normcmp(l, strlen(l), r, strlen(r), 0, &errors));
+	EXPECT_GT(0, utf8normcmp(r, strlen(r), l, strlen(l), 0, &errors));
+	EXPECT_ERROREQ(UTF8_ERR_NONE, errors);
+}
+
+TEST(Utf8NormCmp, DifferenceAfterStarter)
+{
+	// The common prefix ends before COMBINING DOT BELOW, which is reordered
+
+	const char* l = "a\xCC\x81\xCC\xA3";
+	const char* r = "a\xCC\x81";
+	int32_t errors = UTF8_ERR_NONE;
+
+	EXPECT_LT(0, utf8normcmp(l, strlen(l), r, strlen(r), 0, &errors));
+	EXPECT_EQ(0, utf8normcmp(l, strlen(l), "a\xCC\xA3\xCC\x81", 5, 0, &errors));
+	EXPECT_ERROREQ(UTF8_ERR_NONE, errors);
+}
+
+TEST(Utf8NormCmp, Less)
+{
+	const char* l = "apple";
+	const char* r = "banana";
+	int32_t errors = UTF8_ERR_NONE;
+
+	EXPECT_GT(0, utf8normcmp(l, strlen(l), r, strlen(r), 0, &errors));
+	EXPECT_ERROREQ(UTF8_ERR_NONE, errors);
+}
+
+TEST(Utf8NormCmp, Greater)
+{
+	const char* l = "zebra";
+	const char* r = "yak";
+	int32_t errors = UTF8_ERR_NONE;
+
+	EXPECT_LT(0, utf8normcmp(l, strlen(l), r, strlen(r), 0, &errors));
+	EXPECT_ERROREQ(UTF8_ERR_NONE, errors);
+}
+
+TEST(Utf8NormCmp, OrderedByDecomposedCodePoint)
+{
+	// LATIN CAPITAL LETTER E WITH ACUTE is decomposed to U+0045 U+0301
+
+	const char* l = "\xC3\x89";
+	const char* r = "F";
+	int32_t errors = UTF8_ERR_NONE;
+
+	EXPECT_GT(0, utf8normcmp(l, strlen(l), r, strlen(r), 0, &errors));
+	EXPECT_ERROREQ(UTF8_ERR_NONE, errors);
+}
+
+TEST(Utf8NormCmp, Prefix)
+{
+	const char* l = "Cafe";
+	const char* r = "Caf\xC3\xA9";
+	int32_t errors = UTF8_ERR_NONE;
+
+	EXPECT_GT(0, utf8normcmp(l, strlen(l), r, strlen(r), 0, &errors));
+	EXPECT_LT(0, utf8normcmp(r, strlen(r), l, strlen(l), 0, &errors));
+	EXPECT_ERROREQ(UTF8_ERR_NONE, errors);
+}
+
+TEST(Utf8NormCmp, Compatibility)
+{
+	// LATIN SMALL LIGATURE FI
+
+	const char* l = "\xEF\xAC\x81" "ne";
+	const char* r = "fine";
+	int32_t errors = UTF8_ERR_NONE;
+
+	EXPECT_NE(0, utf8normcmp(l, strlen(l), r, strlen(r), 0, &errors));
+	EXPECT_EQ(0, utf8normcmp(l, strlen(l), r, strlen(r), UTF8_NORMALIZE_COMPATIBILITY, &errors));
+	EXPECT_ERROREQ(UTF8_ERR_NONE, errors);
+}
+
+TEST(Utf8NormCmp, CaseFold)
+{
+	const char* l = "\xEF\xAC\x81" "NE Stra\xC3\x9F" "e";
+	const char* r = "fine STRASSE";
+	int32_t errors = UTF8_ERR_NONE;
+
+	EXPECT_NE(0, utf8normcmp(l, strlen(l), r, strlen(r), UTF8_NORMALIZE_COMPATIBILITY, &errors));
+	EXPECT_EQ(0, utf8normcmp(l, strlen(l), r, strlen(r), UTF8_NORMALIZE_COMPATIBILITY | UTF8_NORMALIZE_CASEFOLD, &errors));
+	EXPECT_ERROREQ(UTF8_ERR_NONE, errors);
+}
+
+TEST(Utf8NormCmp, InvalidData)
+{
+	const char* l = "ab\xFF";
+	const char* r = "ab\xEF\xBF\xBD";
+	int32_t errors = UTF8_ERR_NONE;
+
+	EXPECT_EQ(0, utf8normcmp(l, strlen(l), r, strlen(r), 0, &errors));
+	EXPECT_ERROREQ(UTF8_ERR_NONE, errors);
+}
+
+TEST(Utf8NormCmp, Empty)
+{
+	const char* l = "";
+	const char* r = "a";
+	int32_t errors = UTF8_ERR_NONE;
+
+	EXPECT_EQ(0, utf8normcmp(l, 0, l, 0, 0, &errors));
+	EXPECT_GT(0, utf8normcmp(l, 0, r, 1, 0, &errors));
+	EXPECT_ERROREQ(UTF8_ERR_NONE, errors);
+}
+
+TEST(Utf8NormCmp, InputNull)
+{
+	int32_t errors = UTF8_ERR_NONE;
+
+	EXPECT_EQ(0, utf8normcmp(nullptr, 1, "a", 1, 0, &errors));
+	EXPECT_ERROREQ(UTF8_ERR_INVALID_DATA, errors);
+}
+
+TEST(Utf8NormCmp, InvalidFlag)
+{
+	int32_t errors = UTF8_ERR_NONE;
+
+	EXPECT_EQ(0, utf8normcmp("a", 1, "b", 1, UTF8_NORMALIZE_COMPOSE, &errors));
+	EXPECT_ERROREQ(UTF8_ERR_INVALID_FLAG, errors);
+
+	EXPECT_EQ(0, utf8normcmp("a", 1, "b", 1, UTF8_NORMALIZE_CASEFOLD, &errors));
+	EXPECT_ERROREQ(UTF8_ERR_INVALID_FLAG, errors);
+}
\ No newline at end of file
@@ -0,0 +1,242 @@
+#include "tests-base.hpp"
+
+#include "utf8rewind.h"
+
+#include "../helpers/helpers-strings.hpp"
+
+TEST(Utf8NormSearch, BasicLatin)
+{
+	const char* i = "The quick brown fox";
+	const char* n = "brown";
+	size_t ms = 0;
+	int32_t errors = UTF8_ERR_NONE;
+
+	EXPECT_EQ(i + 10, utf8normsearch(i, strlen(i), n, strlen(n), 0, &ms, &errors));
+	EXPECT_EQ(5, ms);
+	EXPECT_ERROREQ(UTF8_ERR_NONE, errors);
+}
+
+TEST(Utf8NormSearch, NotFound)
+{
+	const char* i = "The quick brown fox";
+	const char* n = "Brown";
+	size_t ms = 7;
+	int32_t errors = UTF8_ERR_NONE;
+
+	EXPECT_EQ(nullptr, utf8normsearch(i, strlen(i), n, strlen(n), 0, &ms, &errors));
+	EXPECT_EQ(7, ms);
+	EXPECT_ERROREQ(UTF8_ERR_NONE, errors);
+}
+
+TEST(Utf8NormSearch, DecomposedInComposed)
+{
+	const char* i = "Un caf\xC3\xA9 cr\xC3\xA8me";
+	const char* n = "cafe\xCC\x81";
+	size_t ms = 0;
+	int32_t errors = UTF8_ERR_NONE;
+
+	EXPECT_EQ(i + 3, utf8normsearch(i, strlen(i), n, strlen(n), 0, &ms, &errors));
+	EXPECT_EQ(5, ms);
+	EXPECT_ERROREQ(UTF8_ERR_NONE, errors);
+}
+
+TEST(Utf8NormSearch, ComposedInDecomposed)
+{
+	const char* i = "Un cafe\xCC\x81 cre\xCC\x80me";
+	const char* n = "cr\xC3\xA8me";
+	size_t ms = 0;
+	int32_t errors = UTF8_ERR_NONE;
+
+	EXPECT_EQ(i + 10, utf8normsearch(i, strlen(i), n, strlen(n), 0, &ms, &errors));
+	EXPECT_EQ(7, ms);
+	EXPECT_ERROREQ(UTF8_ERR_NONE, errors);
+}
+
+TEST(Utf8NormSearch, Singleton)
+{
+	// ANGSTROM SIGN and LATIN CAPITAL LETTER A WITH RING ABOVE
+
+	const char* i = "10 \xE2\x84\xAB";
+	const char* n = "\xC3\x85";
+	size_t ms = 0;
+	int32_t errors = UTF8_ERR_NONE;
+
+	EXPECT_EQ(i + 3, utf8normsearch(i, strlen(i), n, strlen(n), 0, &ms, &errors));
+	EXPECT_EQ(3, ms);
+	EXPECT_ERROREQ(UTF8_ERR_NONE, errors);
+}
+
+TEST(Utf8NormSearch, CanonicalOrder)
+{
+	/*
+		U+0061 U+0301 U+0316
+		     0    230    220
+
+		U+0061 U+0316 U+0301
+		     0    220    230
+	*/
+
+	const char* i = "xa\xCC\x81\xCC\x96y";
+	const char* n = "a\xCC\x96\xCC\x81y";
+	size_t ms = 0;
+	int32_t errors = UTF8_ERR_NONE;
+
+	EXPECT_EQ(i + 1, utf8normsearch(i, strlen(i), n, strlen(n), 0, &ms, &errors));
+	EXPECT_EQ(6, ms);
+	EXPECT_ERROREQ(UTF8_ERR_NONE, errors);
+}
+
+TEST(Utf8NormSearch, PartOfDecomposition)
+{
+	// The needle cannot match a part of LATIN SMALL LETTER E WITH ACUTE
+
+	const char* i = "caf\xC3\xA9";
+	const char* n = "cafe";
+	int32_t errors = UTF8_ERR_NONE;
+
+	EXPECT_EQ(nullptr, utf8normsearch(i, strlen(i), n, strlen(n), 0, nullptr, &errors));
+	EXPECT_ERROREQ(UTF8_ERR_NONE, errors);
+}
+
+TEST(Utf8NormSearch, PartOfSequence)
+{
+	// The needle cannot match a part of a sequence of combining marks
+
+	const char* i = "e\xCC\x81\xCC\x83";
+	const char* n = "\xC3\xA9";
+	const char* x = "\xC3\xA9\xCC\x83";
+	size_t ms = 0;
+	int32_t errors = UTF8_ERR_NONE;
+
+	EXPECT_EQ(nullptr, utf8normsearch(i, strlen(i), n, strlen(n), 0, &ms, &errors));
+	EXPECT_EQ(i, utf8normsearch(i, strlen(i), x, strlen(x), 0, &ms, &errors));
+	EXPECT_EQ(5, ms);
+	EXPECT_ERROREQ(UTF8_ERR_NONE, errors);
+}
+
+TEST(Utf8NormSearch, Hangul)
+{
+	const char* i = "\xED\x95\x9C\xEA\xB5\xAD\xEC\x96\xB4";
+	const char* n = "\xE1\x84\x80\xE1\x85\xAE\xE1\x86\xA8";
+	size_t ms = 0;
+	int32_t errors = UTF8_ERR_NONE;
+
+	EXPECT_EQ(i + 3, utf8normsearch(i, strlen(i), n, strlen(n), 0, &ms, &errors));
+	EXPECT_EQ(3, ms);
+	EXPECT_ERROREQ(UTF8_ERR_NONE, errors);
+}
+
+TEST(Utf8NormSearch, Compatibility)
+{
+	// LATIN SMALL LIGATURE FI
+
+	const char* i = "A \xEF\xAC\x81le";
+	const char* n = "file";
+	size_t ms = 0;
+	int32_t errors = UTF8_ERR_NONE;
+
+	EXPECT_EQ(nullptr, utf8normsearch(i, strlen(i), n, strlen(n), 0, &ms, &errors));
+	EXPECT_EQ(i + 2, utf8normsearch(i, strlen(i), n, strlen(n), UTF8_NORMALIZE_COMPATIBILITY, &ms, &errors));
+	EXPECT_EQ(5, ms);
+	EXPECT_ERROREQ(UTF8_ERR_NONE, errors);
+}
+
+TEST(Utf8NormSearch, CaseFold)
+{
+	const char* i = "Welcome to the CAF\xC3\x89";
+	const char* n = "cafe\xCC\x81";
+	size_t ms = 0;
+	int32_t errors = UTF8_ERR_NONE;
+
+	EXPECT_EQ(i + 15, utf8normsearch(i, strlen(i), n, strlen(n), UTF8_NORMALIZE_COMPATIBILITY | UTF8_NORMALIZE_CASEFOLD, &ms, &errors));
+	EXPECT_EQ(5, ms);
+	EXPECT_ERROREQ(UTF8_ERR_NONE, errors);
+}
+
+TEST(Utf8NormSearch, LongNeedle)
+{
+	std::string i = "Prefix ";
+	std::string n;
+
+	for (size_t k = 0; k < 20; ++k)
+	{
+		i += "\xC3\xA9\xC3\xA0";
+		n += "e\xCC\x81" "a\xCC\x80";
+	}
+
+	i += " suffix";
+
+	size_t ms = 0;
+	int32_t errors = UTF8_ERR_NONE;
+
+	EXPECT_EQ(i.c_str() + 7, utf8normsearch(i.c_str(), i.length(), n.c_str(), n.length(), 0, &ms, &errors));
+	EXPECT_EQ(80, ms);
+	EXPECT_ERROREQ(UTF8_ERR_NONE, errors);
+}
+
+TEST(Utf8NormSearch, MultipleMatches)
+{
+	const char* i = "\xC3\xA9t\xC3\xA9 e\xCC\x81t\xC3\xA9";
+	const char* n = "\xC3\xA9";
+	const char* s = i;
+	const char* s_end = i + strlen(i);
+	const char* m;
+	size_t ms = 0;
+	size_t count = 0;
+	int32_t errors = UTF8_ERR_NONE;
+
+	while ((m = utf8normsearch(s, s_end - s, n, strlen(n), 0, &ms, &errors)) != nullptr)
+	{
+		count++;
+		s = m + ms;
+	}
+
+	EXPECT_EQ(4, count);
+	EXPECT_ERROREQ(UTF8_ERR_NONE, errors);
+}
+
+TEST(Utf8NormSearch, EmptyNeedle)
+{
+	const char* i = "abc";
+	size_t ms = 7;
+	int32_t errors = UTF8_ERR_NONE;
+
+	EXPECT_EQ(i, utf8normsearch(i, strlen(i), "", 0, 0, &ms, &errors));
+	EXPECT_EQ(0, ms);
+	EXPECT_ERROREQ(UTF8_ERR_NONE, errors);
+}
+
+TEST(Utf8NormSearch, EmptyInput)
+{
+	int32_t errors = UTF8_ERR_NONE;
+
+	EXPECT_EQ(nullptr, utf8normsearch("", 0, "a", 1, 0, nullptr, &errors));
+	EXPECT_ERROREQ(UTF8_ERR_NONE, errors);
+}
+
+TEST(Utf8NormSearch, InputNull)
+{
+	int32_t errors = UTF8_ERR_NONE;
+
+	EXPECT_EQ(nullptr, utf8normsearch(nullptr, 1, "a", 1, 0, nullptr, &errors));
+	EXPECT_ERROREQ(UTF8_ERR_INVALID_DATA, errors);
+}
+
+TEST(Utf8NormSearch, NeedleNull)
+{
+	int32_t errors = UTF8_ERR_NONE;
+
+	EXPECT_EQ(nullptr, utf8normsearch("a", 1, nullptr, 1, 0, nullptr, &errors));
+	EXPECT_ERROREQ(UTF8_ERR_INVALID_DATA, errors);
+}
+
+TEST(Utf8NormSearch, InvalidFlag)
+{
+	int32_t errors = UTF8_ERR_NONE;
+
+	EXPECT_EQ(nullptr, utf8normsearch("a", 1, "a", 1, UTF8_NORMALIZE_CASEFOLD, nullptr, &errors));
+	EXPECT_ERROREQ(UTF8_ERR_INVALID_FLAG, errors);
+
+	EXPECT_EQ(nullptr, utf8normsearch("a", 1, "a", 1, UTF8_NORMALIZE_COMPOSE, nullptr, &errors));
+	EXPECT_ERROREQ(UTF8_ERR_INVALID_FLAG, errors);
+}
\ No newline at end of file
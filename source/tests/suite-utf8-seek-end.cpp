@@ -1154,6 +1154,45 @@ TEST(Utf8SeekEnd, TextEndsInMiddle)
 	EXPECT_SEEKEQ(t, 0, 13, strlen(t), 0, 2, SEEK_END);
 }
 
+TEST(Utf8SeekEnd, TextLongBasicLatin)
+{
+	const char* t = "Lorem ipsum dolor sit amet, consectetur";
+
+	EXPECT_SEEKEQ(t, 38, strlen(t), strlen(t), 0, 1, SEEK_END);
+	EXPECT_SEEKEQ(t, 31, strlen(t), strlen(t), 0, 8, SEEK_END);
+	EXPECT_SEEKEQ(t, 30, strlen(t), strlen(t), 0, 9, SEEK_END);
+	EXPECT_SEEKEQ(t, 22, strlen(t), strlen(t), 0, 17, SEEK_END);
+	EXPECT_SEEKEQ(t, 1, strlen(t), strlen(t), 0, 38, SEEK_END);
+	EXPECT_SEEKEQ(t, 0, strlen(t), strlen(t), 0, 39, SEEK_END);
+}
+
+TEST(Utf8SeekEnd, TextLongMultiByte)
+{
+	const char* t = "\xCE\x93\xCE\xB1\xCE\xB6\xCE\xAD\xCE\xB5\xCF\x82 \xCE\xBA\xCE\xB1\xE1\xBD\xB6 \xCE\xBC\xCF\x85\xCF\x81\xCF\x84\xCE\xB9\xE1\xBD\xB2\xCF\x82";
+
+	EXPECT_SEEKEQ(t, 34, strlen(t), strlen(t), 0, 1, SEEK_END);
+	EXPECT_SEEKEQ(t, 31, strlen(t), strlen(t), 0, 2, SEEK_END);
+	EXPECT_SEEKEQ(t, 20, strlen(t), strlen(t), 0, 8, SEEK_END);
+	EXPECT_SEEKEQ(t, 17, strlen(t), strlen(t), 0, 9, SEEK_END);
+	EXPECT_SEEKEQ(t, 12, strlen(t), strlen(t), 0, 12, SEEK_END);
+	EXPECT_SEEKEQ(t, 2, strlen(t), strlen(t), 0, 17, SEEK_END);
+	EXPECT_SEEKEQ(t, 0, strlen(t), strlen(t), 0, 18, SEEK_END);
+}
+
+TEST(Utf8SeekEnd, TextLongInvalid)
+{
+	const char* t = "abcdefghijk\xE0\xA4\xA4\xA4lmnopqrstu\xC3vwxyz\xF0\x9F\x98";
+
+	EXPECT_SEEKEQ(t, 31, strlen(t), strlen(t), 0, 1, SEEK_END);
+	EXPECT_SEEKEQ(t, 30, strlen(t), strlen(t), 0, 2, SEEK_END);
+	EXPECT_SEEKEQ(t, 25, strlen(t), strlen(t), 0, 7, SEEK_END);
+	EXPECT_SEEKEQ(t, 15, strlen(t), strlen(t), 0, 17, SEEK_END);
+	EXPECT_SEEKEQ(t, 14, strlen(t), strlen(t), 0, 18, SEEK_END);
+	EXPECT_SEEKEQ(t, 11, strlen(t), strlen(t), 0, 19, SEEK_END);
+	EXPECT_SEEKEQ(t, 10, strlen(t), strlen(t), 0, 20, SEEK_END);
+	EXPECT_SEEKEQ(t, 0, strlen(t), strlen(t), 0, 30, SEEK_END);
+}
+
 TEST(Utf8SeekEnd, TextZeroOffset)
 {
 	const char* t = "\xE2\xB7\xB0\xE2\xB8\x97\xE2\xB8\xBA\xE2\xB8\xAF\xE2\xB9\x8F";
@@ -0,0 +1,310 @@
+#include "tests-base.hpp"
+
+#include "utf8rewind.h"
+
+#include "../helpers/helpers-strings.hpp"
+
+TEST(Utf8SeekIndex, InitInvalidInterval)
+{
+	size_t o[8] = { 0 };
+	utf8seekindex_t index;
+	int32_t errors = UTF8_ERR_NONE;
+
+	EXPECT_EQ(0, utf8seekindexinit(&index, 0, o, 8, &errors));
+	EXPECT_ERROREQ(UTF8_ERR_INVALID_DATA, errors);
+}
+
+TEST(Utf8SeekIndex, InitOffsetsNull)
+{
+	utf8seekindex_t index;
+	int32_t errors = UTF8_ERR_NONE;
+
+	EXPECT_EQ(0, utf8seekindexinit(&index, 4, nullptr, 8, &errors));
+	EXPECT_ERROREQ(UTF8_ERR_INVALID_DATA, errors);
+}
+
+TEST(Utf8SeekIndex, Append)
+{
+	const char* t = "\xD0\x9F\xD1\x80\xD0\xB8\xD0\xB2\xD0\xB5\xD1\x82 \xE4\xB8\xAD\xE6\x96\x87";
+	size_t o[8] = { 0 };
+	utf8seekindex_t index;
+	int32_t errors = UTF8_ERR_NONE;
+
+	EXPECT_EQ(1, utf8seekindexinit(&index, 3, o, 8, &errors));
+	EXPECT_ERROREQ(UTF8_ERR_NONE, errors);
+
+	EXPECT_EQ(9, utf8seekindexappend(&index, t, strlen(t), &errors));
+	EXPECT_ERROREQ(UTF8_ERR_NONE, errors);
+	EXPECT_EQ(3, index.count);
+	EXPECT_EQ(0, o[0]);
+	EXPECT_EQ(6, o[1]);
+	EXPECT_EQ(12, o[2]);
+}
+
+TEST(Utf8SeekIndex, AppendSplitSequence)
+{
+	const char* t = "ab\xE4\xB8\xAD" "cd";
+	size_t o[8] = { 0 };
+	utf8seekindex_t index;
+	int32_t errors = UTF8_ERR_NONE;
+
+	EXPECT_EQ(1, utf8seekindexinit(&index, 2, o, 8, &errors));
+
+	EXPECT_EQ(2, utf8seekindexappend(&index, t, 4, &errors));
+	EXPECT_ERROREQ(UTF8_ERR_NONE, errors);
+	EXPECT_EQ(3, utf8seekindexappend(&index, t, 5, &errors));
+	EXPECT_ERROREQ(UTF8_ERR_NONE, errors);
+	EXPECT_EQ(5, utf8seekindexappend(&index, t, strlen(t), &errors));
+	EXPECT_ERROREQ(UTF8_ERR_NONE, errors);
+	EXPECT_EQ(3, index.count);
+	EXPECT_EQ(0, o[0]);
+	EXPECT_EQ(2, o[1]);
+	EXPECT_EQ(6, o[2]);
+}
+
+TEST(Utf8SeekIndex, AppendTextShorter)
+{
+	const char* t = "abcdef";
+	size_t o[8] = { 0 };
+	utf8seekindex_t index;
+	int32_t errors = UTF8_ERR_NONE;
+
+	EXPECT_EQ(1, utf8seekindexinit(&index, 2, o, 8, &errors));
+	EXPECT_EQ(6, utf8seekindexappend(&index, t, 6, &errors));
+
+	EXPECT_EQ(6, utf8seekindexappend(&index, t, 3, &errors));
+	EXPECT_ERROREQ(UTF8_ERR_INVALID_DATA, errors);
+}
+
+TEST(Utf8SeekIndex, AppendNotEnoughSpace)
+{
+	const char* t = "abcdefghij";
+	size_t o[2] = { 0 };
+	utf8seekindex_t index;
+	int32_t errors = UTF8_ERR_NONE;
+
+	EXPECT_EQ(1, utf8seekindexinit(&index, 3, o, 2, &errors));
+
+	EXPECT_EQ(6, utf8seekindexappend(&index, t, strlen(t), &errors));
+	EXPECT_ERROREQ(UTF8_ERR_NOT_ENOUGH_SPACE, errors);
+	EXPECT_EQ(2, index.count);
+
+	EXPECT_EQ(t + 9, utf8seekindexed(&index, t, strlen(t), t, 9, SEEK_SET));
+	EXPECT_EQ(t + 8, utf8seekindexed(&index, t, strlen(t), t, 2, SEEK_END));
+}
+
+TEST(Utf8SeekIndex, AppendIndexNotInitialized)
+{
+	utf8seekindex_t index = { 0 };
+	int32_t errors = UTF8_ERR_NONE;
+
+	EXPECT_EQ(0, utf8seekindexappend(&index, "abc", 3, &errors));
+	EXPECT_ERROREQ(UTF8_ERR_INVALID_DATA, errors);
+}
+
+TEST(Utf8SeekIndex, SeekSet)
+{
+	const char* t = "Fri\xC3\xB0" "rik \xE4\xB8\xAD\xE6\x96\x87 \xF0\x9F\x98\x80!";
+	size_t ts = strlen(t);
+	size_t o[8] = { 0 };
+	utf8seekindex_t index;
+	int32_t errors = UTF8_ERR_NONE;
+
+	EXPECT_EQ(1, utf8seekindexinit(&index, 4, o, 8, &errors));
+	EXPECT_EQ(13, utf8seekindexappend(&index, t, ts, &errors));
+
+	for (off_t k = -2; k < 16; ++k)
+	{
+		EXPECT_EQ(utf8seek(t, ts, t, k, SEEK_SET), utf8seekindexed(&index, t, ts, t, k, SEEK_SET));
+	}
+
+	EXPECT_UTF8EQ("\xE4\xB8\xAD\xE6\x96\x87 \xF0\x9F\x98\x80!", utf8seekindexed(&index, t, ts, t, 8, SEEK_SET));
+}
+
+TEST(Utf8SeekIndex, SeekCurrent)
+{
+	const char* t = "Fri\xC3\xB0" "rik \xE4\xB8\xAD\xE6\x96\x87 \xF0\x9F\x98\x80!";
+	size_t ts = strlen(t);
+	size_t o[8] = { 0 };
+	utf8seekindex_t index;
+	int32_t errors = UTF8_ERR_NONE;
+
+	EXPECT_EQ(1, utf8seekindexinit(&index, 4, o, 8, &errors));
+	EXPECT_EQ(13, utf8seekindexappend(&index, t, ts, &errors));
+
+	const char* c = t + 9;
+
+	for (off_t k = -12; k < 8; ++k)
+	{
+		EXPECT_EQ(utf8seek(c, ts, t, k, SEEK_CUR), utf8seekindexed(&index, c, ts, t, k, SEEK_CUR));
+	}
+
+	EXPECT_UTF8EQ("\xE6\x96\x87 \xF0\x9F\x98\x80!", utf8seekindexed(&index, c, ts, t, 1, SEEK_CUR));
+	EXPECT_UTF8EQ("rik \xE4\xB8\xAD\xE6\x96\x87 \xF0\x9F\x98\x80!", utf8seekindexed(&index, c, ts, t, -4, SEEK_CUR));
+}
+
+TEST(Utf8SeekIndex, SeekEnd)
+{
+	const char* t = "Fri\xC3\xB0" "rik \xE4\xB8\xAD\xE6\x96\x87 \xF0\x9F\x98\x80!";
+	size_t ts = strlen(t);
+	size_t o[8] = { 0 };
+	utf8seekindex_t index;
+	int32_t errors = UTF8_ERR_NONE;
+
+	EXPECT_EQ(1, utf8seekindexinit(&index, 4, o, 8, &errors));
+	EXPECT_EQ(13, utf8seekindexappend(&index, t, ts, &errors));
+
+	for (off_t k = -2; k < 16; ++k)
+	{
+		EXPECT_EQ(utf8seek(t, ts, t, k, SEEK_END), utf8seekindexed(&index, t, ts, t, k, SEEK_END));
+	}
+
+	EXPECT_UTF8EQ("\xF0\x9F\x98\x80!", utf8seekindexed(&index, t, ts, t, 2, SEEK_END));
+}
+
+TEST(Utf8SeekIndex, SeekInvalidData)
+{
+	const char* t = "a\xE4\xB8" "b\xFF" "c\xC3\xB0";
+	size_t ts = strlen(t);
+	size_t o[8] = { 0 };
+	utf8seekindex_t index;
+	int32_t errors = UTF8_ERR_NONE;
+
+	EXPECT_EQ(1, utf8seekindexinit(&index, 2, o, 8, &errors));
+	EXPECT_EQ(6, utf8seekindexappend(&index, t, ts, &errors));
+
+	for (off_t k = 0; k < 8; ++k)
+	{
+		EXPECT_EQ(utf8seek(t, ts, t, k, SEEK_SET), utf8seekindexed(&index, t, ts, t, k, SEEK_SET));
+	}
+}
+
+TEST(Utf8SeekIndex, SeekIndexNull)
+{
+	const char* t = "\xE4\xB8\xAD\xE6\x96\x87";
+	size_t ts = strlen(t);
+
+	EXPECT_EQ(t + 3, utf8seekindexed(nullptr, t, ts, t, 1, SEEK_SET));
+}
+
+TEST(Utf8SeekIndex, SeekLongText)
+{
+	std::string t;
+
+	for (size_t k = 0; k < 1000; ++k)
+	{
+		t += "a\xC3\xA9\xE4\xB8\xAD\xF0\x9F\x98\x80";
+	}
+
+	size_t o[64] = { 0 };
+	utf8seekindex_t index;
+	int32_t errors = UTF8_ERR_NONE;
+
+	EXPECT_EQ(1, utf8seekindexinit(&index, 100, o, 64, &errors));
+	EXPECT_EQ(4000, utf8seekindexappend(&index, t.c_str(), t.length(), &errors));
+	EXPECT_ERROREQ(UTF8_ERR_NONE, errors);
+	EXPECT_EQ(40, index.count);
+
+	for (off_t k = 0; k < 4000; k += 37)
+	{
+		EXPECT_EQ(t.c_str() + (k / 4) * 10 + ((k % 4 == 0) ? 0 : (k % 4 == 1) ? 1 : (k % 4 == 2) ? 3 : 6), utf8seekindexed(&index, t.c_str(), t.length(), t.c_str(), k, SEEK_SET));
+	}
+}
+
+TEST(Utf8SeekIndex, SaveLoad)
+{
+	const char* t = "\xD0\x9F\xD1\x80\xD0\xB8\xD0\xB2\xD0\xB5\xD1\x82 \xE4\xB8\xAD\xE6\x96\x87";
+	size_t ts = strlen(t);
+	size_t o[8] = { 0 };
+	utf8seekindex_t index;
+	int32_t errors = UTF8_ERR_NONE;
+
+	EXPECT_EQ(1, utf8seekindexinit(&index, 3, o, 8, &errors));
+	EXPECT_EQ(9, utf8seekindexappend(&index, t, ts, &errors));
+
+	EXPECT_EQ(56, utf8seekindexsave(&index, nullptr, 0, &errors));
+	EXPECT_ERROREQ(UTF8_ERR_NONE, errors);
+
+	char b[64] = { 0 };
+	EXPECT_EQ(56, utf8seekindexsave(&index, b, 64, &errors));
+	EXPECT_ERROREQ(UTF8_ERR_NONE, errors);
+	EXPECT_EQ(3, b[0]);
+	EXPECT_EQ(3, b[8]);
+	EXPECT_EQ(9, b[16]);
+	EXPECT_EQ(19, b[24]);
+	EXPECT_EQ(12, b[48]);
+
+	size_t lo[4] = { 0 };
+	utf8seekindex_t loaded;
+
+	EXPECT_EQ(1, utf8seekindexload(&loaded, b, 56, lo, 4, &errors));
+	EXPECT_ERROREQ(UTF8_ERR_NONE, errors);
+	EXPECT_EQ(3, loaded.count);
+	EXPECT_EQ(9, loaded.length);
+	EXPECT_EQ(0, lo[0]);
+	EXPECT_EQ(6, lo[1]);
+	EXPECT_EQ(12, lo[2]);
+	EXPECT_UTF8EQ("\xE6\x96\x87", utf8seekindexed(&loaded, t, ts, t, 8, SEEK_SET));
+}
+
+TEST(Utf8SeekIndex, SaveNotEnoughSpace)
+{
+	size_t o[8] = { 0 };
+	utf8seekindex_t index;
+	int32_t errors = UTF8_ERR_NONE;
+
+	EXPECT_EQ(1, utf8seekindexinit(&index, 2, o, 8, &errors));
+	EXPECT_EQ(4, utf8seekindexappend(&index, "abcd", 4, &errors));
+
+	char b[47] = { 0 };
+	EXPECT_EQ(0, utf8seekindexsave(&index, b, 47, &errors));
+	EXPECT_ERROREQ(UTF8_ERR_NOT_ENOUGH_SPACE, errors);
+}
+
+TEST(Utf8SeekIndex, LoadNotEnoughSpace)
+{
+	size_t o[8] = { 0 };
+	utf8seekindex_t index;
+	int32_t errors = UTF8_ERR_NONE;
+
+	EXPECT_EQ(1, utf8seekindexinit(&index, 2, o, 8, &errors));
+	EXPECT_EQ(6, utf8seekindexappend(&index, "abcdef", 6, &errors));
+
+	char b[64] = { 0 };
+	EXPECT_EQ(56, utf8seekindexsave(&index, b, 64, &errors));
+
+	size_t lo[2] = { 0 };
+	utf8seekindex_t loaded;
+
+	EXPECT_EQ(0, utf8seekindexload(&loaded, b, 56, lo, 2, &errors));
+	EXPECT_ERROREQ(UTF8_ERR_NOT_ENOUGH_SPACE, errors);
+}
+
+TEST(Utf8SeekIndex, LoadInvalidData)
+{
+	size_t o[8] = { 0 };
+	utf8seekindex_t index;
+	int32_t errors = UTF8_ERR_NONE;
+
+	EXPECT_EQ(1, utf8seekindexinit(&index, 2, o, 8, &errors));
+	EXPECT_EQ(6, utf8seekindexappend(&index, "abcdef", 6, &errors));
+
+	char b[64] = { 0 };
+	EXPECT_EQ(56, utf8seekindexsave(&index, b, 64, &errors));
+
+	size_t lo[8] = { 0 };
+	utf8seekindex_t loaded;
+
+	EXPECT_EQ(0, utf8seekindexload(&loaded, b, 55, lo, 8, &errors));
+	EXPECT_ERROREQ(UTF8_ERR_INVALID_DATA, errors);
+
+	b[0] = 0;
+	EXPECT_EQ(0, utf8seekindexload(&loaded, b, 56, lo, 8, &errors));
+	EXPECT_ERROREQ(UTF8_ERR_INVALID_DATA, errors);
+
+	b[0] = 2;
+	b[48] = 1;
+	EXPECT_EQ(0, utf8seekindexload(&loaded, b, 56, lo, 8, &errors));
+	EXPECT_ERROREQ(UTF8_ERR_INVALID_DATA, errors);
+	EXPECT_EQ(0, loaded.count);
+}
\ No newline at end of file
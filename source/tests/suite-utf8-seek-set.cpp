@@ -1160,6 +1160,43 @@ TEST(Utf8SeekSet, TextEndsInMiddle)
 	EXPECT_SEEKEQ(t, 6, strlen(t), strlen(t), 0, 5, SEEK_SET);
 }
 
+TEST(Utf8SeekSet, TextLongBasicLatin)
+{
+	const char* t = "Lorem ipsum dolor sit amet, consectetur";
+
+	EXPECT_SEEKEQ(t, 1, strlen(t), strlen(t), 0, 1, SEEK_SET);
+	EXPECT_SEEKEQ(t, 8, strlen(t), strlen(t), 0, 8, SEEK_SET);
+	EXPECT_SEEKEQ(t, 9, strlen(t), strlen(t), 0, 9, SEEK_SET);
+	EXPECT_SEEKEQ(t, 17, strlen(t), strlen(t), 0, 17, SEEK_SET);
+	EXPECT_SEEKEQ(t, 38, strlen(t), strlen(t), 0, 38, SEEK_SET);
+	EXPECT_SEEKEQ(t, 39, strlen(t), strlen(t), 0, 39, SEEK_SET);
+}
+
+TEST(Utf8SeekSet, TextLongMultiByte)
+{
+	const char* t = "\xCE\x93\xCE\xB1\xCE\xB6\xCE\xAD\xCE\xB5\xCF\x82 \xCE\xBA\xCE\xB1\xE1\xBD\xB6 \xCE\xBC\xCF\x85\xCF\x81\xCF\x84\xCE\xB9\xE1\xBD\xB2\xCF\x82";
+
+	EXPECT_SEEKEQ(t, 2, strlen(t), strlen(t), 0, 1, SEEK_SET);
+	EXPECT_SEEKEQ(t, 12, strlen(t), strlen(t), 0, 6, SEEK_SET);
+	EXPECT_SEEKEQ(t, 13, strlen(t), strlen(t), 0, 7, SEEK_SET);
+	EXPECT_SEEKEQ(t, 20, strlen(t), strlen(t), 0, 10, SEEK_SET);
+	EXPECT_SEEKEQ(t, 34, strlen(t), strlen(t), 0, 17, SEEK_SET);
+	EXPECT_SEEKEQ(t, 36, strlen(t), strlen(t), 0, 18, SEEK_SET);
+}
+
+TEST(Utf8SeekSet, TextLongInvalid)
+{
+	const char* t = "abcdefghijk\xE0\xA4\xA4\xA4lmnopqrstu\xC3vwxyz\xF0\x9F\x98";
+
+	EXPECT_SEEKEQ(t, 8, strlen(t), strlen(t), 0, 8, SEEK_SET);
+	EXPECT_SEEKEQ(t, 11, strlen(t), strlen(t), 0, 11, SEEK_SET);
+	EXPECT_SEEKEQ(t, 14, strlen(t), strlen(t), 0, 12, SEEK_SET);
+	EXPECT_SEEKEQ(t, 15, strlen(t), strlen(t), 0, 13, SEEK_SET);
+	EXPECT_SEEKEQ(t, 23, strlen(t), strlen(t), 0, 21, SEEK_SET);
+	EXPECT_SEEKEQ(t, 31, strlen(t), strlen(t), 0, 29, SEEK_SET);
+	EXPECT_SEEKEQ(t, 34, strlen(t), strlen(t), 0, 30, SEEK_SET);
+}
+
 TEST(Utf8SeekSet, TextZeroOffset)
 {
 	const char* t = "Magic powered";
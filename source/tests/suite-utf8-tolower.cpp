@@ -140,6 +140,102 @@ TEST_F(Utf8ToLower, BasicLatinNotEnoughSpace)
 	EXPECT_ERROREQ(UTF8_ERR_NOT_ENOUGH_SPACE, errors);
 }
 
+TEST_F(Utf8ToLower, BasicLatinLongSentence)
+{
+	const char* c = "The Quick Brown Fox Jumps Over The Lazy Dog";
+	const size_t s = 255;
+	char b[256] = { 0 };
+	int32_t errors = UTF8_ERR_NONE;
+
+	EXPECT_EQ(43, utf8tolower(c, strlen(c), b, s, &errors));
+	EXPECT_UTF8EQ("the quick brown fox jumps over the lazy dog", b);
+	EXPECT_ERROREQ(UTF8_ERR_NONE, errors);
+}
+
+TEST_F(Utf8ToLower, BasicLatinLongNotEnoughSpace)
+{
+	const char* c = "The Quick Brown Fox Jumps Over The Lazy Dog";
+	const size_t s = 10;
+	char b[256] = { 0 };
+	int32_t errors = UTF8_ERR_NONE;
+
+	EXPECT_EQ(10, utf8tolower(c, strlen(c), b, s, &errors));
+	EXPECT_UTF8EQ("the quick ", b);
+	EXPECT_ERROREQ(UTF8_ERR_NOT_ENOUGH_SPACE, errors);
+}
+
+TEST_F(Utf8ToLower, LatinSupplementWord)
+{
+	const char* c = "\xC3\x80\xC3\x89\xC3\x8E\xC3\x95\xC3\x9C Gr\xC3\xB6\xC3\x9F" "e";
+	const size_t s = 255;
+	char b[256] = { 0 };
+	int32_t errors = UTF8_ERR_NONE;
+
+	EXPECT_EQ(18, utf8tolower(c, strlen(c), b, s, &errors));
+	EXPECT_UTF8EQ("\xC3\xA0\xC3\xA9\xC3\xAE\xC3\xB5\xC3\xBC gr\xC3\xB6\xC3\x9F" "e", b);
+	EXPECT_ERROREQ(UTF8_ERR_NONE, errors);
+}
+
+TEST_F(Utf8ToLower, CyrillicWord)
+{
+	const char* c = "\xD0\x9F\xD0\xA0\xD0\x98\xD0\x92\xD0\x95\xD0\xA2 \xD0\x9C\xD0\xB8\xD1\x80 \xD0\x81\xD0\x96\xD0\x98\xD0\x9A";
+	const size_t s = 255;
+	char b[256] = { 0 };
+	int32_t errors = UTF8_ERR_NONE;
+
+	EXPECT_EQ(28, utf8tolower(c, strlen(c), b, s, &errors));
+	EXPECT_UTF8EQ("\xD0\xBF\xD1\x80\xD0\xB8\xD0\xB2\xD0\xB5\xD1\x82 \xD0\xBC\xD0\xB8\xD1\x80 \xD1\x91\xD0\xB6\xD0\xB8\xD0\xBA", b);
+	EXPECT_ERROREQ(UTF8_ERR_NONE, errors);
+}
+
+TEST_F(Utf8ToLower, SimpleMappingLengthChanges)
+{
+	const char* c = "\xE2\x84\xAA\xE2\x84\xAB \xE2\xB1\xBE\xE1\xB8\x80";
+	const size_t s = 255;
+	char b[256] = { 0 };
+	int32_t errors = UTF8_ERR_NONE;
+
+	EXPECT_EQ(9, utf8tolower(c, strlen(c), b, s, &errors));
+	EXPECT_UTF8EQ("k\xC3\xA5 \xC8\xBF\xE1\xB8\x81", b);
+	EXPECT_ERROREQ(UTF8_ERR_NONE, errors);
+}
+
+TEST_F(Utf8ToLower, SimpleMappingNotEnoughSpace)
+{
+	const char* c = "\xE2\xB1\xBE\xE2\xB1\xBE";
+	const size_t s = 3;
+	char b[256] = { 0 };
+	int32_t errors = UTF8_ERR_NONE;
+
+	EXPECT_EQ(2, utf8tolower(c, strlen(c), b, s, &errors));
+	EXPECT_UTF8EQ("\xC8\xBF", b);
+	EXPECT_ERROREQ(UTF8_ERR_NOT_ENOUGH_SPACE, errors);
+}
+
+TEST_F(Utf8ToLower, UnaffectedSpan)
+{
+	const char* c = "\xE4\xB8\xAD\xE6\x96\x87\xF0\x9F\x98\x80\xD7\x90\xD0\x96\xE4\xB8\xAD";
+	const size_t s = 255;
+	char b[256] = { 0 };
+	int32_t errors = UTF8_ERR_NONE;
+
+	EXPECT_EQ(17, utf8tolower(c, strlen(c), b, s, &errors));
+	EXPECT_UTF8EQ("\xE4\xB8\xAD\xE6\x96\x87\xF0\x9F\x98\x80\xD7\x90\xD0\xB6\xE4\xB8\xAD", b);
+	EXPECT_ERROREQ(UTF8_ERR_NONE, errors);
+}
+
+TEST_F(Utf8ToLower, UnaffectedSpanNotEnoughSpace)
+{
+	const char* c = "\xE4\xB8\xAD\xE6\x96\x87\xF0\x9F\x98\x80";
+	const size_t s = 8;
+	char b[256] = { 0 };
+	int32_t errors = UTF8_ERR_NONE;
+
+	EXPECT_EQ(6, utf8tolower(c, strlen(c), b, s, &errors));
+	EXPECT_UTF8EQ("\xE4\xB8\xAD\xE6\x96\x87", b);
+	EXPECT_ERROREQ(UTF8_ERR_NOT_ENOUGH_SPACE, errors);
+}
+
 TEST_F(Utf8ToLower, GeneralCategoryCaseMappedSingleUppercase)
 {
 	// LATIN CAPITAL LETTER A WITH CIRCUMFLEX
@@ -140,6 +140,75 @@ TEST_F(Utf8ToUpper, BasicLatinNotEnoughSpace)
 	EXPECT_ERROREQ(UTF8_ERR_NOT_ENOUGH_SPACE, errors);
 }
 
+TEST_F(Utf8ToUpper, BasicLatinLongSentence)
+{
+	const char* c = "The Quick Brown Fox Jumps Over The Lazy Dog";
+	const size_t s = 255;
+	char b[256] = { 0 };
+	int32_t errors = UTF8_ERR_NONE;
+
+	EXPECT_EQ(43, utf8toupper(c, strlen(c), b, s, &errors));
+	EXPECT_UTF8EQ("THE QUICK BROWN FOX JUMPS OVER THE LAZY DOG", b);
+	EXPECT_ERROREQ(UTF8_ERR_NONE, errors);
+}
+
+TEST_F(Utf8ToUpper, BasicLatinLongNotEnoughSpace)
+{
+	const char* c = "The Quick Brown Fox Jumps Over The Lazy Dog";
+	const size_t s = 10;
+	char b[256] = { 0 };
+	int32_t errors = UTF8_ERR_NONE;
+
+	EXPECT_EQ(10, utf8toupper(c, strlen(c), b, s, &errors));
+	EXPECT_UTF8EQ("THE QUICK ", b);
+	EXPECT_ERROREQ(UTF8_ERR_NOT_ENOUGH_SPACE, errors);
+}
+
+TEST_F(Utf8ToUpper, LatinSupplementWord)
+{
+	const char* c = "\xC3\xA0\xC3\xA9\xC3\xAE\xC3\xB5\xC3\xBC \xC3\x87" "A";
+	const size_t s = 255;
+	char b[256] = { 0 };
+	int32_t errors = UTF8_ERR_NONE;
+
+	EXPECT_EQ(14, utf8toupper(c, strlen(c), b, s, &errors));
+	EXPECT_UTF8EQ("\xC3\x80\xC3\x89\xC3\x8E\xC3\x95\xC3\x9C \xC3\x87" "A", b);
+	EXPECT_ERROREQ(UTF8_ERR_NONE, errors);
+}
+
+TEST_F(Utf8ToUpper, CyrillicWord)
+{
+	const char* c = "\xD0\xBF\xD1\x80\xD0\xB8\xD0\xB2\xD0\xB5\xD1\x82 \xD0\x9C\xD0\xB8\xD1\x80 \xD1\x91\xD0\xB6\xD0\xB8\xD0\xBA";
+	const size_t s = 255;
+	char b[256] = { 0 };
+	int32_t errors = UTF8_ERR_NONE;
+
+	EXPECT_EQ(28, utf8toupper(c, strlen(c), b, s, &errors));
+	EXPECT_UTF8EQ("\xD0\x9F\xD0\xA0\xD0\x98\xD0\x92\xD0\x95\xD0\xA2 \xD0\x9C\xD0\x98\xD0\xA0 \xD0\x81\xD0\x96\xD0\x98\xD0\x9A", b);
+	EXPECT_ERROREQ(UTF8_ERR_NONE, errors);
+}
+
+TEST_F(Utf8ToUpper, SimpleMappingLengthChanges)
+{
+	const char* c = "\xC8\xBF\xC9\x80 \xE2\xB4\x80\xE2\xB4\x81";
+	const size_t s = 255;
+	char b[256] = { 0 };
+	int32_t errors = UTF8_ERR_NONE;
+
+	EXPECT_EQ(13, utf8toupper(c, strlen(c), b, s, &errors));
+	EXPECT_UTF8EQ("\xE2\xB1\xBE\xE2\xB1\xBF \xE1\x82\xA0\xE1\x82\xA1", b);
+	EXPECT_ERROREQ(UTF8_ERR_NONE, errors);
+}
+
+TEST_F(Utf8ToUpper, SimpleMappingLengthChangesAmountOfBytes)
+{
+	const char* c = "\xC8\xBF\xC9\x80 \xE2\xB4\x80\xE2\xB4\x81";
+	int32_t errors = UTF8_ERR_NONE;
+
+	EXPECT_EQ(13, utf8toupper(c, strlen(c), nullptr, 0, &errors));
+	EXPECT_ERROREQ(UTF8_ERR_NONE, errors);
+}
+
 TEST_F(Utf8ToUpper, GeneralCategoryCaseMappedSingleUppercase)
 {
 	// CYRILLIC CAPITAL LETTER EL
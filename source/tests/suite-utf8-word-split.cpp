@@ -0,0 +1,253 @@
+#include "tests-base.hpp"
+
+#include "utf8rewind.h"
+
+TEST(Utf8WordSplit, InvalidData)
+{
+	size_t o[8] = { 0 };
+	size_t os = 8;
+	int32_t errors = UTF8_ERR_NONE;
+
+	EXPECT_EQ(0, utf8wordsplit(nullptr, 4, o, os, &errors));
+	EXPECT_ERROREQ(UTF8_ERR_INVALID_DATA, errors);
+}
+
+TEST(Utf8WordSplit, Empty)
+{
+	const char* i = "";
+	size_t o[8] = { 0 };
+	size_t os = 8;
+	int32_t errors = UTF8_ERR_NONE;
+
+	EXPECT_EQ(0, utf8wordsplit(i, 0, o, os, &errors));
+	EXPECT_ERROREQ(UTF8_ERR_NONE, errors);
+}
+
+TEST(Utf8WordSplit, Words)
+{
+	const char* i = "Hello, world!";
+	size_t is = strlen(i);
+	size_t o[8] = { 0 };
+	size_t os = 8;
+	int32_t errors = UTF8_ERR_NONE;
+
+	EXPECT_EQ(5, utf8wordsplit(i, is, o, os, &errors));
+	EXPECT_EQ(0, o[0]);
+	EXPECT_EQ(5, o[1]);
+	EXPECT_EQ(6, o[2]);
+	EXPECT_EQ(7, o[3]);
+	EXPECT_EQ(12, o[4]);
+	EXPECT_ERROREQ(UTF8_ERR_NONE, errors);
+}
+
+TEST(Utf8WordSplit, SingleWord)
+{
+	const char* i = "Hello";
+	size_t is = strlen(i);
+	size_t o[8] = { 0 };
+	size_t os = 8;
+	int32_t errors = UTF8_ERR_NONE;
+
+	EXPECT_EQ(1, utf8wordsplit(i, is, o, os, &errors));
+	EXPECT_EQ(0, o[0]);
+	EXPECT_ERROREQ(UTF8_ERR_NONE, errors);
+}
+
+TEST(Utf8WordSplit, Whitespace)
+{
+	const char* i = "a   b";
+	size_t is = strlen(i);
+	size_t o[8] = { 0 };
+	size_t os = 8;
+	int32_t errors = UTF8_ERR_NONE;
+
+	EXPECT_EQ(3, utf8wordsplit(i, is, o, os, &errors));
+	EXPECT_EQ(0, o[0]);
+	EXPECT_EQ(1, o[1]);
+	EXPECT_EQ(4, o[2]);
+	EXPECT_ERROREQ(UTF8_ERR_NONE, errors);
+}
+
+TEST(Utf8WordSplit, Apostrophe)
+{
+	const char* i = "can't stop'";
+	size_t is = strlen(i);
+	size_t o[8] = { 0 };
+	size_t os = 8;
+	int32_t errors = UTF8_ERR_NONE;
+
+	EXPECT_EQ(4, utf8wordsplit(i, is, o, os, &errors));
+	EXPECT_EQ(0, o[0]);
+	EXPECT_EQ(5, o[1]);
+	EXPECT_EQ(6, o[2]);
+	EXPECT_EQ(10, o[3]);
+	EXPECT_ERROREQ(UTF8_ERR_NONE, errors);
+}
+
+TEST(Utf8WordSplit, Numbers)
+{
+	const char* i = "3.14 1,000.";
+	size_t is = strlen(i);
+	size_t o[8] = { 0 };
+	size_t os = 8;
+	int32_t errors = UTF8_ERR_NONE;
+
+	EXPECT_EQ(4, utf8wordsplit(i, is, o, os, &errors));
+	EXPECT_EQ(0, o[0]);
+	EXPECT_EQ(4, o[1]);
+	EXPECT_EQ(5, o[2]);
+	EXPECT_EQ(10, o[3]);
+	EXPECT_ERROREQ(UTF8_ERR_NONE, errors);
+}
+
+TEST(Utf8WordSplit, LettersAndNumbers)
+{
+	const char* i = "abc123_def";
+	size_t is = strlen(i);
+	size_t o[8] = { 0 };
+	size_t os = 8;
+	int32_t errors = UTF8_ERR_NONE;
+
+	EXPECT_EQ(1, utf8wordsplit(i, is, o, os, &errors));
+	EXPECT_EQ(0, o[0]);
+	EXPECT_ERROREQ(UTF8_ERR_NONE, errors);
+}
+
+TEST(Utf8WordSplit, CombiningSequence)
+{
+	// LATIN SMALL LETTER E and COMBINING ACUTE ACCENT
+
+	const char* i = "e\xCC\x81t\xC3\xA9 x";
+	size_t is = strlen(i);
+	size_t o[8] = { 0 };
+	size_t os = 8;
+	int32_t errors = UTF8_ERR_NONE;
+
+	EXPECT_EQ(3, utf8wordsplit(i, is, o, os, &errors));
+	EXPECT_EQ(0, o[0]);
+	EXPECT_EQ(6, o[1]);
+	EXPECT_EQ(7, o[2]);
+	EXPECT_ERROREQ(UTF8_ERR_NONE, errors);
+}
+
+TEST(Utf8WordSplit, KatakanaAndIdeographs)
+{
+	// Katakana is kept together, but every ideograph is a segment
+
+	const char* i = "\xE3\x82\xAB\xE3\x82\xBF\xE3\x82\xAB\xE3\x83\x8A\xE6\xBC\xA2\xE5\xAD\x97";
+	size_t is = strlen(i);
+	size_t o[8] = { 0 };
+	size_t os = 8;
+	int32_t errors = UTF8_ERR_NONE;
+
+	EXPECT_EQ(3, utf8wordsplit(i, is, o, os, &errors));
+	EXPECT_EQ(0, o[0]);
+	EXPECT_EQ(12, o[1]);
+	EXPECT_EQ(15, o[2]);
+	EXPECT_ERROREQ(UTF8_ERR_NONE, errors);
+}
+
+TEST(Utf8WordSplit, HebrewQuotationMark)
+{
+	const char* i = "\xD7\xA6\xD7\x94\"\xD7\x9C \"";
+	size_t is = strlen(i);
+	size_t o[8] = { 0 };
+	size_t os = 8;
+	int32_t errors = UTF8_ERR_NONE;
+
+	EXPECT_EQ(3, utf8wordsplit(i, is, o, os, &errors));
+	EXPECT_EQ(0, o[0]);
+	EXPECT_EQ(7, o[1]);
+	EXPECT_EQ(8, o[2]);
+	EXPECT_ERROREQ(UTF8_ERR_NONE, errors);
+}
+
+TEST(Utf8WordSplit, CarriageReturnLineFeed)
+{
+	const char* i = "a\r\n\nb";
+	size_t is = strlen(i);
+	size_t o[8] = { 0 };
+	size_t os = 8;
+	int32_t errors = UTF8_ERR_NONE;
+
+	EXPECT_EQ(4, utf8wordsplit(i, is, o, os, &errors));
+	EXPECT_EQ(0, o[0]);
+	EXPECT_EQ(1, o[1]);
+	EXPECT_EQ(3, o[2]);
+	EXPECT_EQ(4, o[3]);
+	EXPECT_ERROREQ(UTF8_ERR_NONE, errors);
+}
+
+TEST(Utf8WordSplit, EmojiZeroWidthJoiner)
+{
+	// WOMAN, ZERO WIDTH JOINER and PERSONAL COMPUTER
+
+	const char* i = "\xF0\x9F\x91\xA9\xE2\x80\x8D\xF0\x9F\x92\xBB x";
+	size_t is = strlen(i);
+	size_t o[8] = { 0 };
+	size_t os = 8;
+	int32_t errors = UTF8_ERR_NONE;
+
+	EXPECT_EQ(3, utf8wordsplit(i, is, o, os, &errors));
+	EXPECT_EQ(0, o[0]);
+	EXPECT_EQ(11, o[1]);
+	EXPECT_EQ(12, o[2]);
+	EXPECT_ERROREQ(UTF8_ERR_NONE, errors);
+}
+
+TEST(Utf8WordSplit, RegionalIndicators)
+{
+	// Flags of Germany, France and a lone REGIONAL INDICATOR SYMBOL LETTER N
+
+	const char* i = "\xF0\x9F\x87\xA9\xF0\x9F\x87\xAA\xF0\x9F\x87\xAB\xF0\x9F\x87\xB7\xF0\x9F\x87\xB3";
+	size_t is = strlen(i);
+	size_t o[8] = { 0 };
+	size_t os = 8;
+	int32_t errors = UTF8_ERR_NONE;
+
+	EXPECT_EQ(3, utf8wordsplit(i, is, o, os, &errors));
+	EXPECT_EQ(0, o[0]);
+	EXPECT_EQ(8, o[1]);
+	EXPECT_EQ(16, o[2]);
+	EXPECT_ERROREQ(UTF8_ERR_NONE, errors);
+}
+
+TEST(Utf8WordSplit, InvalidSequence)
+{
+	const char* i = "a\xFF b";
+	size_t is = strlen(i);
+	size_t o[8] = { 0 };
+	size_t os = 8;
+	int32_t errors = UTF8_ERR_NONE;
+
+	EXPECT_EQ(4, utf8wordsplit(i, is, o, os, &errors));
+	EXPECT_EQ(0, o[0]);
+	EXPECT_EQ(1, o[1]);
+	EXPECT_EQ(2, o[2]);
+	EXPECT_EQ(3, o[3]);
+	EXPECT_ERROREQ(UTF8_ERR_NONE, errors);
+}
+
+TEST(Utf8WordSplit, AmountOfSegments)
+{
+	const char* i = "Hello, world!";
+	size_t is = strlen(i);
+	int32_t errors = UTF8_ERR_NONE;
+
+	EXPECT_EQ(5, utf8wordsplit(i, is, nullptr, 0, &errors));
+	EXPECT_ERROREQ(UTF8_ERR_NONE, errors);
+}
+
+TEST(Utf8WordSplit, NotEnoughSpace)
+{
+	const char* i = "Hello, world!";
+	size_t is = strlen(i);
+	size_t o[8] = { 0 };
+	size_t os = 2;
+	int32_t errors = UTF8_ERR_NONE;
+
+	EXPECT_EQ(2, utf8wordsplit(i, is, o, os, &errors));
+	EXPECT_EQ(0, o[0]);
+	EXPECT_EQ(5, o[1]);
+	EXPECT_ERROREQ(UTF8_ERR_NOT_ENOUGH_SPACE, errors);
+}
\ No newline at end of file
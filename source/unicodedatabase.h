@@ -45,6 +45,13 @@ typedef struct {
 	unicode_t value;
 } CompositionRecord;
 
+typedef struct {
+	int32_t uppercase;
+	int32_t lowercase;
+	int32_t titlecase;
+	int32_t casefolding;
+} SimpleCaseMappingRecord;
+
 extern const size_t* GeneralCategoryIndexPtr;
 extern const uint32_t* GeneralCategoryDataPtr;
 
@@ -66,6 +73,29 @@ extern const uint8_t* QuickCheckNFKCDataPtr;
 extern const size_t* QuickCheckNFKDIndexPtr;
 extern const uint8_t* QuickCheckNFKDDataPtr;
 
+extern const size_t* QuickCheckNFKCCasefoldIndexPtr;
+extern const uint8_t* QuickCheckNFKCCasefoldDataPtr;
+
+extern const size_t* QuickCheckNFKDCasefoldIndexPtr;
+extern const uint8_t* QuickCheckNFKDCasefoldDataPtr;
+
+extern const size_t* LeadingCanonicalCombiningClassIndexPtr;
+extern const uint8_t* LeadingCanonicalCombiningClassDataPtr;
+
+extern const size_t* TrailingCanonicalCombiningClassIndexPtr;
+extern const uint8_t* TrailingCanonicalCombiningClassDataPtr;
+
+extern const size_t* GraphemeClusterBreakIndexPtr;
+extern const uint8_t* GraphemeClusterBreakDataPtr;
+
+extern const size_t* WordBreakIndexPtr;
+extern const uint8_t* WordBreakDataPtr;
+
+extern const size_t* SimpleCaseMappingIndexPtr;
+extern const uint8_t* SimpleCaseMappingDataPtr;
+
+extern const SimpleCaseMappingRecord* UnicodeSimpleCaseMappingRecordPtr;
+
 extern const size_t UnicodeNFDRecordCount;
 extern const DecompositionRecord* UnicodeNFDRecordPtr;
 
@@ -108,6 +138,10 @@ extern const uint32_t* CaseFoldingIndex1Ptr;
 extern const uint32_t* CaseFoldingIndex2Ptr;
 extern const uint32_t* CaseFoldingDataPtr;
 
+extern const uint32_t* NFKCCasefoldIndex1Ptr;
+extern const uint32_t* NFKCCasefoldIndex2Ptr;
+extern const uint32_t* NFKCCasefoldDataPtr;
+
 extern const char* CompressedStringData;
 extern const size_t CompressedStringDataLength;
 
@@ -31,7 +31,9 @@
 #include "internal/composition.h"
 #include "internal/decomposition.h"
 #include "internal/database.h"
+#include "internal/normalization.h"
 #include "internal/seeking.h"
+#include "internal/segmentation.h"
 #include "internal/streaming.h"
 
 size_t utf8len(const char* text)
@@ -544,555 +546,2318 @@ const char* utf8seek(const char* text, size_t textSize, const char* textStart, o
 	}
 }
 
-size_t utf8toupper(const char* input, size_t inputSize, char* target, size_t targetSize, int32_t* errors)
+uint8_t utf8seekindexinit(utf8seekindex_t* index, size_t interval, size_t* offsets, size_t offsetsSize, int32_t* errors)
 {
-	CaseMappingState state;
-
 	/* Validate parameters */
 
-	UTF8_VALIDATE_PARAMETERS_CHAR(char, 0);
-
-	/* Initialize case mapping */
-
-	if (!casemapping_initialize(&state, input, inputSize, target, targetSize, UppercaseIndex1Ptr, UppercaseIndex2Ptr, UppercaseDataPtr))
+	if (index == 0 ||
+		interval == 0 ||
+		(offsets == 0 && offsetsSize > 0))
 	{
-		UTF8_SET_ERROR(NONE);
+		UTF8_SET_ERROR(INVALID_DATA);
 
-		return state.total_bytes_needed;
+		return 0;
 	}
 
-	/* Execute case mapping as long as input remains */
-
-	while (state.src_size > 0)
-	{
-		size_t converted;
+	/* Initialize index */
 
-		if ((converted = casemapping_execute(&state, errors)) == 0)
-		{
-			return state.total_bytes_needed;
-		}
+	memset(index, 0, sizeof(utf8seekindex_t));
 
-		state.total_bytes_needed += converted;
-	}
+	index->offsets = offsets;
+	index->offsets_size = offsetsSize;
+	index->interval = interval;
 
 	UTF8_SET_ERROR(NONE);
 
-	return state.total_bytes_needed;
+	return 1;
 }
 
-size_t utf8tolower(const char* input, size_t inputSize, char* target, size_t targetSize, int32_t* errors)
+size_t utf8seekindexappend(utf8seekindex_t* index, const char* text, size_t textSize, int32_t* errors)
 {
-	CaseMappingState state;
-
 	/* Validate parameters */
 
-	UTF8_VALIDATE_PARAMETERS_CHAR(char, 0);
+	if (index == 0 ||
+		index->interval == 0)
+	{
+		UTF8_SET_ERROR(INVALID_DATA);
 
-	/* Initialize case mapping */
+		return 0;
+	}
 
-	if (!casemapping_initialize(&state, input, inputSize, target, targetSize, LowercaseIndex1Ptr, LowercaseIndex2Ptr, LowercaseDataPtr))
+	if (text == 0 ||
+		textSize < index->size)
 	{
-		UTF8_SET_ERROR(NONE);
+		UTF8_SET_ERROR(INVALID_DATA);
 
-		return state.total_bytes_needed;
+		return index->length;
 	}
 
-	/* Execute case mapping as long as input remains */
+	/* Index the text after the part that was indexed before */
 
-	while (state.src_size > 0)
-	{
-		size_t converted;
+	seeking_indexappend(index, text, text + textSize);
 
-		if ((converted = casemapping_execute(&state, errors)) == 0)
-		{
-			return state.total_bytes_needed;
-		}
+	if (index->size < textSize &&
+		index->count == index->offsets_size &&
+		(index->length % index->interval) == 0 &&
+		index->length / index->interval == index->count)
+	{
+		UTF8_SET_ERROR(NOT_ENOUGH_SPACE);
 
-		state.total_bytes_needed += converted;
+		return index->length;
 	}
 
 	UTF8_SET_ERROR(NONE);
 
-	return state.total_bytes_needed;
+	return index->length;
 }
 
-size_t utf8totitle(const char* input, size_t inputSize, char* target, size_t targetSize, int32_t* errors)
+size_t utf8seekindexsave(const utf8seekindex_t* index, char* target, size_t targetSize, int32_t* errors)
 {
-	CaseMappingState state;
+	size_t bytes_needed;
 
 	/* Validate parameters */
 
-	UTF8_VALIDATE_PARAMETERS_CHAR(char, 0);
-
-	/* Initialize case mapping */
-
-	if (!casemapping_initialize(&state, input, inputSize, target, targetSize, TitlecaseIndex1Ptr, TitlecaseIndex2Ptr, TitlecaseDataPtr))
+	if (index == 0 ||
+		index->interval == 0)
 	{
-		UTF8_SET_ERROR(NONE);
+		UTF8_SET_ERROR(INVALID_DATA);
 
-		return state.total_bytes_needed;
+		return 0;
 	}
 
-	/* Execute case mapping as long as input remains */
+	bytes_needed = SEEKING_INDEX_HEADER_SIZE + index->count * 8;
 
-	while (state.src_size > 0)
+	/* Determine amount of bytes needed */
+
+	if (target == 0)
 	{
-		size_t converted;
-		
-		if ((converted = casemapping_execute(&state, errors)) == 0)
-		{
-			return state.total_bytes_needed;
-		}
+		UTF8_SET_ERROR(NONE);
 
-		/*
-			The first letter of every word should be titlecase, the rest should
-			be converted to lowercase.
-		*/
+		return bytes_needed;
+	}
 
-		if (state.last_canonical_combining_class == CCC_NOT_REORDERED)
-		{
-			if (state.property_data == TitlecaseDataPtr)
-			{
-				if ((state.last_general_category & UTF8_CATEGORY_LETTER) != 0)
-				{
-					state.property_index1 = LowercaseIndex1Ptr;
-					state.property_index2 = LowercaseIndex2Ptr;
-					state.property_data = LowercaseDataPtr;
+	if (targetSize < bytes_needed)
+	{
+		UTF8_SET_ERROR(NOT_ENOUGH_SPACE);
 
-					state.quickcheck_flags = QuickCheckCaseMapped_Lowercase;
-				}
-			}
-			else if (
-				(state.last_general_category & UTF8_CATEGORY_LETTER) == 0)
-			{
-				state.property_index1 = TitlecaseIndex1Ptr;
-				state.property_index2 = TitlecaseIndex2Ptr;
-				state.property_data = TitlecaseDataPtr;
+		return 0;
+	}
 
-				state.quickcheck_flags = QuickCheckCaseMapped_Titlecase;
-			}
-		}
+	/* Serialize index */
 
-		state.total_bytes_needed += converted;
-	}
+	seeking_indexwrite(index, target);
 
 	UTF8_SET_ERROR(NONE);
 
-	return state.total_bytes_needed;
+	return bytes_needed;
 }
 
-size_t utf8casefold(const char* input, size_t inputSize, char* target, size_t targetSize, int32_t* errors)
+uint8_t utf8seekindexload(utf8seekindex_t* index, const char* input, size_t inputSize, size_t* offsets, size_t offsetsSize, int32_t* errors)
 {
-	CaseMappingState state;
-
 	/* Validate parameters */
 
-	UTF8_VALIDATE_PARAMETERS_CHAR(char, 0);
-
-	/* Initialize case mapping */
-
-	if (!casemapping_initialize(&state, input, inputSize, target, targetSize, CaseFoldingIndex1Ptr, CaseFoldingIndex2Ptr, CaseFoldingDataPtr))
+	if (index == 0 ||
+		input == 0 ||
+		(offsets == 0 && offsetsSize > 0))
 	{
-		UTF8_SET_ERROR(NONE);
+		UTF8_SET_ERROR(INVALID_DATA);
 
-		return state.total_bytes_needed;
+		return 0;
 	}
 
-	/* Execute case mapping as long as input remains */
+	memset(index, 0, sizeof(utf8seekindex_t));
 
-	while (state.src_size > 0)
-	{
-		const char* resolved = 0;
-		uint8_t bytes_needed = 0;
+	index->offsets = offsets;
+	index->offsets_size = offsetsSize;
 
-		/* Read next code point */
+	/* Deserialize index */
+
+	if (!seeking_indexread(index, input, inputSize))
+	{
+		memset(index, 0, sizeof(utf8seekindex_t));
 
-		if (!(state.last_code_point_size = codepoint_read(state.src, state.src_size, &state.last_code_point)))
+		if (inputSize >= SEEKING_INDEX_HEADER_SIZE &&
+			inputSize == SEEKING_INDEX_HEADER_SIZE + (inputSize - SEEKING_INDEX_HEADER_SIZE) / 8 * 8 &&
+			(inputSize - SEEKING_INDEX_HEADER_SIZE) / 8 > offsetsSize)
 		{
-			goto invaliddata;
+			UTF8_SET_ERROR(NOT_ENOUGH_SPACE);
 		}
-
-		/* Fixes for Turkish locale */
-
-		if (state.locale == CASEMAPPING_LOCALE_TURKISH_OR_AZERI_LATIN)
+		else
 		{
-			if (state.last_code_point == CP_LATIN_CAPITAL_LETTER_I)
-			{
-				resolved = "\xC4\xB1";
-				bytes_needed = 2;
-			}
-			else if (
-				state.last_code_point == CP_LATIN_CAPITAL_LETTER_I_WITH_DOT_ABOVE)
-			{
-				resolved = "i";
-				bytes_needed = 1;
-			}
+			UTF8_SET_ERROR(INVALID_DATA);
 		}
 
-		/* Resolve case folding */
+		return 0;
+	}
+
+	UTF8_SET_ERROR(NONE);
 
-		if (resolved == 0 &&
-			(PROPERTY_GET_CM(state.last_code_point) & QuickCheckCaseMapped_Casefolded) != 0)
-		{
-			resolved = database_querydecomposition(state.last_code_point, state.property_index1, state.property_index2, state.property_data, &bytes_needed);
-		}
+	return 1;
+}
 
-		/* Move source cursor */
+const char* utf8seekindexed(const utf8seekindex_t* index, const char* text, size_t textSize, const char* textStart, off_t offset, int direction)
+{
+	const char* text_end;
+	size_t position;
 
-		if (state.src_size >= state.last_code_point_size)
-		{
-			state.src += state.last_code_point_size;
-			state.src_size -= state.last_code_point_size;
-		}
-		else
-		{
-			state.src_size = 0;
-		}
+	if (index == 0 ||
+		index->interval == 0)
+	{
+		return utf8seek(text, textSize, textStart, offset, direction);
+	}
 
-		/* Write to output */
+	if (text == 0 ||
+		textStart == 0)
+	{
+		return text;
+	}
 
-		if (resolved != 0)
-		{
-			/* Write resolved string to output */
+	text_end = textStart + textSize;
 
-			if (state.dst != 0)
-			{
-				if (state.dst_size < bytes_needed)
-				{
-					goto outofspace;
-				}
+	/* Determine the position to seek from in code points */
 
-				memcpy(state.dst, resolved, bytes_needed);
+	switch (direction)
+	{
 
-				state.dst += bytes_needed;
-				state.dst_size -= bytes_needed;
-			}
-		}
-		else
+	case SEEK_CUR:
 		{
-			/* Write code point unchanged to output */
-
-			if (!(bytes_needed = codepoint_write(state.last_code_point, &state.dst, &state.dst_size)))
+			if (offset == 0 ||
+				text < textStart ||
+				text > text_end)
 			{
-				goto outofspace;
+				return text;
 			}
-		}
-
-		state.total_bytes_needed += bytes_needed;
-	}
 
-	UTF8_SET_ERROR(NONE);
+			position = seeking_indexposition(index, textStart, text);
 
-	return state.total_bytes_needed;
+		} break;
 
-invaliddata:
-	UTF8_SET_ERROR(INVALID_DATA);
+	case SEEK_SET:
+		{
+			if (text < textStart)
+			{
+				return text;
+			}
 
-	return state.total_bytes_needed;
+			position = 0;
 
-outofspace:
-	UTF8_SET_ERROR(NOT_ENOUGH_SPACE);
+		} break;
 
-	return state.total_bytes_needed;
-}
+	case SEEK_END:
+		{
+			position = seeking_indexposition(index, textStart, text_end);
+			offset = -offset;
 
-uint8_t utf8isnormalized(const char* input, size_t inputSize, size_t flags, size_t* offset)
-{
-	const char* src = input;
-	size_t src_size = inputSize;
-	uint8_t last_canonical_class = CCC_NOT_REORDERED;
-	size_t found_offset = 0;
-	uint8_t result = UTF8_NORMALIZATION_RESULT_YES;
-	unicode_t decoded;
-	uint8_t canonical_class;
-	uint8_t quick_check;
-	const size_t* property_index;
-	const uint8_t* property_data;
+		} break;
 
-	/* Validate input and flags */
+	default:
+		return text;
 
-	if (input == NULL ||
-		inputSize == 0 ||
-		(flags & (UTF8_NORMALIZE_DECOMPOSE | UTF8_NORMALIZE_COMPOSE)) == 0)
-	{
-		goto end;
 	}
 
-	/* Get properties */
+	/* Seeking before the start returns the start of the text */
 
-	if ((flags & UTF8_NORMALIZE_COMPOSE) != 0)
+	if (offset < 0)
 	{
-		if ((flags & UTF8_NORMALIZE_COMPATIBILITY) != 0)
-		{
-			property_index = QuickCheckNFKCIndexPtr;
-			property_data = QuickCheckNFKCDataPtr;
-		}
-		else
+		if ((size_t)-offset >= position)
 		{
-			property_index = QuickCheckNFCIndexPtr;
-			property_data = QuickCheckNFCDataPtr;
+			return textStart;
 		}
+
+		position -= (size_t)-offset;
 	}
 	else
 	{
-		if ((flags & UTF8_NORMALIZE_COMPATIBILITY) != 0)
-		{
-			property_index = QuickCheckNFKDIndexPtr;
-			property_data = QuickCheckNFKDDataPtr;
-		}
-		else
-		{
-			property_index = QuickCheckNFDIndexPtr;
-			property_data = QuickCheckNFDDataPtr;
-		}
+		position += (size_t)offset;
 	}
 
-	/* Process input */
+	return seeking_indexforward(index, textStart, text_end, position);
+}
 
-	while (src_size > 0)
+uint8_t utf8lineindexinit(utf8lineindex_t* index, size_t interval, utf8position_t* marks, size_t marksSize, int32_t* errors)
+{
+	/* Validate parameters */
+
+	if (index == 0 ||
+		interval == 0 ||
+		marks == 0 ||
+		marksSize == 0)
 	{
-		/* Read codepoint at cursor */
+		UTF8_SET_ERROR(INVALID_DATA);
 
-		uint8_t read = codepoint_read(src, src_size, &decoded);
-		if (read == 0)
-		{
-			break;
-		}
+		return 0;
+	}
 
-		/* Get canonical combining class and quick check value */
+	/* Initialize index */
 
-		canonical_class = PROPERTY_GET_CCC(decoded);
-		quick_check = PROPERTY_GET(property_index, property_data, decoded);
+	memset(index, 0, sizeof(utf8lineindex_t));
 
-		/* Compare CCC to previous CCC */
+	index->marks = marks;
+	index->marks_size = marksSize;
+	index->interval = interval;
 
-		if (last_canonical_class > canonical_class &&
-			canonical_class > CCC_NOT_REORDERED)
-		{
-			result = UTF8_NORMALIZATION_RESULT_NO;
+	/* The first mark is always the start of the text */
 
-			break;
-		}
+	memset(&marks[0], 0, sizeof(utf8position_t));
+	index->count = 1;
 
-		/* Compare quick check value */
+	UTF8_SET_ERROR(NONE);
 
-		if (quick_check == QuickCheckResult_No)
-		{
-			result = UTF8_NORMALIZATION_RESULT_NO;
+	return 1;
+}
 
-			break;
-		}
-		else if (
-			quick_check == QuickCheckResult_Maybe)
-		{
-			result = UTF8_NORMALIZATION_RESULT_MAYBE;
-		}
+size_t utf8lineindexbuild(utf8lineindex_t* index, const char* text, size_t textSize, int32_t* errors)
+{
+	/* Validate parameters */
 
-		/* Append to offset */
+	if (index == 0 ||
+		index->count == 0 ||
+		(text == 0 && textSize > 0))
+	{
+		UTF8_SET_ERROR(INVALID_DATA);
 
-		if (result != UTF8_NORMALIZATION_RESULT_MAYBE)
-		{
-			found_offset += read;
-		}
+		return 0;
+	}
+
+	/* Discard everything after the first mark */
+
+	index->count = 1;
+	memset(&index->end, 0, sizeof(utf8position_t));
+
+	if (!seeking_lineupdate(index, text, text + textSize, 0, 0, textSize))
+	{
+		UTF8_SET_ERROR(NOT_ENOUGH_SPACE);
+
+		return index->end.line + 1;
+	}
+
+	UTF8_SET_ERROR(NONE);
+
+	return index->end.line + 1;
+}
+
+size_t utf8lineindexupdate(utf8lineindex_t* index, const char* text, size_t textSize, size_t editOffset, size_t removedSize, size_t insertedSize, int32_t* errors)
+{
+	/* Validate parameters */
+
+	if (index == 0 ||
+		index->count == 0)
+	{
+		UTF8_SET_ERROR(INVALID_DATA);
+
+		return 0;
+	}
+
+	if ((text == 0 && textSize > 0) ||
+		editOffset > index->end.offset ||
+		removedSize > index->end.offset - editOffset ||
+		textSize != index->end.offset - removedSize + insertedSize)
+	{
+		UTF8_SET_ERROR(INVALID_DATA);
+
+		return index->end.line + 1;
+	}
+
+	/* Scan the edited part of the text */
+
+	if (!seeking_lineupdate(index, text, text + textSize, editOffset, removedSize, insertedSize))
+	{
+		UTF8_SET_ERROR(NOT_ENOUGH_SPACE);
+
+		return index->end.line + 1;
+	}
+
+	UTF8_SET_ERROR(NONE);
+
+	return index->end.line + 1;
+}
+
+uint8_t utf8lineindexfind(const utf8lineindex_t* index, const char* text, size_t textSize, size_t unit, utf8position_t* position, int32_t* errors)
+{
+	/* Validate parameters */
+
+	if (index == 0 ||
+		index->count == 0 ||
+		position == 0 ||
+		(text == 0 && textSize > 0) ||
+		textSize != index->end.offset)
+	{
+		UTF8_SET_ERROR(INVALID_DATA);
+
+		return 0;
+	}
+
+	if (unit < UTF8_POSITION_OFFSET ||
+		unit > UTF8_POSITION_LINE)
+	{
+		UTF8_SET_ERROR(INVALID_FLAG);
+
+		return 0;
+	}
+
+	UTF8_SET_ERROR(NONE);
+
+	return seeking_linefind(index, text, text + textSize, unit, position);
+}
+
+size_t utf8graphemelen(const char* text, size_t textSize)
+{
+	if (text == 0)
+	{
+		return 0;
+	}
+
+	return segmentation_graphemecount(text, text + textSize);
+}
+
+const char* utf8graphemeseek(const char* text, size_t textSize, const char* textStart, off_t offset, int direction)
+{
+	const char* text_end;
+
+	if (text == 0 ||
+		textStart == 0)
+	{
+		return text;
+	}
+
+	text_end = textStart + textSize;
+
+	switch (direction)
+	{
+
+	case SEEK_CUR:
+		{
+			if (offset == 0)
+			{
+				return text;
+			}
+			else if (offset > 0)
+			{
+				return segmentation_graphemeforward(text, text_end, offset);
+			}
+			else
+			{
+				return segmentation_graphemerewind(textStart, text, text_end, offset);
+			}
+
+		} break;
+
+	case SEEK_SET:
+		{
+			if (text < textStart)
+			{
+				return text;
+			}
+
+			return segmentation_graphemeforward(textStart, text_end, offset);
+
+		} break;
+
+	case SEEK_END:
+		return segmentation_graphemerewind(textStart, text_end, text_end, -offset);
+
+	default:
+		return text;
+
+	}
+}
+
+size_t utf8wordsplit(const char* input, size_t inputSize, size_t* offsets, size_t offsetsSize, int32_t* errors)
+{
+	WordSegmentationState state;
+	const char* src;
+	const char* src_end;
+	size_t segment_count = 0;
+
+	/* Validate parameters */
+
+	if (input == 0)
+	{
+		UTF8_SET_ERROR(INVALID_DATA);
+
+		return segment_count;
+	}
+
+	src = input;
+	src_end = input + inputSize;
+
+	segmentation_wordinitialize(&state, src, src_end);
+
+	while (src < src_end)
+	{
+		/* Store the offset to the start of the segment */
+
+		if (offsets != 0)
+		{
+			if (segment_count == offsetsSize)
+			{
+				UTF8_SET_ERROR(NOT_ENOUGH_SPACE);
+
+				return segment_count;
+			}
+
+			offsets[segment_count] = (size_t)(src - input);
+		}
+
+		segment_count++;
+
+		src = segmentation_wordnext(&state);
+	}
+
+	UTF8_SET_ERROR(NONE);
+
+	return segment_count;
+}
+
+size_t utf8getlocale()
+{
+	return (size_t)casemapping_locale();
+}
+
+size_t utf8toupper(const char* input, size_t inputSize, char* target, size_t targetSize, int32_t* errors)
+{
+	return utf8toupper_l(input, inputSize, target, targetSize, casemapping_locale(), errors);
+}
+
+size_t utf8toupper_l(const char* input, size_t inputSize, char* target, size_t targetSize, size_t locale, int32_t* errors)
+{
+	CaseMappingState state;
+
+	/* Validate parameters */
+
+	UTF8_VALIDATE_PARAMETERS_CHAR(char, 0);
+
+	/* Initialize case mapping */
+
+	if (!casemapping_initialize(&state, input, inputSize, target, targetSize, UppercaseIndex1Ptr, UppercaseIndex2Ptr, UppercaseDataPtr, locale))
+	{
+		UTF8_SET_ERROR(INVALID_LOCALE);
+
+		return state.total_bytes_needed;
+	}
+
+	/* Execute case mapping as long as input remains */
+
+	while (state.src_size > 0)
+	{
+		size_t converted;
+
+		/* Map runs of simple code points before using the full case mapping */
+
+		if ((converted = casemapping_executefast(&state)) == 0 &&
+			(converted = casemapping_execute(&state, errors)) == 0)
+		{
+			return state.total_bytes_needed;
+		}
+
+		state.total_bytes_needed += converted;
+	}
+
+	UTF8_SET_ERROR(NONE);
+
+	return state.total_bytes_needed;
+}
+
+size_t utf8tolower(const char* input, size_t inputSize, char* target, size_t targetSize, int32_t* errors)
+{
+	return utf8tolower_l(input, inputSize, target, targetSize, casemapping_locale(), errors);
+}
+
+size_t utf8tolower_l(const char* input, size_t inputSize, char* target, size_t targetSize, size_t locale, int32_t* errors)
+{
+	CaseMappingState state;
+
+	/* Validate parameters */
+
+	UTF8_VALIDATE_PARAMETERS_CHAR(char, 0);
+
+	/* Initialize case mapping */
+
+	if (!casemapping_initialize(&state, input, inputSize, target, targetSize, LowercaseIndex1Ptr, LowercaseIndex2Ptr, LowercaseDataPtr, locale))
+	{
+		UTF8_SET_ERROR(INVALID_LOCALE);
+
+		return state.total_bytes_needed;
+	}
+
+	/* Execute case mapping as long as input remains */
+
+	while (state.src_size > 0)
+	{
+		size_t converted;
+
+		/* Map runs of simple code points before using the full case mapping */
+
+		if ((converted = casemapping_executefast(&state)) == 0 &&
+			(converted = casemapping_execute(&state, errors)) == 0)
+		{
+			return state.total_bytes_needed;
+		}
+
+		state.total_bytes_needed += converted;
+	}
+
+	UTF8_SET_ERROR(NONE);
+
+	return state.total_bytes_needed;
+}
+
+size_t utf8totitle(const char* input, size_t inputSize, char* target, size_t targetSize, int32_t* errors)
+{
+	return utf8totitle_l(input, inputSize, target, targetSize, casemapping_locale(), errors);
+}
+
+size_t utf8totitle_l(const char* input, size_t inputSize, char* target, size_t targetSize, size_t locale, int32_t* errors)
+{
+	CaseMappingState state;
+
+	/* Validate parameters */
+
+	UTF8_VALIDATE_PARAMETERS_CHAR(char, 0);
+
+	/* Initialize case mapping */
+
+	if (!casemapping_initialize(&state, input, inputSize, target, targetSize, TitlecaseIndex1Ptr, TitlecaseIndex2Ptr, TitlecaseDataPtr, locale))
+	{
+		UTF8_SET_ERROR(INVALID_LOCALE);
+
+		return state.total_bytes_needed;
+	}
+
+	/* Execute case mapping as long as input remains */
+
+	while (state.src_size > 0)
+	{
+		size_t converted;
+		
+		if ((converted = casemapping_execute(&state, errors)) == 0)
+		{
+			return state.total_bytes_needed;
+		}
+
+		/*
+			The first letter of every word should be titlecase, the rest should
+			be converted to lowercase.
+		*/
+
+		if (state.last_canonical_combining_class == CCC_NOT_REORDERED)
+		{
+			if (state.property_data == TitlecaseDataPtr)
+			{
+				if ((state.last_general_category & UTF8_CATEGORY_LETTER) != 0)
+				{
+					state.property_index1 = LowercaseIndex1Ptr;
+					state.property_index2 = LowercaseIndex2Ptr;
+					state.property_data = LowercaseDataPtr;
+
+					state.quickcheck_flags = QuickCheckCaseMapped_Lowercase;
+				}
+			}
+			else if (
+				(state.last_general_category & UTF8_CATEGORY_LETTER) == 0)
+			{
+				state.property_index1 = TitlecaseIndex1Ptr;
+				state.property_index2 = TitlecaseIndex2Ptr;
+				state.property_data = TitlecaseDataPtr;
+
+				state.quickcheck_flags = QuickCheckCaseMapped_Titlecase;
+			}
+		}
+
+		state.total_bytes_needed += converted;
+	}
+
+	UTF8_SET_ERROR(NONE);
+
+	return state.total_bytes_needed;
+}
+
+size_t utf8casefold(const char* input, size_t inputSize, char* target, size_t targetSize, int32_t* errors)
+{
+	return utf8casefold_l(input, inputSize, target, targetSize, casemapping_locale(), errors);
+}
+
+size_t utf8casefold_l(const char* input, size_t inputSize, char* target, size_t targetSize, size_t locale, int32_t* errors)
+{
+	CaseMappingState state;
+
+	/* Validate parameters */
+
+	UTF8_VALIDATE_PARAMETERS_CHAR(char, 0);
+
+	/* Initialize case mapping */
+
+	if (!casemapping_initialize(&state, input, inputSize, target, targetSize, CaseFoldingIndex1Ptr, CaseFoldingIndex2Ptr, CaseFoldingDataPtr, locale))
+	{
+		UTF8_SET_ERROR(INVALID_LOCALE);
+
+		return state.total_bytes_needed;
+	}
+
+	/* Execute case folding as long as input remains */
+
+	while (state.src_size > 0)
+	{
+		size_t converted;
+
+		/* Fold runs of simple code points before using the full case folding */
+
+		if ((converted = casemapping_executefast(&state)) == 0 &&
+			(converted = casemapping_executefold(&state, errors)) == 0)
+		{
+			return state.total_bytes_needed;
+		}
+
+		state.total_bytes_needed += converted;
+	}
+
+	UTF8_SET_ERROR(NONE);
+
+	return state.total_bytes_needed;
+}
+
+size_t utf8toupperinplace(char* text, size_t textSize, int32_t* errors)
+{
+	CaseMappingState state;
+
+	/* Validate parameters */
+
+	if (text == 0)
+	{
+		UTF8_SET_ERROR(INVALID_DATA);
+
+		return 0;
+	}
+
+	/* Initialize case mapping */
+
+	casemapping_initialize(&state, text, textSize, 0, 0, UppercaseIndex1Ptr, UppercaseIndex2Ptr, UppercaseDataPtr, casemapping_locale());
+
+	/* Rewrite text as long as the length does not change */
+
+	return casemapping_executeinplace(&state, errors);
+}
+
+size_t utf8tolowerinplace(char* text, size_t textSize, int32_t* errors)
+{
+	CaseMappingState state;
+
+	/* Validate parameters */
+
+	if (text == 0)
+	{
+		UTF8_SET_ERROR(INVALID_DATA);
+
+		return 0;
+	}
+
+	/* Initialize case mapping */
+
+	casemapping_initialize(&state, text, textSize, 0, 0, LowercaseIndex1Ptr, LowercaseIndex2Ptr, LowercaseDataPtr, casemapping_locale());
+
+	/* Rewrite text as long as the length does not change */
+
+	return casemapping_executeinplace(&state, errors);
+}
+
+size_t utf8casefoldinplace(char* text, size_t textSize, int32_t* errors)
+{
+	CaseMappingState state;
+
+	/* Validate parameters */
+
+	if (text == 0)
+	{
+		UTF8_SET_ERROR(INVALID_DATA);
+
+		return 0;
+	}
+
+	/* Initialize case mapping */
+
+	casemapping_initialize(&state, text, textSize, 0, 0, CaseFoldingIndex1Ptr, CaseFoldingIndex2Ptr, CaseFoldingDataPtr, casemapping_locale());
+
+	/* Rewrite text as long as the length does not change */
+
+	return casemapping_executeinplace(&state, errors);
+}
+
+size_t utf8casemapsplit(const char* input, size_t inputSize, size_t segmentSize, size_t* offsets, size_t offsetsSize, int32_t* errors)
+{
+	const char* src;
+	const char* src_end;
+	size_t segment_count = 0;
+
+	/* Validate parameters */
+
+	if (input == 0 ||
+		segmentSize == 0)
+	{
+		UTF8_SET_ERROR(INVALID_DATA);
+
+		return segment_count;
+	}
+
+	src = input;
+	src_end = input + inputSize;
+
+	while (src < src_end)
+	{
+		/* Store the offset to the start of the segment */
+
+		if (offsets != 0)
+		{
+			if (segment_count == offsetsSize)
+			{
+				UTF8_SET_ERROR(NOT_ENOUGH_SPACE);
+
+				return segment_count;
+			}
+
+			offsets[segment_count] = (size_t)(src - input);
+		}
+
+		segment_count++;
+
+		if (segmentSize >= (size_t)(src_end - src))
+		{
+			break;
+		}
+
+		/*
+			Segments end in front of the first code point after the requested
+			size that does not depend on the code points before it.
+		*/
+
+		src = casemapping_boundaryforward(src + segmentSize, src_end);
+	}
+
+	UTF8_SET_ERROR(NONE);
+
+	return segment_count;
+}
+
+int utf8casecmp(const char* left, size_t leftSize, const char* right, size_t rightSize, size_t locale, int32_t* errors)
+{
+	return utf8ncasecmp(left, leftSize, right, rightSize, SIZE_MAX, locale, errors);
+}
+
+int utf8ncasecmp(const char* left, size_t leftSize, const char* right, size_t rightSize, size_t count, size_t locale, int32_t* errors)
+{
+	int result;
+
+	/* Validate parameters */
+
+	if (left == 0 ||
+		right == 0)
+	{
+		UTF8_SET_ERROR(INVALID_DATA);
+
+		return 0;
+	}
+
+	if (locale >= UTF8_LOCALE_MAXIMUM)
+	{
+		UTF8_SET_ERROR(INVALID_LOCALE);
+
+		return 0;
+	}
+
+	/* Case fold both sides until the first difference */
+
+	result = casemapping_compare(left, leftSize, right, rightSize, count, locale, errors);
+
+	UTF8_SET_ERROR(NONE);
+
+	return result;
+}
+
+const char* utf8casesearch(const char* input, size_t inputSize, const char* needle, size_t needleSize, size_t locale, size_t* matchSize, int32_t* errors)
+{
+	const char* match;
+
+	/* Validate parameters */
+
+	if (input == 0 ||
+		needle == 0)
+	{
+		UTF8_SET_ERROR(INVALID_DATA);
+
+		return 0;
+	}
+
+	if (locale >= UTF8_LOCALE_MAXIMUM)
+	{
+		UTF8_SET_ERROR(INVALID_LOCALE);
+
+		return 0;
+	}
+
+	/* Empty needle matches the start of the input */
+
+	if (needleSize == 0)
+	{
+		if (matchSize != 0)
+		{
+			*matchSize = 0;
+		}
+
+		UTF8_SET_ERROR(NONE);
+
+		return input;
+	}
+
+	/* Case fold only the candidate matches in the input */
+
+	match = casemapping_search(input, inputSize, needle, needleSize, locale, matchSize, errors);
+
+	UTF8_SET_ERROR(NONE);
+
+	return match;
+}
+
+uint64_t utf8casehash(const char* input, size_t inputSize, size_t locale, int32_t* errors)
+{
+	uint64_t result;
+
+	/* Validate parameters */
+
+	if (input == 0)
+	{
+		UTF8_SET_ERROR(INVALID_DATA);
+
+		return 0;
+	}
+
+	if (locale >= UTF8_LOCALE_MAXIMUM)
+	{
+		UTF8_SET_ERROR(INVALID_LOCALE);
+
+		return 0;
+	}
+
+	/* Hash the case folded code points */
+
+	result = casemapping_hash(input, inputSize, locale, errors);
+
+	UTF8_SET_ERROR(NONE);
+
+	return result;
+}
+
+uint8_t utf8iscased(const char* input, size_t inputSize, size_t flags, size_t* offset)
+{
+	const char* src = input;
+	size_t src_size = inputSize;
+	uint8_t result = 1;
+	uint8_t quickcheck_flags;
+	uint8_t word_start = 1;
+
+	/* Validate flags */
+
+	if (flags == 0 ||
+		(flags & ~(UTF8_CASE_UPPERCASE | UTF8_CASE_LOWERCASE | UTF8_CASE_TITLECASE | UTF8_CASE_CASEFOLDED)) != 0)
+	{
+		result = 0;
+
+		goto end;
+	}
+
+	/* Titlecase depends on the position of the code point in the word */
+
+	quickcheck_flags = (uint8_t)(flags & ~UTF8_CASE_TITLECASE);
+
+	if (input == NULL)
+	{
+		goto end;
+	}
+
+	/* Process input */
+
+	while (src_size > 0)
+	{
+		unicode_t decoded;
+		uint8_t quickcheck_mask = quickcheck_flags;
+
+		/* Read codepoint at cursor */
+
+		uint8_t read = codepoint_read(src, src_size, &decoded);
+		if (read == 0)
+		{
+			break;
+		}
+
+		/* Invalid sequences are changed to the replacement character */
+
+		if (decoded == REPLACEMENT_CHARACTER &&
+			(read != REPLACEMENT_CHARACTER_STRING_LENGTH || memcmp(src, REPLACEMENT_CHARACTER_STRING, REPLACEMENT_CHARACTER_STRING_LENGTH) != 0))
+		{
+			result = 0;
+
+			break;
+		}
+
+		/* Check if the code point is changed by case mapping */
+
+		if ((flags & UTF8_CASE_TITLECASE) != 0)
+		{
+			quickcheck_mask |= word_start ? QuickCheckCaseMapped_Titlecase : QuickCheckCaseMapped_Lowercase;
+		}
+
+		if ((PROPERTY_GET_CM(decoded) & quickcheck_mask) != 0)
+		{
+			result = 0;
+
+			break;
+		}
+
+		/* Every letter following the first letter of a word is lowercase */
+
+		if ((flags & UTF8_CASE_TITLECASE) != 0 &&
+			PROPERTY_GET_CCC(decoded) == CCC_NOT_REORDERED)
+		{
+			word_start = (PROPERTY_GET_GC(decoded) & UTF8_CATEGORY_LETTER) == 0;
+		}
+
+		src += read;
+		src_size -= read;
+	}
+
+end:
+	if (offset != 0)
+	{
+		*offset = (size_t)(src - input);
+	}
+
+	return result;
+}
+
+uint8_t utf8isnormalized(const char* input, size_t inputSize, size_t flags, size_t* offset)
+{
+	const char* src = input;
+	size_t src_size = inputSize;
+	uint8_t last_canonical_class = CCC_NOT_REORDERED;
+	size_t found_offset = 0;
+	uint8_t result = UTF8_NORMALIZATION_RESULT_YES;
+	unicode_t decoded;
+	uint8_t canonical_class;
+	uint8_t trailing_class;
+	uint8_t quick_check;
+	const size_t* property_index;
+	const uint8_t* property_data;
+
+	/* Validate input and get properties for flags */
+
+	if (input == NULL ||
+		inputSize == 0 ||
+		!normalization_quickcheck(flags, &property_index, &property_data))
+	{
+		goto end;
+	}
+
+	/* Process input */
+
+	while (src_size > 0)
+	{
+		/* Read codepoint at cursor */
+
+		uint8_t read = codepoint_read(src, src_size, &decoded);
+		if (read == 0)
+		{
+			break;
+		}
+
+		/* Get canonical combining class and quick check value */
+
+		if ((flags & UTF8_NORMALIZE_FAST) != 0)
+		{
+			/* FCD compares the classes at the edges of the canonical decomposition */
+
+			canonical_class = PROPERTY_GET_LCCC(decoded);
+			trailing_class = PROPERTY_GET_TCCC(decoded);
+		}
+		else
+		{
+			canonical_class = PROPERTY_GET_CCC(decoded);
+			trailing_class = canonical_class;
+		}
+
+		if ((flags & (UTF8_NORMALIZE_FAST | UTF8_NORMALIZE_COMPOSE)) == UTF8_NORMALIZE_FAST)
+		{
+			/* FCD allows any decomposition that keeps the canonical ordering */
+
+			quick_check = QuickCheckResult_Yes;
+		}
+		else
+		{
+			quick_check = PROPERTY_GET(property_index, property_data, decoded);
+		}
+
+		/* Compare CCC to previous CCC */
+
+		if (last_canonical_class > canonical_class &&
+			canonical_class > CCC_NOT_REORDERED)
+		{
+			result = UTF8_NORMALIZATION_RESULT_NO;
+
+			break;
+		}
+
+		/* Compare quick check value */
+
+		if (quick_check == QuickCheckResult_No)
+		{
+			result = UTF8_NORMALIZATION_RESULT_NO;
+
+			break;
+		}
+		else if (
+			quick_check == QuickCheckResult_Maybe)
+		{
+			result = UTF8_NORMALIZATION_RESULT_MAYBE;
+		}
+
+		/* Append to offset */
+
+		if (result != UTF8_NORMALIZATION_RESULT_MAYBE)
+		{
+			found_offset += read;
+		}
+
+		last_canonical_class = trailing_class;
+
+		src += read;
+		src_size -= read;
+	}
+
+end:
+	if (offset != 0)
+	{
+		*offset = found_offset;
+	}
+	return result;
+}
+
+size_t utf8normalize(const char* input, size_t inputSize, char* target, size_t targetSize, size_t flags, int32_t* errors)
+{
+	char* dst = target;
+	size_t dst_size = targetSize;
+	StreamState stream[4];
+	DecomposeState decompose_state;
+	ComposeState compose_state;
+	uint8_t compatibility = (flags & UTF8_NORMALIZE_COMPATIBILITY) != 0;
+	StreamState* stream_output;
+	uint8_t finished = 0;
+	size_t bytes_written = 0;
+
+	/*
+		Decomposition uses the following process:
+
+		input         -->  stream[0]  -->
+		(decompose)   -->  stream[1]  -->
+		(accumulate)  -->  stream[2]  -->
+		output
+
+		The accumulation step is necessary in order to prevent buffer overflow
+		attacks.
+
+		Composition adds another stream buffer:
+
+		input         --> stream[0]  -->
+		(decompose)   --> stream[1]  -->
+		(accumulate)  --> stream[2]  -->
+		(compose)     --> stream[3]  -->
+		output
+
+		Although four streaming buffers may seem excessive, they are necessary
+		for preventing allocations on the heap.
+	*/
+
+	/* Check for valid flags */
+
+	if ((flags & (UTF8_NORMALIZE_DECOMPOSE | UTF8_NORMALIZE_COMPOSE)) == 0 ||
+		((flags & UTF8_NORMALIZE_CASEFOLD) != 0 && !compatibility) ||
+		((flags & UTF8_NORMALIZE_FAST) != 0 && compatibility))
+	{
+		UTF8_SET_ERROR(INVALID_FLAG);
+
+		return bytes_written;
+	}
+
+	/* Validate parameters */
+
+	UTF8_VALIDATE_PARAMETERS_CHAR(char, bytes_written);
+
+	/* Initialize decomposition */
+
+	memset(stream, 0, sizeof(stream));
+
+	if (!stream_initialize(&stream[0], input, inputSize) ||
+		!decompose_initialize(&decompose_state, &stream[0], &stream[1], compatibility))
+	{
+		UTF8_SET_ERROR(INVALID_DATA);
+
+		return bytes_written;
+	}
+
+	if ((flags & UTF8_NORMALIZE_CASEFOLD) != 0)
+	{
+		/* Decompose to the NFKC_Casefold mapping instead */
+
+		decompose_state.qc_index = QuickCheckNFKDCasefoldIndexPtr;
+		decompose_state.qc_data = QuickCheckNFKDCasefoldDataPtr;
+
+		decompose_state.property_index1 = NFKCCasefoldIndex1Ptr;
+		decompose_state.property_index2 = NFKCCasefoldIndex2Ptr;
+		decompose_state.property_data = NFKCCasefoldDataPtr;
+
+		decompose_state.casefold = 1;
+	}
+
+	/* Remove nonspacing marks while decomposing */
+
+	decompose_state.strip_marks = (flags & UTF8_NORMALIZE_STRIP_MARKS) != 0;
+
+	stream_output = &stream[2];
+
+	if ((flags & UTF8_NORMALIZE_COMPOSE) != 0)
+	{
+		/* Initialize composition */
+
+		if (!compose_initialize(&compose_state, &stream[2], &stream[3], compatibility))
+		{
+			UTF8_SET_ERROR(INVALID_DATA);
+
+			return bytes_written;
+		}
+
+		/* FCC only composes adjacent codepoints */
+
+		compose_state.contiguous = (flags & UTF8_NORMALIZE_FAST) != 0;
+
+		stream_output = &stream[3];
+	}
+
+	do
+	{
+		uint8_t write = 0;
+
+		/* Accumulate decomposed input in next stream */
+
+		if (stream[1].current > 0)
+		{
+			unicode_t* src_codepoint = stream[1].codepoint;
+			unicode_t* dst_codepoint = stream[2].codepoint + stream[2].filled;
+			uint8_t* src_qc = stream[1].quick_check;
+			uint8_t* dst_qc = stream[2].quick_check + stream[2].filled;
+			uint8_t* src_ccc = stream[1].canonical_combining_class;
+			uint8_t* dst_ccc = stream[2].canonical_combining_class + stream[2].filled;
+
+			if ((flags & UTF8_NORMALIZE_COMPOSE) != 0)
+			{
+				uint8_t i;
+
+				/* Update stream properties to use composition values */
+
+				for (i = 0; i < stream[1].current; ++i)
+				{
+					*dst_qc++ = PROPERTY_GET(compose_state.qc_index, compose_state.qc_data, *src_codepoint);
+					*dst_ccc++ = *src_ccc++;
+					*dst_codepoint++ = *src_codepoint++;
+				}
+			}
+			else
+			{
+				/* Copy directly */
+
+				memcpy(dst_codepoint, src_codepoint, stream[1].current * sizeof(unicode_t));
+				memcpy(dst_qc, src_qc, stream[1].current * sizeof(uint8_t));
+				memcpy(dst_ccc, src_ccc, stream[1].current * sizeof(uint8_t));
+			}
+
+			stream[2].current += stream[1].current;
+			stream[2].filled += stream[1].current;
+		}
+
+		/* Decompose input sequence into next stream */
+
+		finished = !decompose_execute(&decompose_state);
+		if (!finished)
+		{
+			/* Output current stream it it could overflow accumulation buffer */
+
+			write =
+				stream[2].filled > 0 &&
+				(stream[1].current + stream[2].filled) >= STREAM_SAFE_MAX;
+		}
+
+		/* Reorder potentially unordered decomposed stream */
+
+		if (!stream[1].stable)
+		{
+			stream_reorder(&stream[1]);
+		}
+
+		/* Write stream to output when overflowing or when accumulation buffer is empty*/
+
+		if (write ||
+			finished)
+		{
+			uint8_t held = 0;
+			uint8_t i;
+
+			if ((flags & UTF8_NORMALIZE_COMPOSE) != 0 &&
+				!finished &&
+				stream[1].current > 0 &&
+				PROPERTY_GET(compose_state.qc_index, compose_state.qc_data, stream[1].codepoint[0]) != QuickCheckResult_Yes)
+			{
+				/*
+					The next sequence could compose with the code points in the
+					accumulation buffer, e.g. Hangul jamo, so everything after the
+					last stable starter is held back until the next write.
+				*/
+
+				uint8_t last_starter = stream[2].filled;
+
+				while (last_starter > 0 &&
+					(stream[2].canonical_combining_class[last_starter - 1] != CCC_NOT_REORDERED ||
+					stream[2].quick_check[last_starter - 1] != QuickCheckResult_Yes))
+				{
+					last_starter--;
+				}
+
+				if (last_starter > 1 &&
+					(stream[2].filled - last_starter + 1) + stream[1].current <= STREAM_BUFFER_MAX)
+				{
+					held = stream[2].filled - (last_starter - 1);
+
+					stream[2].current = last_starter - 1;
+				}
+			}
+
+			/* Compose accumulation buffer */
+
+			if ((flags & UTF8_NORMALIZE_COMPOSE) != 0 &&
+				!compose_execute(&compose_state))
+			{
+				break;
+			}
+
+			/* Write to output buffer */
+
+			for (i = 0; i < stream_output->current; ++i)
+			{
+				uint8_t encoded_size = codepoint_write(stream_output->codepoint[i], &dst, &dst_size);
+				if (encoded_size == 0)
+				{
+					UTF8_SET_ERROR(NOT_ENOUGH_SPACE);
+
+					return bytes_written;
+				}
+
+				bytes_written += encoded_size;
+			}
+
+			/* Reset accumulation buffer */
+
+			if (held > 0)
+			{
+				memmove(stream[2].codepoint, stream[2].codepoint + stream[2].filled - held, held * sizeof(unicode_t));
+				memmove(stream[2].quick_check, stream[2].quick_check + stream[2].filled - held, held * sizeof(uint8_t));
+				memmove(stream[2].canonical_combining_class, stream[2].canonical_combining_class + stream[2].filled - held, held * sizeof(uint8_t));
+			}
+
+			stream[2].index = 0;
+			stream[2].current = held;
+			stream[2].filled = held;
+		}
+	}
+	while (!finished);
+
+	UTF8_SET_ERROR(NONE);
+
+	return bytes_written;
+}
+
+size_t utf8normalizeedit(const char* input, size_t inputSize, size_t editOffset, size_t editSize, char* target, size_t targetSize, size_t flags, size_t* replaceOffset, size_t* replaceSize, int32_t* errors)
+{
+	NormalizationState state;
+	const char* input_end;
+	const char* window_start;
+	const char* window_end;
+
+	if (replaceOffset != 0)
+	{
+		*replaceOffset = 0;
+	}
+	if (replaceSize != 0)
+	{
+		*replaceSize = 0;
+	}
+
+	/* Check for valid flags */
+
+	if (!normalization_initialize(&state, flags))
+	{
+		UTF8_SET_ERROR(INVALID_FLAG);
+
+		return 0;
+	}
+
+	/* Validate edited range */
+
+	if (input == 0 ||
+		editOffset > inputSize)
+	{
+		UTF8_SET_ERROR(INVALID_DATA);
+
+		return 0;
+	}
+
+	if (editSize > inputSize - editOffset)
+	{
+		editSize = inputSize - editOffset;
+	}
+
+	/*
+		Text outside the edited range is already normalized, so only the
+		code points between the stable starters surrounding the edit can be
+		affected by it.
+	*/
+
+	input_end = input + inputSize;
+
+	window_start = normalization_boundaryrewind(&state, input, input + editOffset, input_end);
+	window_end = normalization_boundaryforward(&state, input + editOffset + editSize, input_end);
+
+	if (replaceOffset != 0)
+	{
+		*replaceOffset = (size_t)(window_start - input);
+	}
+	if (replaceSize != 0)
+	{
+		*replaceSize = (size_t)(window_end - window_start);
+	}
+
+	if (window_end == window_start)
+	{
+		/* Nothing to normalize */
+
+		UTF8_SET_ERROR(NONE);
+
+		return 0;
+	}
+
+	/* Normalize the window */
+
+	return utf8normalize(window_start, (size_t)(window_end - window_start), target, targetSize, flags, errors);
+}
+
+uint8_t utf8normalizerinit(utf8normalizer_t* normalizer, size_t flags, int32_t* errors)
+{
+	NormalizationState state;
+
+	if (normalizer == 0)
+	{
+		UTF8_SET_ERROR(INVALID_DATA);
+
+		return 0;
+	}
+
+	memset(normalizer, 0, sizeof(utf8normalizer_t));
+
+	/* Check for valid flags */
+
+	if (!normalization_initialize(&state, flags))
+	{
+		UTF8_SET_ERROR(INVALID_FLAG);
+
+		return 0;
+	}
+
+	normalizer->flags = flags;
+
+	UTF8_SET_ERROR(NONE);
+
+	return 1;
+}
+
+size_t utf8normalizerwrite(utf8normalizer_t* normalizer, const char* input, size_t inputSize, char* target, size_t targetSize, size_t* inputConsumed, int32_t* errors)
+{
+	NormalizationState state;
+	const char* src = input;
+	size_t src_size = inputSize;
+	size_t bytes_written = 0;
+
+	if (inputConsumed != 0)
+	{
+		*inputConsumed = 0;
+	}
+
+	/* Validate parameters */
+
+	if (normalizer == 0 ||
+		target == 0 ||
+		(input == 0 && inputSize > 0))
+	{
+		UTF8_SET_ERROR(INVALID_DATA);
+
+		return bytes_written;
+	}
+
+	if (!normalization_initialize(&state, normalizer->flags))
+	{
+		UTF8_SET_ERROR(INVALID_FLAG);
+
+		return bytes_written;
+	}
+
+	if (input != 0 &&
+		target < input + inputSize &&
+		input < target + targetSize)
+	{
+		UTF8_SET_ERROR(OVERLAPPING_PARAMETERS);
+
+		return bytes_written;
+	}
+
+	while (1)
+	{
+		const char* segment_end;
+		size_t segment_size;
+		size_t copy_size;
+		int32_t normalize_errors;
+
+		/* Write pending output */
+
+		copy_size = normalizer->output_size - normalizer->output_offset;
+		if (copy_size > targetSize - bytes_written)
+		{
+			copy_size = targetSize - bytes_written;
+		}
+
+		memcpy(target + bytes_written, normalizer->output + normalizer->output_offset, copy_size);
+		normalizer->output_offset += copy_size;
+		bytes_written += copy_size;
+
+		if (normalizer->output_offset < normalizer->output_size)
+		{
+			UTF8_SET_ERROR(NOT_ENOUGH_SPACE);
+
+			break;
+		}
+
+		/* Fill segment buffer with input */
+
+		copy_size = UTF8_NORMALIZER_SEGMENT_SIZE - normalizer->input_size;
+		if (copy_size > src_size)
+		{
+			copy_size = src_size;
+		}
+
+		if (copy_size > 0)
+		{
+			memcpy(normalizer->input + normalizer->input_size, src, copy_size);
+			normalizer->input_size += copy_size;
+
+			src += copy_size;
+			src_size -= copy_size;
+		}
+
+		/* Find the part of the segment that can't be affected by the next input */
+
+		segment_end = normalization_segmentend(&state, normalizer->input, normalizer->input + normalizer->input_size);
+		if (segment_end == normalizer->input)
+		{
+			if (normalizer->input_size < UTF8_NORMALIZER_SEGMENT_SIZE)
+			{
+				/* Wait for more input */
+
+				UTF8_SET_ERROR(NONE);
+
+				break;
+			}
+
+			/* Split a run of unstable code points that fills the segment in front of the last sequence */
+
+			segment_end = normalizer->input + normalizer->input_size;
+
+			do
+			{
+				segment_end--;
+			}
+			while (
+				segment_end > normalizer->input &&
+				codepoint_decoded_length[(uint8_t)*segment_end] == 0);
+
+			if (segment_end == normalizer->input)
+			{
+				segment_end = normalizer->input + normalizer->input_size;
+			}
+		}
+
+		/* Normalize segment into output buffer */
+
+		segment_size = (size_t)(segment_end - normalizer->input);
+
+		normalizer->output_offset = 0;
+		normalizer->output_size = utf8normalize(normalizer->input, segment_size, normalizer->output, sizeof(normalizer->output), normalizer->flags, &normalize_errors);
+		if (normalize_errors != UTF8_ERR_NONE)
+		{
+			/* Don't write partially normalized output */
+
+			normalizer->output_size = 0;
+
+			if (errors != 0)
+			{
+				*errors = normalize_errors;
+			}
+
+			break;
+		}
+
+		/* Move the rest of the segment to the front of the buffer */
+
+		normalizer->input_size -= segment_size;
+		memmove(normalizer->input, segment_end, normalizer->input_size);
+	}
+
+	if (inputConsumed != 0)
+	{
+		*inputConsumed = (size_t)(src - input);
+	}
+
+	return bytes_written;
+}
+
+size_t utf8normalizerflush(utf8normalizer_t* normalizer, char* target, size_t targetSize, int32_t* errors)
+{
+	NormalizationState state;
+	size_t bytes_written = 0;
+
+	/* Validate parameters */
+
+	if (normalizer == 0 ||
+		target == 0)
+	{
+		UTF8_SET_ERROR(INVALID_DATA);
+
+		return bytes_written;
+	}
+
+	if (!normalization_initialize(&state, normalizer->flags))
+	{
+		UTF8_SET_ERROR(INVALID_FLAG);
+
+		return bytes_written;
+	}
+
+	do
+	{
+		size_t copy_size;
+		int32_t normalize_errors;
+
+		/* Write pending output */
+
+		copy_size = normalizer->output_size - normalizer->output_offset;
+		if (copy_size > targetSize - bytes_written)
+		{
+			copy_size = targetSize - bytes_written;
+		}
+
+		memcpy(target + bytes_written, normalizer->output + normalizer->output_offset, copy_size);
+		normalizer->output_offset += copy_size;
+		bytes_written += copy_size;
+
+		if (normalizer->output_offset < normalizer->output_size)
+		{
+			UTF8_SET_ERROR(NOT_ENOUGH_SPACE);
+
+			return bytes_written;
+		}
+
+		/* Normalize the rest of the stream */
+
+		normalizer->output_offset = 0;
+		normalizer->output_size = 0;
+
+		if (normalizer->input_size > 0)
+		{
+			normalizer->output_size = utf8normalize(normalizer->input, normalizer->input_size, normalizer->output, sizeof(normalizer->output), normalizer->flags, &normalize_errors);
+			if (normalize_errors != UTF8_ERR_NONE)
+			{
+				/* Don't write partially normalized output */
+
+				normalizer->output_size = 0;
+
+				if (errors != 0)
+				{
+					*errors = normalize_errors;
+				}
+
+				return bytes_written;
+			}
+
+			normalizer->input_size = 0;
+		}
+	}
+	while (normalizer->output_size > 0);
+
+	UTF8_SET_ERROR(NONE);
+
+	return bytes_written;
+}
+
+size_t utf8normalizesplit(const char* input, size_t inputSize, size_t segmentSize, size_t* offsets, size_t offsetsSize, size_t flags, int32_t* errors)
+{
+	NormalizationState state;
+	const char* src;
+	const char* src_end;
+	size_t segment_count = 0;
+
+	/* Check for valid flags */
+
+	if (!normalization_initialize(&state, flags))
+	{
+		UTF8_SET_ERROR(INVALID_FLAG);
+
+		return segment_count;
+	}
+
+	/* Validate parameters */
+
+	if (input == 0 ||
+		segmentSize == 0)
+	{
+		UTF8_SET_ERROR(INVALID_DATA);
+
+		return segment_count;
+	}
+
+	src = input;
+	src_end = input + inputSize;
+
+	while (src < src_end)
+	{
+		/* Store the offset to the start of the segment */
+
+		if (offsets != 0)
+		{
+			if (segment_count == offsetsSize)
+			{
+				UTF8_SET_ERROR(NOT_ENOUGH_SPACE);
+
+				return segment_count;
+			}
+
+			offsets[segment_count] = (size_t)(src - input);
+		}
+
+		segment_count++;
+
+		if (segmentSize >= (size_t)(src_end - src))
+		{
+			break;
+		}
+
+		/*
+			Segments end in front of the first stable code point after the
+			requested size, which means they can be normalized independently.
+		*/
 
-		last_canonical_class = canonical_class;
+		src = normalization_boundaryforward(&state, src + segmentSize, src_end);
+	}
 
-		src += read;
-		src_size -= read;
+	UTF8_SET_ERROR(NONE);
+
+	return segment_count;
+}
+
+int utf8normcmp(const char* left, size_t leftSize, const char* right, size_t rightSize, size_t flags, int32_t* errors)
+{
+	int result;
+
+	/* Check for valid flags */
+
+	if ((flags & ~(UTF8_NORMALIZE_COMPATIBILITY | UTF8_NORMALIZE_CASEFOLD)) != 0 ||
+		((flags & UTF8_NORMALIZE_CASEFOLD) != 0 && (flags & UTF8_NORMALIZE_COMPATIBILITY) == 0))
+	{
+		UTF8_SET_ERROR(INVALID_FLAG);
+
+		return 0;
 	}
 
-end:
-	if (offset != 0)
+	/* Validate parameters */
+
+	if (left == 0 ||
+		right == 0)
 	{
-		*offset = found_offset;
+		UTF8_SET_ERROR(INVALID_DATA);
+
+		return 0;
 	}
+
+	/* Decompose both strings until the first difference */
+
+	result = normalization_compare(left, leftSize, right, rightSize, flags);
+
+	UTF8_SET_ERROR(NONE);
+
 	return result;
 }
 
-size_t utf8normalize(const char* input, size_t inputSize, char* target, size_t targetSize, size_t flags, int32_t* errors)
+uint64_t utf8normhash(const char* input, size_t inputSize, size_t flags, int32_t* errors)
 {
-	char* dst = target;
-	size_t dst_size = targetSize;
-	StreamState stream[4];
-	DecomposeState decompose_state;
-	ComposeState compose_state;
-	uint8_t compatibility = (flags & UTF8_NORMALIZE_COMPATIBILITY) != 0;
-	StreamState* stream_output;
-	uint8_t finished = 0;
-	size_t bytes_written = 0;
+	uint64_t result;
+
+	/* Check for valid flags */
+
+	if ((flags & ~(UTF8_NORMALIZE_COMPATIBILITY | UTF8_NORMALIZE_CASEFOLD)) != 0 ||
+		((flags & UTF8_NORMALIZE_CASEFOLD) != 0 && (flags & UTF8_NORMALIZE_COMPATIBILITY) == 0))
+	{
+		UTF8_SET_ERROR(INVALID_FLAG);
+
+		return 0;
+	}
+
+	/* Validate parameters */
+
+	if (input == 0)
+	{
+		UTF8_SET_ERROR(INVALID_DATA);
+
+		return 0;
+	}
+
+	/* Hash the decomposed code points */
+
+	result = normalization_hash(input, inputSize, flags);
+
+	UTF8_SET_ERROR(NONE);
+
+	return result;
+}
+
+const char* utf8normsearch(const char* input, size_t inputSize, const char* needle, size_t needleSize, size_t flags, size_t* matchSize, int32_t* errors)
+{
+	const char* result;
+
+	/* Check for valid flags */
+
+	if ((flags & ~(UTF8_NORMALIZE_COMPATIBILITY | UTF8_NORMALIZE_CASEFOLD)) != 0 ||
+		((flags & UTF8_NORMALIZE_CASEFOLD) != 0 && (flags & UTF8_NORMALIZE_COMPATIBILITY) == 0))
+	{
+		UTF8_SET_ERROR(INVALID_FLAG);
+
+		return 0;
+	}
+
+	/* Validate parameters */
+
+	if (input == 0 ||
+		needle == 0)
+	{
+		UTF8_SET_ERROR(INVALID_DATA);
+
+		return 0;
+	}
+
+	/* Empty needle matches the start of the input */
+
+	if (needleSize == 0)
+	{
+		if (matchSize != 0)
+		{
+			*matchSize = 0;
+		}
+
+		UTF8_SET_ERROR(NONE);
+
+		return input;
+	}
+
+	/* Decompose the input only where the needle could start */
+
+	result = normalization_search(input, inputSize, needle, needleSize, flags, matchSize);
+
+	UTF8_SET_ERROR(NONE);
+
+	return result;
+}
+
+size_t utf8iscategory(const char* input, size_t inputSize, size_t flags)
+{
+	const char* src = input;
+	size_t src_size = inputSize;
+	const uint32_t* basic_latin;
+
+	if (input == 0 ||
+		inputSize == 0)
+	{
+		return 0;
+	}
+
+	/* Compatibility flags match Basic Latin differently than the General Category */
+
+	basic_latin = database_querybasiclatincategory(flags);
+
+	while (src_size > 0)
+	{
+		unicode_t code_point;
+		uint32_t general_category;
+		uint8_t canonical_combining_class;
+		uint8_t offset;
+
+		/*
+			Match Basic Latin code points without decoding them, these are
+			never part of the grapheme cluster of the previous code point.
+		*/
+
+		if ((uint8_t)*src <= MAX_BASIC_LATIN)
+		{
+			if ((basic_latin[(uint8_t)*src] & flags) == 0)
+			{
+				break;
+			}
+
+			src++;
+			src_size--;
+
+			continue;
+		}
+
+		/* Read next code point */
+
+		offset = codepoint_read(src, src_size, &code_point);
+
+		/* Match General Category against flags */
+
+		general_category = PROPERTY_GET_GC(code_point);
+		if ((general_category & flags) == 0 &&
+			/* Check for the start of the next grapheme cluster */
+			((flags & UTF8_CATEGORY_IGNORE_GRAPHEME_CLUSTER) != 0 || (canonical_combining_class = PROPERTY_GET_CCC(code_point)) == CCC_NOT_REORDERED))
+		{
+			break;
+		}
+
+		/* Move source cursor */
+
+		if (offset > src_size)
+		{
+			break;
+		}
+
+		src += offset;
+		src_size -= offset;
+	}
+
+	return src - input;
+}
+
+size_t utf8categorycspan(const char* input, size_t inputSize, size_t flags)
+{
+	const char* src = input;
+	size_t src_size = inputSize;
+	const uint32_t* basic_latin;
+
+	if (input == 0 ||
+		inputSize == 0)
+	{
+		return 0;
+	}
+
+	basic_latin = database_querybasiclatincategory(flags);
+
+	while (src_size > 0)
+	{
+		unicode_t code_point;
+		uint8_t offset;
+
+		/* Match Basic Latin code points without decoding them */
+
+		if ((uint8_t)*src <= MAX_BASIC_LATIN)
+		{
+			if ((basic_latin[(uint8_t)*src] & flags) != 0)
+			{
+				break;
+			}
+
+			src++;
+			src_size--;
+
+			continue;
+		}
+
+		/* Read next code point */
+
+		offset = codepoint_read(src, src_size, &code_point);
+
+		/* Match General Category against flags, skipping the rest of the grapheme cluster */
+
+		if ((PROPERTY_GET_GC(code_point) & flags) != 0 &&
+			(src == input || (flags & UTF8_CATEGORY_IGNORE_GRAPHEME_CLUSTER) != 0 || PROPERTY_GET_CCC(code_point) == CCC_NOT_REORDERED))
+		{
+			break;
+		}
+
+		/* Move source cursor */
+
+		if (offset > src_size)
+		{
+			break;
+		}
+
+		src += offset;
+		src_size -= offset;
+	}
+
+	return src - input;
+}
+
+size_t utf8categoryruns(const char* input, size_t inputSize, const size_t* categories, size_t categoriesSize, utf8categoryrun_t* runs, size_t runsSize, int32_t* errors)
+{
+	size_t basic_latin[MAX_BASIC_LATIN + 1];
+	const char* src = input;
+	size_t src_size = inputSize;
+	size_t run_count = 0;
+	size_t run_category = 0;
+	uint8_t run_clusters = 0;
+	size_t category;
+	size_t i;
+
+	/* Validate parameters */
+
+	if (input == 0)
+	{
+		UTF8_SET_ERROR(INVALID_DATA);
+
+		return run_count;
+	}
+
+	if (categories == 0 ||
+		categoriesSize == 0)
+	{
+		UTF8_SET_ERROR(INVALID_FLAG);
+
+		return run_count;
+	}
+
+	/*
+		Classify Basic Latin up front, the categories are walked in reverse
+		order so the first entry that matches is stored.
+	*/
+
+	for (i = 0; i <= MAX_BASIC_LATIN; ++i)
+	{
+		basic_latin[i] = categoriesSize;
+	}
+
+	category = categoriesSize;
+	while (category-- > 0)
+	{
+		const uint32_t* match = database_querybasiclatincategory(categories[category]);
+
+		for (i = 0; i <= MAX_BASIC_LATIN; ++i)
+		{
+			if ((match[i] & categories[category]) != 0)
+			{
+				basic_latin[i] = category;
+			}
+		}
+	}
+
+	while (src_size > 0)
+	{
+		size_t length;
+
+		if ((uint8_t)*src <= MAX_BASIC_LATIN)
+		{
+			/* Consume Basic Latin code points in the same category without decoding them */
+
+			category = basic_latin[(uint8_t)*src];
+			length = 1;
+
+			while (
+				length < src_size &&
+				(uint8_t)src[length] <= MAX_BASIC_LATIN &&
+				basic_latin[(uint8_t)src[length]] == category)
+			{
+				length++;
+			}
+		}
+		else
+		{
+			unicode_t code_point;
+			uint32_t general_category;
+
+			/* Read next code point */
+
+			length = codepoint_read(src, src_size, &code_point);
+			if (length > src_size)
+			{
+				break;
+			}
+
+			/* Match General Category against the categories in order */
+
+			general_category = PROPERTY_GET_GC(code_point);
+
+			for (category = 0; category < categoriesSize; ++category)
+			{
+				if ((general_category & categories[category]) != 0)
+				{
+					break;
+				}
+			}
 
-	/*
-		Decomposition uses the following process:
+			/* Check for the start of the next grapheme cluster */
 
-		input         -->  stream[0]  -->
-		(decompose)   -->  stream[1]  -->
-		(accumulate)  -->  stream[2]  -->
-		output
+			if (category != run_category &&
+				run_clusters &&
+				PROPERTY_GET_CCC(code_point) != CCC_NOT_REORDERED)
+			{
+				category = run_category;
+			}
+		}
 
-		The accumulation step is necessary in order to prevent buffer overflow
-		attacks.
+		/* Start a new run when the category changes */
 
-		Composition adds another stream buffer:
+		if (run_count == 0 ||
+			category != run_category)
+		{
+			if (runs != 0)
+			{
+				if (run_count == runsSize)
+				{
+					UTF8_SET_ERROR(NOT_ENOUGH_SPACE);
 
-		input         --> stream[0]  -->
-		(decompose)   --> stream[1]  -->
-		(accumulate)  --> stream[2]  -->
-		(compose)     --> stream[3]  -->
-		output
+					return run_count;
+				}
 
-		Although four streaming buffers may seem excessive, they are necessary
-		for preventing allocations on the heap.
-	*/
+				runs[run_count].offset = (size_t)(src - input);
+				runs[run_count].length = 0;
+				runs[run_count].category = category;
+			}
 
-	/* Check for valid flags */
+			run_count++;
+			run_category = category;
+			run_clusters =
+				category == categoriesSize ||
+				(categories[category] & UTF8_CATEGORY_IGNORE_GRAPHEME_CLUSTER) == 0;
+		}
 
-	if ((flags & (UTF8_NORMALIZE_DECOMPOSE | UTF8_NORMALIZE_COMPOSE)) == 0)
-	{
-		UTF8_SET_ERROR(INVALID_FLAG);
+		if (runs != 0)
+		{
+			runs[run_count - 1].length += length;
+		}
 
-		return bytes_written;
+		src += length;
+		src_size -= length;
 	}
 
-	/* Validate parameters */
+	UTF8_SET_ERROR(NONE);
 
-	UTF8_VALIDATE_PARAMETERS_CHAR(char, bytes_written);
+	return run_count;
+}
 
-	/* Initialize decomposition */
+size_t utf8charsetcompile(utf8charset_t* set, size_t flags, const utf8range_t* include, size_t includeSize, const utf8range_t* exclude, size_t excludeSize, uint32_t* data, size_t dataSize, int32_t* errors)
+{
+	uint32_t block[CHARSET_BLOCK_SIZE];
+	uint32_t previous[CHARSET_BLOCK_SIZE];
+	const uint32_t* basic_latin;
+	size_t data_size = CHARSET_INDEX_SIZE;
+	size_t empty_offset = 0;
+	size_t full_offset = 0;
+	size_t previous_offset = 0;
+	size_t block_index;
+	size_t i;
 
-	memset(stream, 0, sizeof(stream));
+	/* Validate parameters */
 
-	if (!stream_initialize(&stream[0], input, inputSize) ||
-		!decompose_initialize(&decompose_state, &stream[0], &stream[1], compatibility))
+	if ((data != 0 && set == 0) ||
+		(include == 0 && includeSize > 0) ||
+		(exclude == 0 && excludeSize > 0))
 	{
 		UTF8_SET_ERROR(INVALID_DATA);
 
-		return bytes_written;
+		return 0;
 	}
 
-	stream_output = &stream[2];
-
-	if ((flags & UTF8_NORMALIZE_COMPOSE) != 0)
+	for (i = 0; i < includeSize + excludeSize; ++i)
 	{
-		/* Initialize composition */
+		const utf8range_t* range = (i < includeSize) ? &include[i] : &exclude[i - includeSize];
 
-		if (!compose_initialize(&compose_state, &stream[2], &stream[3], compatibility))
+		if (range->first > range->last ||
+			range->last > MAX_LEGAL_UNICODE)
 		{
 			UTF8_SET_ERROR(INVALID_DATA);
 
-			return bytes_written;
+			return 0;
 		}
+	}
 
-		stream_output = &stream[3];
+	if (data != 0 &&
+		dataSize < CHARSET_INDEX_SIZE)
+	{
+		UTF8_SET_ERROR(NOT_ENOUGH_SPACE);
+
+		return 0;
 	}
 
-	do
+	basic_latin = database_querybasiclatincategory(flags);
+
+	for (block_index = 0; block_index < CHARSET_INDEX_SIZE; ++block_index)
 	{
-		uint8_t write = 0;
+		unicode_t block_first = (unicode_t)(block_index << CHARSET_INDEX_SHIFT);
+		unicode_t block_last = block_first + (1 << CHARSET_INDEX_SHIFT) - 1;
+		unicode_t code_point;
+		uint32_t block_and = 0xFFFFFFFF;
+		uint32_t block_or = 0;
+		size_t offset;
 
-		/* Accumulate decomposed input in next stream */
+		memset(block, 0, sizeof(block));
 
-		if (stream[1].current > 0)
-		{
-			unicode_t* src_codepoint = stream[1].codepoint;
-			unicode_t* dst_codepoint = stream[2].codepoint + stream[2].filled;
-			uint8_t* src_qc = stream[1].quick_check;
-			uint8_t* dst_qc = stream[2].quick_check + stream[2].filled;
-			uint8_t* src_ccc = stream[1].canonical_combining_class;
-			uint8_t* dst_ccc = stream[2].canonical_combining_class + stream[2].filled;
+		/* Match General Category against flags */
 
-			if ((flags & UTF8_NORMALIZE_COMPOSE) != 0)
+		if (flags != 0)
+		{
+			for (code_point = block_first; code_point <= block_last; ++code_point)
 			{
-				uint8_t i;
+				uint32_t general_category = (code_point <= MAX_BASIC_LATIN)
+					? basic_latin[code_point]
+					: PROPERTY_GET_GC(code_point);
 
-				/* Update stream properties to use composition values */
-
-				for (i = 0; i < stream[1].current; ++i)
+				if ((general_category & flags) != 0)
 				{
-					*dst_qc++ = PROPERTY_GET(compose_state.qc_index, compose_state.qc_data, *src_codepoint);
-					*dst_ccc++ = *src_ccc++;
-					*dst_codepoint++ = *src_codepoint++;
+					block[(code_point - block_first) >> 5] |= (uint32_t)1 << (code_point & 31);
 				}
 			}
-			else
-			{
-				/* Copy directly */
-
-				memcpy(dst_codepoint, src_codepoint, stream[1].current * sizeof(unicode_t));
-				memcpy(dst_qc, src_qc, stream[1].current * sizeof(uint8_t));
-				memcpy(dst_ccc, src_ccc, stream[1].current * sizeof(uint8_t));
-			}
-
-			stream[2].current += stream[1].current;
-			stream[2].filled += stream[1].current;
 		}
 
-		/* Decompose input sequence into next stream */
+		/* Add included and remove excluded ranges */
 
-		finished = !decompose_execute(&decompose_state);
-		if (!finished)
+		for (i = 0; i < includeSize + excludeSize; ++i)
 		{
-			/* Output current stream it it could overflow accumulation buffer */
+			const utf8range_t* range = (i < includeSize) ? &include[i] : &exclude[i - includeSize];
+			unicode_t first = (range->first > block_first) ? range->first : block_first;
+			unicode_t last = (range->last < block_last) ? range->last : block_last;
 
-			write = (stream[1].current + stream[2].filled) >= STREAM_SAFE_MAX;
-		}
+			if (first > last)
+			{
+				continue;
+			}
 
-		/* Reorder potentially unordered decomposed stream */
+			for (code_point = first; code_point <= last; ++code_point)
+			{
+				if (i < includeSize)
+				{
+					block[(code_point - block_first) >> 5] |= (uint32_t)1 << (code_point & 31);
+				}
+				else
+				{
+					block[(code_point - block_first) >> 5] &= ~((uint32_t)1 << (code_point & 31));
+				}
+			}
+		}
 
-		if (!stream[1].stable)
+		for (i = 0; i < CHARSET_BLOCK_SIZE; ++i)
 		{
-			stream_reorder(&stream[1]);
+			block_and &= block[i];
+			block_or |= block[i];
 		}
 
-		/* Write stream to output when overflowing or when accumulation buffer is empty*/
+		/*
+			Share the storage for blocks without any code points, blocks
+			with every code point and repeats of the previous block.
+		*/
 
-		if (write ||
-			finished)
+		if (block_or == 0 &&
+			empty_offset != 0)
 		{
-			uint8_t i;
-
-			/* Compose accumulation buffer */
-
-			if ((flags & UTF8_NORMALIZE_COMPOSE) != 0 &&
-				!compose_execute(&compose_state))
-			{
-				break;
-			}
-
-			/* Write to output buffer */
+			offset = empty_offset;
+		}
+		else if (
+			block_and == 0xFFFFFFFF &&
+			full_offset != 0)
+		{
+			offset = full_offset;
+		}
+		else if (
+			previous_offset != 0 &&
+			memcmp(previous, block, sizeof(block)) == 0)
+		{
+			offset = previous_offset;
+		}
+		else
+		{
+			offset = data_size;
+			data_size += CHARSET_BLOCK_SIZE;
 
-			for (i = 0; i < stream_output->current; ++i)
+			if (data != 0)
 			{
-				uint8_t encoded_size = codepoint_write(stream_output->codepoint[i], &dst, &dst_size);
-				if (encoded_size == 0)
+				if (data_size > dataSize)
 				{
 					UTF8_SET_ERROR(NOT_ENOUGH_SPACE);
 
-					return bytes_written;
+					return 0;
 				}
 
-				bytes_written += encoded_size;
+				memcpy(data + offset, block, sizeof(block));
 			}
 
-			/* Reset accumulation buffer */
+			if (block_or == 0)
+			{
+				empty_offset = offset;
+			}
+			else if (
+				block_and == 0xFFFFFFFF)
+			{
+				full_offset = offset;
+			}
+		}
 
-			stream[2].current = 0;
-			stream[2].filled = 0;
+		if (data != 0)
+		{
+			data[block_index] = (uint32_t)offset;
 		}
+
+		memcpy(previous, block, sizeof(block));
+		previous_offset = offset;
+	}
+
+	if (data != 0)
+	{
+		set->data = data;
+		set->data_size = data_size;
+
+		memcpy(set->basic_latin, data + data[0], sizeof(set->basic_latin));
 	}
-	while (!finished);
 
 	UTF8_SET_ERROR(NONE);
 
-	return bytes_written;
+	return data_size;
 }
 
-size_t utf8iscategory(const char* input, size_t inputSize, size_t flags)
+uint8_t utf8charsetcontains(const utf8charset_t* set, unicode_t codePoint)
+{
+	if (set == 0 ||
+		set->data == 0 ||
+		codePoint > MAX_LEGAL_UNICODE)
+	{
+		return 0;
+	}
+
+	return (uint8_t)CHARSET_GET(set->data, codePoint);
+}
+
+size_t utf8charsetspan(const utf8charset_t* set, const char* input, size_t inputSize)
 {
 	const char* src = input;
 	size_t src_size = inputSize;
 
-	if (input == 0 ||
-		inputSize == 0)
+	if (set == 0 ||
+		set->data == 0 ||
+		input == 0)
 	{
 		return 0;
 	}
@@ -1100,137 +2865,80 @@ size_t utf8iscategory(const char* input, size_t inputSize, size_t flags)
 	while (src_size > 0)
 	{
 		unicode_t code_point;
-		uint32_t general_category;
-		uint8_t canonical_combining_class;
 		uint8_t offset;
 
-		/* Compatibility fixes */
+		/* Match Basic Latin code points without decoding them */
 
-		if ((flags & UTF8_CATEGORY_COMPATIBILITY) != 0 &&
-			*src < MAX_BASIC_LATIN)
+		if ((uint8_t)*src <= MAX_BASIC_LATIN)
 		{
-			if (flags == UTF8_CATEGORY_ISBLANK)
+			code_point = (uint8_t)*src;
+
+			if (((set->basic_latin[code_point >> 5] >> (code_point & 31)) & 1) == 0)
 			{
-				if (*src == 0x09)
-				{
-					/* CHARACTER TABULATION */
+				break;
+			}
 
-					src++;
-					src_size--;
+			src++;
+			src_size--;
 
-					continue;
-				}
-				else if (
-					*src == 0x20)
-				{
-					/* SPACE */
+			continue;
+		}
 
-					src++;
-					src_size--;
+		/* Read next code point */
 
-					continue;
-				}
-				else
-				{
-					break;
-				}
-			}
-			else if (
-				flags == UTF8_CATEGORY_ISSPACE)
-			{
-				if (*src < 0x09 ||
-					*src > 0x20)
-				{
-					break;
-				}
-				else if (
-					*src <= 0x0D)
-				{
-					/* CHARACTER TABULATION ... CARRIAGE RETURN (CR) */
+		offset = codepoint_read(src, src_size, &code_point);
+		if (offset > src_size ||
+			CHARSET_GET(set->data, code_point) == 0)
+		{
+			break;
+		}
 
-					src++;
-					src_size--;
+		src += offset;
+		src_size -= offset;
+	}
 
-					continue;
-				}
-				else if (
-					*src == 0x20)
-				{
-					/* SPACE */
+	return src - input;
+}
 
-					src++;
-					src_size--;
+size_t utf8charsetcspan(const utf8charset_t* set, const char* input, size_t inputSize)
+{
+	const char* src = input;
+	size_t src_size = inputSize;
 
-					continue;
-				}
-				else
-				{
-					break;
-				}
-			}
-			else if (
-				flags == UTF8_CATEGORY_ISXDIGIT)
-			{
-				if (*src < 0x30 ||
-					*src > 0x66)
-				{
-					break;
-				}
-				else if (
-					*src <= 0x39)
-				{
-					/* DIGIT ZERO ... DIGIT NINE */
+	if (set == 0 ||
+		set->data == 0 ||
+		input == 0)
+	{
+		return 0;
+	}
 
-					src++;
-					src_size--;
+	while (src_size > 0)
+	{
+		unicode_t code_point;
+		uint8_t offset;
 
-					continue;
-				}
-				else if (
-					*src >= 0x41 &&
-					*src <= 0x46)
-				{
-					/* LATIN CAPITAL LETTER A ... LATIN CAPITAL LETTER F */
+		/* Match Basic Latin code points without decoding them */
 
-					src++;
-					src_size--;
+		if ((uint8_t)*src <= MAX_BASIC_LATIN)
+		{
+			code_point = (uint8_t)*src;
 
-					continue;
-				}
-				else if (
-					*src >= 0x61)
-				{
-					/* LATIN SMALL LETTER A ... LATIN SMALL LETTER F */
+			if (((set->basic_latin[code_point >> 5] >> (code_point & 31)) & 1) != 0)
+			{
+				break;
+			}
 
-					src++;
-					src_size--;
+			src++;
+			src_size--;
 
-					continue;
-				}
-				else
-				{
-					break;
-				}
-			}
+			continue;
 		}
 
 		/* Read next code point */
 
 		offset = codepoint_read(src, src_size, &code_point);
-
-		/* Match General Category against flags */
-
-		general_category = PROPERTY_GET_GC(code_point);
-		if ((general_category & flags) == 0 &&
-			/* Check for the start of the next grapheme cluster */
-			((flags & UTF8_CATEGORY_IGNORE_GRAPHEME_CLUSTER) != 0 || (canonical_combining_class = PROPERTY_GET_CCC(code_point)) == CCC_NOT_REORDERED))
-		{
-			break;
-		}
-
-		/* Move source cursor */
-
-		if (offset > src_size)
+		if (offset > src_size ||
+			CHARSET_GET(set->data, code_point) != 0)
 		{
 			break;
 		}
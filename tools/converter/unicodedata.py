@@ -22,6 +22,8 @@ class UnicodeMapping:
 		self.generalCategory = ""
 		self.generalCategoryCombined = 0
 		self.canonicalCombiningClass = 0
+		self.leadingCanonicalCombiningClass = 0
+		self.trailingCanonicalCombiningClass = 0
 		self.bidiClass = ""
 		self.decompositionType = ""
 		self.decompositionCodepoints = []
@@ -42,6 +44,13 @@ class UnicodeMapping:
 		self.titlecase = []
 		self.caseFoldingType = ''
 		self.caseFolding = []
+		self.simpleCaseMapping = 0
+		self.nfkcCasefold = None
+		self.decomposedNFKCCasefold = []
+		self.quickNFKCCasefold = 0
+		self.quickNFKDCasefold = 0
+		self.graphemeClusterBreak = 0
+		self.wordBreak = 0
 		self.block = None
 	
 	def decomposedToString(self):
@@ -504,7 +513,7 @@ class CompressionString:
 				
 				chunk_length = len(re.findall('\\\\x?[^\\\\]+', converted))
 
-				self.table_data.append((chunk_length << 24) + (index / 4))
+				self.table_data.append((chunk_length << 24) + (index // 4))
 
 				self.database.compressed += converted[offset:]
 				self.database.compressed_length += len(re.findall('\\\\x?[^\\\\]+', converted[offset:]))
@@ -671,6 +680,7 @@ class Database(libs.unicode.UnicodeVisitor):
 		self.qcNFDRecords = []
 		self.qcNFKCRecords = []
 		self.qcNFKDRecords = []
+		self.simpleCaseMappingRecords = [ (0, 0, 0, 0) ]
 	
 	def loadFromFiles(self, arguments):
 		script_path = os.path.dirname(os.path.realpath(sys.argv[0]))
@@ -708,6 +718,8 @@ class Database(libs.unicode.UnicodeVisitor):
 		
 		self.resolveDecomposition()
 		self.resolveComposition()
+		self.resolveNFKCCasefold()
+		self.resolveFCD()
 		
 		# case mapping
 		
@@ -725,9 +737,31 @@ class Database(libs.unicode.UnicodeVisitor):
 		case_folding = CaseFolding(self)
 		document_case_folding.accept(case_folding)
 		
+		# grapheme cluster break
+		# these files are from Unicode 14.0, unlike the rest of the data, which is from Unicode 7.0
+		
+		grapheme_cluster_break = GraphemeClusterBreak(self)
+		
+		document_grapheme_break = libs.unicode.UnicodeDocument()
+		document_grapheme_break.parse(script_path + '/data/GraphemeBreakProperty.txt')
+		document_grapheme_break.accept(grapheme_cluster_break)
+		
+		document_emoji_data = libs.unicode.UnicodeDocument()
+		document_emoji_data.parse(script_path + '/data/emoji-data.txt')
+		document_emoji_data.accept(grapheme_cluster_break)
+		
+		# word break
+		
+		word_break = WordBreak(self)
+		
+		document_word_break = libs.unicode.UnicodeDocument()
+		document_word_break.parse(script_path + '/data/WordBreakProperty.txt')
+		document_word_break.accept(word_break)
+		
 		# properties
 		
 		self.resolveProperties()
+		self.resolveSimpleCaseMapping()
 	
 	def visitDocument(self, document):
 		print('Parsing document to codepoint database...')
@@ -871,6 +905,50 @@ class Database(libs.unicode.UnicodeVisitor):
 		for r in self.recordsOrdered:
 			r.compose()
 	
+	def resolveNFKCCasefold(self):
+		print('Resolving NFKC_Casefold...')
+		
+		for r in self.recordsOrdered:
+			if r.nfkcCasefold != None:
+				r.quickNFKCCasefold = 2
+				r.quickNFKDCasefold = 2
+				
+				# mapping is stored decomposed, because it replaces the decomposition step
+				
+				r.decomposedNFKCCasefold = []
+				for c in r.nfkcCasefold:
+					if c >= 0xAC00 and c <= 0xD7A3:
+						s_index = c - 0xAC00
+						r.decomposedNFKCCasefold.append(0x1100 + (s_index // 588))
+						r.decomposedNFKCCasefold.append(0x1161 + ((s_index % 588) // 28))
+						if (s_index % 28) != 0:
+							r.decomposedNFKCCasefold.append(0x11A7 + (s_index % 28))
+					elif c in self.records:
+						r.decomposedNFKCCasefold += self.records[c].decomposedNFD
+					else:
+						r.decomposedNFKCCasefold.append(c)
+			else:
+				r.quickNFKCCasefold = r.quickNFKC
+				r.quickNFKDCasefold = r.quickNFKD
+				r.decomposedNFKCCasefold = r.decomposedNFD
+	
+	def resolveFCD(self):
+		print('Resolving FCD...')
+		
+		for r in self.recordsOrdered:
+			# canonical combining class of the first and last code point in the canonical decomposition
+			
+			r.leadingCanonicalCombiningClass = r.canonicalCombiningClass
+			r.trailingCanonicalCombiningClass = r.canonicalCombiningClass
+			
+			if r.decomposedNFD:
+				first = r.decomposedNFD[0]
+				if first in self.records:
+					r.leadingCanonicalCombiningClass = self.records[first].canonicalCombiningClass
+				last = r.decomposedNFD[-1]
+				if last in self.records:
+					r.trailingCanonicalCombiningClass = self.records[last].canonicalCombiningClass
+	
 	def resolveProperties(self):
 		print('Resolving codepoint properties...')
 		
@@ -917,6 +995,35 @@ class Database(libs.unicode.UnicodeVisitor):
 		if group_ccc:
 			group_ccc.end = group_ccc.start + group_ccc.count
 	
+	def resolveSimpleCaseMapping(self):
+		print('Resolving simple case mappings...')
+		
+		indices = dict()
+		indices[self.simpleCaseMappingRecords[0]] = 0
+		
+		def delta(codepoint, mapping):
+			# only mappings to a single code point can be stored as an offset
+			
+			if len(mapping) != 1 or mapping[0] == codepoint:
+				return 0
+			return mapping[0] - codepoint
+		
+		for r in self.recordsOrdered:
+			record = (
+				delta(r.codepoint, r.uppercase),
+				delta(r.codepoint, r.lowercase),
+				delta(r.codepoint, r.titlecase),
+				delta(r.codepoint, r.caseFolding)
+			)
+			
+			if record not in indices:
+				indices[record] = len(self.simpleCaseMappingRecords)
+				self.simpleCaseMappingRecords.append(record)
+			
+			r.simpleCaseMapping = indices[record]
+		
+		print('Simple case mapping records: ' + str(len(self.simpleCaseMappingRecords)))
+	
 	def resolveCodepoint(self, codepoint, compatibility):
 		found = self.records[codepoint]
 		if not found:
@@ -1052,6 +1159,32 @@ class Database(libs.unicode.UnicodeVisitor):
 		
 		header.newLine()
 	
+	def writeSimpleCaseMappingRecords(self, header):
+		records = self.simpleCaseMappingRecords
+		
+		header.writeLine("const SimpleCaseMappingRecord UnicodeSimpleCaseMappingRecord[" + str(len(records)) + "] = {")
+		header.indent()
+		
+		count = 0
+		
+		for r in records:
+			if (count % 4) == 0:
+				header.writeIndentation()
+			
+			header.write("{ %d, %d, %d, %d }," % r)
+			
+			count += 1
+			if count != len(records):
+				if (count % 4) == 0:
+					header.newLine()
+				else:
+					header.write(" ")
+		
+		header.newLine()
+		header.outdent()
+		header.writeLine("};")
+		header.write("const SimpleCaseMappingRecord* UnicodeSimpleCaseMappingRecordPtr = UnicodeSimpleCaseMappingRecord;")
+	
 	def writeSource(self, filepath):
 		print('Compressing code point properties...')
 
@@ -1076,6 +1209,27 @@ class Database(libs.unicode.UnicodeVisitor):
 		compress_qc_nfkd = Compression(db)
 		compress_qc_nfkd.process('quickNFKD', 32)
 
+		compress_qc_nfkc_cf = Compression(db)
+		compress_qc_nfkc_cf.process('quickNFKCCasefold', 32)
+
+		compress_qc_nfkd_cf = Compression(db)
+		compress_qc_nfkd_cf.process('quickNFKDCasefold', 32)
+
+		compress_lccc = Compression(db)
+		compress_lccc.process('leadingCanonicalCombiningClass', 32)
+
+		compress_tccc = Compression(db)
+		compress_tccc.process('trailingCanonicalCombiningClass', 32)
+
+		compress_gcb = Compression(db)
+		compress_gcb.process('graphemeClusterBreak', 32)
+
+		compress_wb = Compression(db)
+		compress_wb.process('wordBreak', 32)
+
+		compress_scm = Compression(db)
+		compress_scm.process('simpleCaseMapping', 32)
+
 		self.compressed = ""
 		self.compressed_length = 0
 
@@ -1096,6 +1250,9 @@ class Database(libs.unicode.UnicodeVisitor):
 
 		compress_casefolding = CompressionString(db)
 		compress_casefolding.process('caseFolding', 32, 128)
+
+		compress_nfkc_cf = CompressionString(db)
+		compress_nfkc_cf.process('decomposedNFKCCasefold', 32, 128)
 		
 		print('Writing database to "' + os.path.realpath(filepath) + '"...')
 		
@@ -1139,6 +1296,24 @@ class Database(libs.unicode.UnicodeVisitor):
 
 		compress_qc_nfkd.render(header, 'QuickCheckNFKD')
 		header.newLine()
+
+		compress_qc_nfkc_cf.render(header, 'QuickCheckNFKCCasefold')
+		header.newLine()
+
+		compress_qc_nfkd_cf.render(header, 'QuickCheckNFKDCasefold')
+		header.newLine()
+
+		compress_lccc.render(header, 'LeadingCanonicalCombiningClass')
+		header.newLine()
+
+		compress_tccc.render(header, 'TrailingCanonicalCombiningClass')
+		header.newLine()
+
+		compress_gcb.render(header, 'GraphemeClusterBreak')
+		header.newLine()
+
+		compress_wb.render(header, 'WordBreak')
+		header.newLine()
 		
 		# decomposition
 
@@ -1161,6 +1336,16 @@ class Database(libs.unicode.UnicodeVisitor):
 
 		compress_casefolding.render(header, 'CaseFolding')
 		header.newLine()
+
+		compress_scm.render(header, 'SimpleCaseMapping')
+		header.newLine()
+
+		header.newLine()
+		self.writeSimpleCaseMappingRecords(header)
+		header.newLine()
+
+		compress_nfkc_cf.render(header, 'NFKCCasefold')
+		header.newLine()
 		
 		# composition
 		
@@ -1371,7 +1556,14 @@ class Normalization(libs.unicode.UnicodeVisitor):
 			self.db.__dict__[nf_member[property]].append(qc)
 		
 		def case_fold(property):
-			pass
+			mapping = []
+			if len(matches) > 2:
+				for m in matches[2]:
+					mapping.append(int(m, 16))
+			
+			for i in range(start, start + count + 1):
+				if i in self.db.records:
+					self.db.records[i].nfkcCasefold = mapping
 		
 		def changes_when_nfkc_casefolded(property):
 			pass
@@ -1409,6 +1601,81 @@ class Normalization(libs.unicode.UnicodeVisitor):
 		
 		return True
 
+class BreakProperty(libs.unicode.UnicodeVisitor):
+	def __init__(self, db, field, name, values):
+		self.db = db
+		self.field = field
+		self.name = name
+		self.values = values
+	
+	def visitDocument(self, document):
+		print("Parsing " + self.name + " properties...")
+		return True
+	
+	def visitEntry(self, entry):
+		if not entry.matches[0]:
+			return False
+		
+		match = re.match('([0-9A-Fa-f]+)\.?\.?([0-9A-Fa-f]+)?', entry.matches[0][0])
+		if match:
+			start = int(match.group(1), 16)
+			if match.group(2):
+				end = int(match.group(2), 16)
+			else:
+				end = start
+			
+			value = self.values[entry.matches[1][0]]
+			
+			for i in range(start, end + 1):
+				if i in self.db.records:
+					self.db.records[i].__dict__[self.field] = value
+		
+		return True
+
+class GraphemeClusterBreak(BreakProperty):
+	def __init__(self, db):
+		BreakProperty.__init__(self, db, 'graphemeClusterBreak', 'grapheme cluster break', {
+			"Other": 0,
+			"CR": 1,
+			"LF": 2,
+			"Control": 3,
+			"Extend": 4,
+			"ZWJ": 5,
+			"Regional_Indicator": 6,
+			"Prepend": 7,
+			"SpacingMark": 8,
+			"L": 9,
+			"V": 10,
+			"T": 11,
+			"LV": 12,
+			"LVT": 13,
+			"Extended_Pictographic": 14,
+		})
+
+class WordBreak(BreakProperty):
+	def __init__(self, db):
+		BreakProperty.__init__(self, db, 'wordBreak', 'word break', {
+			"Other": 0,
+			"CR": 1,
+			"LF": 2,
+			"Newline": 3,
+			"Extend": 4,
+			"ZWJ": 5,
+			"Regional_Indicator": 6,
+			"Format": 7,
+			"Katakana": 8,
+			"Hebrew_Letter": 9,
+			"ALetter": 10,
+			"Single_Quote": 11,
+			"Double_Quote": 12,
+			"MidNumLet": 13,
+			"MidLetter": 14,
+			"MidNum": 15,
+			"Numeric": 16,
+			"ExtendNumLet": 17,
+			"WSegSpace": 18,
+		})
+
 if __name__ == '__main__':
 	parser = argparse.ArgumentParser(description='Converts Unicode data files.')
 	parser.add_argument(
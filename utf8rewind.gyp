@@ -22,8 +22,12 @@
 				'source/internal/database.h',
 				'source/internal/decomposition.c',
 				'source/internal/decomposition.h',
+				'source/internal/normalization.c',
+				'source/internal/normalization.h',
 				'source/internal/seeking.c',
 				'source/internal/seeking.h',
+				'source/internal/segmentation.c',
+				'source/internal/segmentation.h',
 				'source/internal/streaming.c',
 				'source/internal/streaming.h',
 				'source/unicodedatabase.c',
@@ -111,20 +115,40 @@
 				'source/tests/suite-stream-write.cpp',
 				'source/tests/suite-utf16-toutf8.cpp',
 				'source/tests/suite-utf32-toutf8.cpp',
+				'source/tests/suite-utf8-casecmp.cpp',
 				'source/tests/suite-utf8-casefold.cpp',
 				'source/tests/suite-utf8-casefold-turkish.cpp',
+				'source/tests/suite-utf8-casemap-split.cpp',
+				'source/tests/suite-utf8-casesearch.cpp',
+				'source/tests/suite-utf8-category-runs.cpp',
+				'source/tests/suite-utf8-charset.cpp',
+				'source/tests/suite-utf8-grapheme.cpp',
+				'source/tests/suite-utf8-hash.cpp',
+				'source/tests/suite-utf8-inplace.cpp',
+				'source/tests/suite-utf8-iscased.cpp',
 				'source/tests/suite-utf8-iscategory.cpp',
 				'source/tests/suite-utf8-isnormalized-compose.cpp',
 				'source/tests/suite-utf8-isnormalized-decompose.cpp',
 				'source/tests/suite-utf8-isnormalized.cpp',
 				'source/tests/suite-utf8-len.cpp',
+				'source/tests/suite-utf8-line-index.cpp',
+				'source/tests/suite-utf8-locale.cpp',
+				'source/tests/suite-utf8-normalize-casefold.cpp',
 				'source/tests/suite-utf8-normalize-compose.cpp',
 				'source/tests/suite-utf8-normalize-decompose.cpp',
+				'source/tests/suite-utf8-normalize-edit.cpp',
+				'source/tests/suite-utf8-normalize-fast.cpp',
+				'source/tests/suite-utf8-normalize-split.cpp',
+				'source/tests/suite-utf8-normalize-strip-marks.cpp',
+				'source/tests/suite-utf8-normalizer.cpp',
 				'source/tests/suite-utf8-normalize.cpp',
+				'source/tests/suite-utf8-normcmp.cpp',
+				'source/tests/suite-utf8-normsearch.cpp',
 				'source/tests/suite-utf8-seek-current.cpp',
 				'source/tests/suite-utf8-seek-current-backwards.cpp',
 				'source/tests/suite-utf8-seek-current-forward.cpp',
 				'source/tests/suite-utf8-seek-end.cpp',
+				'source/tests/suite-utf8-seek-index.cpp',
 				'source/tests/suite-utf8-seek-set.cpp',
 				'source/tests/suite-utf8-seek.cpp',
 				'source/tests/suite-utf8-tolower.cpp',
@@ -142,6 +166,7 @@
 				'source/tests/suite-utf8-toutf16.cpp',
 				'source/tests/suite-utf8-toutf32.cpp',
 				'source/tests/suite-utf8-towide.cpp',
+				'source/tests/suite-utf8-word-split.cpp',
 				'source/tests/suite-wide-toutf8.cpp',
 				'source/tests/tests-base.hpp',
 				'source/tests/tests-main.cpp',